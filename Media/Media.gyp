@@ -1,4 +1,9 @@
 {
+    'variables':
+    {
+        # Records PROFILE_ZONE timings for the debugger's profiler view
+        'dwarf_profiler%': 0,
+    },
     'targets':
     [
         {
@@ -28,6 +33,32 @@
                     'Scripts',
                 ],
             },
+            'conditions':
+            [
+                ['dwarf_profiler==1',
+                {
+                    'defines':
+                    [
+                        'DWARF_PROFILER_ENABLED',
+                    ],
+                }],
+            ],
+        },
+        {
+            'target_name': 'MediaTests',
+            'type': 'executable',
+            'dependencies':
+            [
+                'Media',
+            ],
+            'include_dirs':
+            [
+                'Tests',
+            ],
+            'includes':
+            [
+                'Tests/TestsSource.gypi',
+            ],
         },
     ]
 }
@@ -311,111 +311,109 @@ namespace Dwarf
             return _executing;
         }
 
-        static float GetFoodRange(Character::Character* owner)
+        static ChannelingFoodHeal::FoodModifiers ComputeFoodModifiers(Character::Character* owner)
         {
-            float modifier = 1.0f;
-            for (auto modifierItem : owner->GetItems<Item::ChannelingFoodModifier>())
+            ChannelingFoodHeal::FoodModifiers modifiers;
+
+            Character::BasicCharacter* basicOwner = AsA<Character::BasicCharacter>(owner);
+            std::vector<Item::ChannelingFoodModifier*> modifierItems = basicOwner ? basicOwner->GetIndexedItems<Item::ChannelingFoodModifier>()
+                                                                                  : owner->GetItems<Item::ChannelingFoodModifier>();
+            for (auto modifierItem : modifierItems)
             {
-                modifier *= modifierItem->GetCookRangeModifier();
+                modifiers.RangeModifier *= modifierItem->GetCookRangeModifier();
+                modifiers.AdditionalTargets += modifierItem->GetCookFoodAdditionalTargetCount();
+                modifiers.DoesAOE |= modifierItem->CookedFoodDoesAOE();
+                modifiers.TargetsEnemies |= modifierItem->CookedFoodTargetsEnemies();
+                modifiers.HealsOverTime |= modifierItem->CookedFoodHealsOverTime();
             }
 
-            return FoodRange * modifier;
+            return modifiers;
         }
 
-        static bool CookedFoodDoesAOE(Character::Character* owner)
+        const ChannelingFoodHeal::FoodModifiers& ChannelingFoodHeal::getFoodModifiers() const
         {
-            for (auto modifierItem : owner->GetItems<Item::ChannelingFoodModifier>())
+            Character::Character* owner = GetOwner();
+            Character::BasicCharacter* basicOwner = AsA<Character::BasicCharacter>(owner);
+            if (!_foodModifiersValid || !basicOwner || basicOwner->GetEquipmentRevision() != _foodModifiersRevision)
             {
-                if (modifierItem->CookedFoodDoesAOE())
-                {
-                    return true;
-                }
+                _foodModifiers = ComputeFoodModifiers(owner);
+                _foodModifiersRevision = basicOwner ? basicOwner->GetEquipmentRevision() : 0;
+                _foodModifiersValid = true;
             }
 
-            return false;
+            return _foodModifiers;
         }
 
-        static bool CookedFoodTargetsEnemies(Character::Character* owner)
+        static float GetFoodRange(const ChannelingFoodHeal::FoodModifiers& modifiers)
         {
-            for (auto modifierItem : owner->GetItems<Item::ChannelingFoodModifier>())
-            {
-                if (modifierItem->CookedFoodTargetsEnemies())
-                {
-                    return true;
-                }
-            }
-
-            return false;
+            return FoodRange * modifiers.RangeModifier;
         }
 
-        static bool CookedFoodHealsOverTime(Character::Character* owner)
+        // Fills targets, the selection is only scratch storage
+        static void GetFoodTargets(Character::Character* owner, const ChannelingFoodHeal::FoodModifiers& modifiers,
+                                   Character::TargetSelection<std::tuple<bool, float>>& selection, std::vector<Character::CharacterID>& targets)
         {
-            for (auto modifierItem : owner->GetItems<Item::ChannelingFoodModifier>())
+            uint32_t numTargets = 1 + modifiers.AdditionalTargets;
+
+            float range = GetFoodRange(modifiers);
+            const bool targetsEnemies = modifiers.TargetsEnemies;
+            auto filter = [owner, range, targetsEnemies](const Character::Character* target)
             {
-                if (modifierItem->CookedFoodHealsOverTime())
+                if (targetsEnemies)
                 {
-                    return true;
+                    return target != owner &&
+                        target->IsAlive() &&
+                        Vector2f::DistanceSquared(owner->GetPosition(), target->GetPosition()) <= range * range &&
+                        owner->IsCharacterAttackable(target, false);
                 }
-            }
-
-            return false;
-        }
+                else
+                {
+                    return target != owner &&
+                        owner->GetController() == target->GetController() &&
+                        ((target->GetEntityMask() & Character::CharacterMask_Constructed) == 0) &&
+                        target->IsAlive() &&
+                        Vector2f::DistanceSquared(owner->GetPosition(), target->GetPosition()) <= range * range &&
+                        target->GetHealth().GetPercent() < 1.0f;
+                }
+            };
 
-        static const std::vector<Character::CharacterID> GetFoodTargets(Character::Character* owner)
-        {
-            uint32_t numTargets = 1;
-            for (auto modifierItem : owner->GetItems<Item::ChannelingFoodModifier>())
+            // Constructed characters last, then lowest health first
+            auto score = [](const Character::Character* target)
             {
-                numTargets += modifierItem->GetCookFoodAdditionalTargetCount();
-            }
+                return std::make_tuple((target->GetEntityMask() & Character::CharacterMask_Constructed) != 0, target->GetHealth().GetCurrent());
+            };
 
-            float range = GetFoodRange(owner);
-            std::vector<Character::Character*> characters;
+            targets.clear();
 
-            if (CookedFoodTargetsEnemies(owner))
+            const Character::TargetIndex* targetIndex = Character::GetTargetIndex(owner);
+            if (targetIndex)
             {
-                characters = owner->GetLevelLayer()->GetCharacters<Character::Character>(
-                    [owner, range](const Character::Character* target)
-                    {
-                        return target != owner &&
-                            target->IsAlive() &&
-                            Vector2f::DistanceSquared(owner->GetPosition(), target->GetPosition()) <= range * range &&
-                            owner->IsCharacterAttackable(target, false);
-                    });
+                selection.Reset(numTargets);
+                targetIndex->FindTargets(owner->GetLevelLayer(), owner->GetPosition(), range, filter, score, selection);
+                selection.Finish();
+
+                for (uint32_t i = 0; i < selection.GetCount(); i++)
+                {
+                    targets.push_back(selection.GetTarget(i)->GetID());
+                }
             }
             else
             {
-                characters = owner->GetLevelLayer()->GetCharacters<Character::Character>(
-                    [owner, range](const Character::Character* target)
-                    {
-                        return target != owner &&
-                            owner->GetController() == target->GetController() &&
-                            ((target->GetEntityMask() & Character::CharacterMask_Constructed) == 0) &&
-                            target->IsAlive() &&
-                            Vector2f::DistanceSquared(owner->GetPosition(), target->GetPosition()) <= range * range &&
-                            target->GetHealth().GetPercent() < 1.0f;
-                    });
-            }
+                std::vector<Character::Character*> characters = owner->GetLevelLayer()->GetCharacters<Character::Character>(filter);
+                std::sort(characters.begin(), characters.end(), [&score](const Character::Character* a, const Character::Character* b)
+                {
+                    return score(a) < score(b);
+                });
 
-            std::sort(characters.begin(), characters.end(),
-                [owner](const Character::Character* a, const Character::Character* b)
-            {
-                //return Vector2f::DistanceSquared(owner->GetPosition(), a->GetPosition()) < 
-                //       Vector2f::DistanceSquared(owner->GetPosition(), b->GetPosition());
-                return std::make_tuple((a->GetEntityMask() & Character::CharacterMask_Constructed) != 0, a->GetHealth().GetCurrent()) <
-                       std::make_tuple((b->GetEntityMask() & Character::CharacterMask_Constructed) != 0, b->GetHealth().GetCurrent());
-            });
-
-            std::vector<Character::CharacterID> result;
-            for (uint32_t i = 0; i < Min(characters.size(), numTargets); i++)
-            {
-                result.push_back(characters[i]->GetID());
+                for (uint32_t i = 0; i < Min(characters.size(), numTargets); i++)
+                {
+                    targets.push_back(characters[i]->GetID());
+                }
             }
-
-            return result;
         }
 
-        static Character::ThrownFoodParams GenerateThrownFoodParams(Character::Character* owner, Character::CharacterID target, uint32_t matsetIdx)
+        static Character::ThrownFoodParams GenerateThrownFoodParams(Character::Character* owner, const ChannelingFoodHeal::FoodModifiers& modifiers,
+                                                                    Character::CharacterID target, uint32_t matsetIdx)
         {
             Character::ThrownFoodParams foodParams;
 
@@ -423,14 +421,14 @@ namespace Dwarf
             foodParams.target = target;
             foodParams.matsetIdx = matsetIdx;
 
-            if (CookedFoodTargetsEnemies(owner))
+            if (modifiers.TargetsEnemies)
             {
                 foodParams.damageAmount = FoodDamage;
             }
             else
             {
                 foodParams.healAmount = FoodHealing;
-                if (CookedFoodHealsOverTime(owner))
+                if (modifiers.HealsOverTime)
                 {
                     foodParams.hotAmmount = FoodHoTAmount;
                     foodParams.hotDuration = FoodHoTDuration;
@@ -452,7 +450,7 @@ namespace Dwarf
 
                 if (_cooking)
                 {
-                    _targets = GetFoodTargets(owner);
+                    GetFoodTargets(owner, getFoodModifiers(), _targetSelection, _targets);
 
                     _cookingTimer -= dt;
                     if (_targets.size() > 0 && _cookingTimer <= 0.0f)
@@ -481,7 +479,7 @@ namespace Dwarf
                                 continue;
                             }
 
-                            Character::ThrownFoodParams foodParams = GenerateThrownFoodParams(owner, targetID, _curFoodIdx);
+                            Character::ThrownFoodParams foodParams = GenerateThrownFoodParams(owner, getFoodModifiers(), targetID, _curFoodIdx);
 
                             Character::CharacterConstructor<Character::ThrownFood> constructor =
                                 Character::BindCharacterConstructor<Character::ThrownFood>(foodParams);
@@ -502,7 +500,7 @@ namespace Dwarf
 
                             Vector2f dir = target->GetBounds().Middle() - projectile->GetPosition();
 
-                            float rangePerc = Clamp(dir.Length() / GetFoodRange(owner), 0.0f, 1.0f);
+                            float rangePerc = Clamp(dir.Length() / GetFoodRange(getFoodModifiers()), 0.0f, 1.0f);
 
                             // Adjust flight time depending on range perc
                             const float t = Lerp(0.05f, 0.6f, rangePerc);
@@ -675,7 +673,7 @@ namespace Dwarf
                 const Camera& worldCam = owner->GetLevel()->GetCameraController().GetCamera();
                 const Camera& hudCam = owner->GetLevel()->GetHUDCamera();
 
-                float range = GetFoodRange(owner);
+                float range = GetFoodRange(getFoodModifiers());
 
                 Vector2f hudCenter = Camera::Transpose(worldCam, _placementPotPosition, hudCam);
                 float hudRadius = Vector2f::Distance(hudCenter, Camera::Transpose(worldCam, _placementPotPosition + Vector2f(range, 0.0f), hudCam));
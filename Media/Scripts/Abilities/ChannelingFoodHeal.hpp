@@ -2,8 +2,11 @@
 
 #include "Animation/SkeletonInstance.hpp"
 #include "Abilities/BasicAbility.hpp"
+#include "Characters/TargetIndex.hpp"
 #include "SoundSet.hpp"
 
+#include <tuple>
+
 namespace Dwarf
 {
     namespace Ability
@@ -29,7 +32,19 @@ namespace Dwarf
             void OnDraw(Graphics::LevelRenderer* levelRenderer) const override;
             void OnDrawHUD(Graphics::SpriteRenderer* spriteRenderer) const override;
 
+            // Combined effect of the owner's ChannelingFoodModifier items
+            struct FoodModifiers
+            {
+                float RangeModifier = 1.0f;
+                uint32_t AdditionalTargets = 0;
+                bool DoesAOE = false;
+                bool TargetsEnemies = false;
+                bool HealsOverTime = false;
+            };
+
         private:
+            const FoodModifiers& getFoodModifiers() const;
+
             bool VerifyPotPosition(const Vector2f& pos, Vector2f& placePos);
             void setDrawPot(bool drawPot);
             void setDrawFood(bool drawFood);
@@ -46,6 +61,9 @@ namespace Dwarf
 
             std::vector<Character::CharacterID> _targets;
 
+            // Kept between updates so that looking for targets while cooking does not allocate
+            Character::TargetSelection<std::tuple<bool, float>> _targetSelection;
+
             bool _throwing = false;
             bool _drawFood = false;
             uint32_t _curFoodIdx = 0;
@@ -59,6 +77,11 @@ namespace Dwarf
 
             Audio::SoundSet _cookingSounds;
             std::shared_ptr<Audio::ManagedSoundInstance> _curCookingSound;
+
+            // Only recomputed when the owner's equipment revision changes
+            mutable FoodModifiers _foodModifiers;
+            mutable uint32_t _foodModifiersRevision = 0;
+            mutable bool _foodModifiersValid = false;
         };
     }
 
@@ -62,7 +62,7 @@ namespace Dwarf
                 AsA<Character::BasicCharacter>(owner)->StopPointingMainArm();
             }
 
-            for (Item::GrappleAttachable* grappleAttachableWeapon : owner->GetWeapons<Item::GrappleAttachable>())
+            for (Item::GrappleAttachable* grappleAttachableWeapon : Character::GetIndexedWeapons<Item::GrappleAttachable>(owner))
             {
                 grappleAttachableWeapon->SetGrappleAttached(false);
             }
@@ -70,7 +70,7 @@ namespace Dwarf
 
         static Vector2f getShootPos(Character::Character *owner)
         {
-            std::vector<Item::MuzzleHaver*> muzzleWeapons = owner->GetWeapons<Item::MuzzleHaver>();
+            const std::vector<Item::MuzzleHaver*>& muzzleWeapons = Character::GetIndexedWeapons<Item::MuzzleHaver>(owner);
             if (!muzzleWeapons.empty())
             {
                 return muzzleWeapons.front()->GetMuzzlePosition().Position;
@@ -105,7 +105,7 @@ namespace Dwarf
                 AsA<Character::BasicCharacter>(owner)->PointMainArmAt(pos);
             }
 
-            for (Item::GrappleAttachable* grappleAttachableWeapon : owner->GetWeapons<Item::GrappleAttachable>())
+            for (Item::GrappleAttachable* grappleAttachableWeapon : Character::GetIndexedWeapons<Item::GrappleAttachable>(owner))
             {
                 grappleAttachableWeapon->SetGrappleAttached(true);
             } 
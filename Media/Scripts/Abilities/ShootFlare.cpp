@@ -11,6 +11,7 @@
 #include "Characters/Torch.hpp"
 #include "Characters/Explosive.hpp"
 #include "Buffs/BurningDamageOverTime.hpp"
+#include "Drawables/LightCuller.hpp"
 
 namespace Dwarf
 {
@@ -163,7 +164,10 @@ namespace Dwarf
             {
                 SkeletonCharacter::OnDraw(levelRenderer);
 
-                levelRenderer->AddLight(_light);
+                if (Graphics::IsLightInView(GetLevelLayer(), _light))
+                {
+                    levelRenderer->AddLight(_light);
+                }
                 levelRenderer->AddDrawable(_partsys, false);
             }
 
@@ -259,7 +263,7 @@ namespace Dwarf
                 AsA<Character::BasicCharacter>(owner)->StopPointingMainArm();
             }
 
-            for (Item::FlareAttachable* grappleAttachableWeapon : owner->GetWeapons<Item::FlareAttachable>())
+            for (Item::FlareAttachable* grappleAttachableWeapon : Character::GetIndexedWeapons<Item::FlareAttachable>(owner))
             {
                 grappleAttachableWeapon->SetFlareAttached(false);
             }
@@ -283,7 +287,7 @@ namespace Dwarf
 
         static Vector2f getShootPos(Character::Character *owner)
         {
-            std::vector<Item::MuzzleHaver*> muzzleWeapons = owner->GetWeapons<Item::MuzzleHaver>();
+            const std::vector<Item::MuzzleHaver*>& muzzleWeapons = Character::GetIndexedWeapons<Item::MuzzleHaver>(owner);
             if (!muzzleWeapons.empty())
             {
                 return muzzleWeapons.front()->GetMuzzlePosition().Position;
@@ -302,7 +306,7 @@ namespace Dwarf
             Character::Character *owner = GetOwner();
             assert(owner);
 
-            for (Item::FlareAttachable* grappleAttachableWeapon : owner->GetWeapons<Item::FlareAttachable>())
+            for (Item::FlareAttachable* grappleAttachableWeapon : Character::GetIndexedWeapons<Item::FlareAttachable>(owner))
             {
                 grappleAttachableWeapon->SetFlareAttached(true);
             }
@@ -0,0 +1,440 @@
+#include "Audio/ExtendedSoundEmitter.hpp"
+#include "MathUtility.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Dwarf
+{
+    namespace Audio
+    {
+        // Lines are a few dozen segments long, a handful per leaf keeps the tree shallow without scanning much
+        static const uint32_t MaxSegmentsPerLeaf = 4;
+
+        // Each of the two voices of a spread emitter plays the same loop, together they are as loud as one
+        static const float SpreadVoiceVolume = 0.5f;
+
+        // Voices start at the max distance but are only stopped a little past it, so a listener hovering around the edge
+        // does not start and stop the loop every frame. The voices are already silent out there.
+        static const float VoiceStopDistanceScale = 1.1f;
+
+        static float getSquaredDistance(const Rectanglef& bounds, const Vector2f& point)
+        {
+            const float dx = Max(Max(bounds.Left() - point.X, point.X - bounds.Right()), 0.0f);
+            const float dy = Max(Max(bounds.Top() - point.Y, point.Y - bounds.Bottom()), 0.0f);
+            return (dx * dx) + (dy * dy);
+        }
+
+        static Rectanglef getSegmentBounds(const Vector2f& a, const Vector2f& b)
+        {
+            const Vector2f minimum(Min(a.X, b.X), Min(a.Y, b.Y));
+            const Vector2f maximum(Max(a.X, b.X), Max(a.Y, b.Y));
+            return Rectanglef(minimum, maximum - minimum);
+        }
+
+        ExtendedSoundEmitter::ExtendedSoundEmitter(SoundManager* manager, const Sound* sound, const std::vector<Vector2f>& points, bool closed,
+                                                   float minDistance, float maxDistance)
+            : _soundManager(manager)
+            , _sound(sound)
+            , _segments()
+            , _nodes()
+            , _closed(closed)
+
+            , _minDist(minDistance)
+            , _maxDist(maxDistance)
+
+            , _playing(false)
+            , _timer(0.0f)
+            , _rampUpTime(0.0f)
+            , _volume(1.0f)
+            , _spread(0.0f)
+        {
+            assert(points.size() >= 2);
+
+            for (uint32_t i = 0; i + 1 < points.size(); i++)
+            {
+                _segments.push_back({ points[i], points[i + 1] });
+            }
+            if (_closed && points.size() > 2)
+            {
+                _segments.push_back({ points.back(), points.front() });
+            }
+
+            _nodes.reserve(_segments.size());
+            buildNode(0, static_cast<uint32_t>(_segments.size()));
+        }
+
+        ExtendedSoundEmitter::~ExtendedSoundEmitter()
+        {
+            stopVoices(0.0f);
+        }
+
+        void ExtendedSoundEmitter::Play(float rampUpTime)
+        {
+            _timer = 0.0f;
+            _rampUpTime = rampUpTime;
+            _playing = true;
+        }
+
+        void ExtendedSoundEmitter::Stop(float fadeTime)
+        {
+            _playing = false;
+            stopVoices(fadeTime);
+        }
+
+        bool ExtendedSoundEmitter::IsPlaying() const
+        {
+            return _playing;
+        }
+
+        void ExtendedSoundEmitter::SetVolume(float volume)
+        {
+            _volume = volume;
+        }
+
+        float ExtendedSoundEmitter::GetVolume() const
+        {
+            return _volume;
+        }
+
+        void ExtendedSoundEmitter::SetStereoSpread(float radius)
+        {
+            _spread = Max(radius, 0.0f);
+        }
+
+        float ExtendedSoundEmitter::GetStereoSpread() const
+        {
+            return _spread;
+        }
+
+        bool ExtendedSoundEmitter::IsVirtual() const
+        {
+            return _voices[0] == nullptr;
+        }
+
+        const Rectanglef& ExtendedSoundEmitter::GetBounds() const
+        {
+            return _nodes[0].bounds;
+        }
+
+        void ExtendedSoundEmitter::Update(float dt, const Vector2f& listener)
+        {
+            if (!_playing)
+            {
+                return;
+            }
+
+            _timer += dt;
+            const float volume = _volume * (_rampUpTime > 0.0f ? Clamp(_timer / _rampUpTime, 0.0f, 1.0f) : 1.0f);
+
+            // Out of earshot of the whole shape, nothing left to query or to play
+            const float cutoffDist = IsVirtual() ? _maxDist : _maxDist * VoiceStopDistanceScale;
+            const float maxDistSquared = cutoffDist * cutoffDist;
+            if (getSquaredDistance(GetBounds(), listener) > maxDistSquared)
+            {
+                stopVoices(0.0f);
+                return;
+            }
+
+            Vector2f closestPoint = listener;
+            float closestDistSquared = 0.0f;
+            if (!isInsideArea(listener))
+            {
+                closestDistSquared = findClosestPoint(listener, closestPoint);
+            }
+
+            if (closestDistSquared > maxDistSquared)
+            {
+                stopVoices(0.0f);
+                return;
+            }
+
+            updateVoices(listener, closestPoint, std::sqrt(closestDistSquared), volume);
+        }
+
+        uint32_t ExtendedSoundEmitter::buildNode(uint32_t first, uint32_t count)
+        {
+            const uint32_t index = static_cast<uint32_t>(_nodes.size());
+            _nodes.push_back(node());
+
+            Rectanglef bounds = getSegmentBounds(_segments[first].a, _segments[first].b);
+            for (uint32_t i = first + 1; i < first + count; i++)
+            {
+                bounds = Rectanglef::Merge(bounds, getSegmentBounds(_segments[i].a, _segments[i].b));
+            }
+
+            _nodes[index].bounds = bounds;
+            _nodes[index].first = first;
+            _nodes[index].count = count;
+            _nodes[index].right = 0;
+
+            if (count <= MaxSegmentsPerLeaf)
+            {
+                return index;
+            }
+
+            // Split at the median segment along the longer side, the left child directly follows its parent
+            const bool splitX = bounds.W >= bounds.H;
+            const uint32_t half = count / 2;
+            std::nth_element(_segments.begin() + first, _segments.begin() + first + half, _segments.begin() + first + count,
+                [splitX](const segment& lhs, const segment& rhs)
+            {
+                return splitX ? (lhs.a.X + lhs.b.X) < (rhs.a.X + rhs.b.X) : (lhs.a.Y + lhs.b.Y) < (rhs.a.Y + rhs.b.Y);
+            });
+
+            _nodes[index].count = 0;
+            buildNode(first, half);
+            _nodes[index].right = buildNode(first + half, count - half);
+
+            return index;
+        }
+
+        float ExtendedSoundEmitter::findClosestPoint(const Vector2f& listener, Vector2f& closestPoint) const
+        {
+            float closestDist = std::numeric_limits<float>::max();
+            closestPoint = _segments[0].a;
+
+            uint32_t stack[64];
+            uint32_t stackSize = 0;
+            stack[stackSize++] = 0;
+            while (stackSize > 0)
+            {
+                const uint32_t index = stack[--stackSize];
+                const node& current = _nodes[index];
+                if (getSquaredDistance(current.bounds, listener) >= closestDist)
+                {
+                    continue;
+                }
+
+                if (current.count > 0)
+                {
+                    for (uint32_t i = current.first; i < current.first + current.count; i++)
+                    {
+                        Vector2f pt;
+                        float dist = Math::PointToLineDistanceSquared(_segments[i].a, _segments[i].b, listener, pt);
+                        if (dist < closestDist)
+                        {
+                            closestDist = dist;
+                            closestPoint = pt;
+                        }
+                    }
+                }
+                else
+                {
+                    // Nearer child on top so that the farther one is more likely to be pruned
+                    const uint32_t left = index + 1;
+                    const uint32_t right = current.right;
+                    const bool leftNearer = getSquaredDistance(_nodes[left].bounds, listener) <= getSquaredDistance(_nodes[right].bounds, listener);
+                    stack[stackSize++] = leftNearer ? right : left;
+                    stack[stackSize++] = leftNearer ? left : right;
+                }
+            }
+
+            return closestDist;
+        }
+
+        bool ExtendedSoundEmitter::isInsideArea(const Vector2f& listener) const
+        {
+            if (!_closed || !Rectanglef::Contains(GetBounds(), listener))
+            {
+                return false;
+            }
+
+            bool inside = false;
+            for (const segment& edge : _segments)
+            {
+                if ((edge.a.Y > listener.Y) != (edge.b.Y > listener.Y))
+                {
+                    const float crossingX = edge.a.X + (listener.Y - edge.a.Y) * (edge.b.X - edge.a.X) / (edge.b.Y - edge.a.Y);
+                    if (listener.X < crossingX)
+                    {
+                        inside = !inside;
+                    }
+                }
+            }
+            return inside;
+        }
+
+        void ExtendedSoundEmitter::findSpreadDirections(const Vector2f& listener, float radius, Vector2f& leftDirection, Vector2f& rightDirection) const
+        {
+            const float radiusSquared = radius * radius;
+
+            uint32_t stack[64];
+            uint32_t stackSize = 0;
+            stack[stackSize++] = 0;
+            while (stackSize > 0)
+            {
+                const uint32_t index = stack[--stackSize];
+                const node& current = _nodes[index];
+                if (getSquaredDistance(current.bounds, listener) > radiusSquared)
+                {
+                    continue;
+                }
+
+                if (current.count == 0)
+                {
+                    stack[stackSize++] = index + 1;
+                    stack[stackSize++] = current.right;
+                    continue;
+                }
+
+                for (uint32_t i = current.first; i < current.first + current.count; i++)
+                {
+                    // Clip the segment to the circle around the listener
+                    const Vector2f ab = _segments[i].b - _segments[i].a;
+                    const Vector2f al = _segments[i].a - listener;
+                    const float a = Vector2f::Dot(ab, ab);
+                    const float b = 2.0f * Vector2f::Dot(al, ab);
+                    const float c = Vector2f::Dot(al, al) - radiusSquared;
+                    const float discriminant = (b * b) - (4.0f * a * c);
+                    if (a <= 0.0f || discriminant < 0.0f)
+                    {
+                        continue;
+                    }
+
+                    const float root = std::sqrt(discriminant);
+                    const float t0 = Max((-b - root) / (2.0f * a), 0.0f);
+                    const float t1 = Min((-b + root) / (2.0f * a), 1.0f);
+                    if (t0 > t1)
+                    {
+                        continue;
+                    }
+
+                    const Vector2f ends[2] = { _segments[i].a + ab * t0, _segments[i].a + ab * t1 };
+                    for (const Vector2f& end : ends)
+                    {
+                        const Vector2f offset = end - listener;
+                        const float length = offset.Length();
+                        if (length <= 0.0f)
+                        {
+                            continue;
+                        }
+
+                        const Vector2f direction = offset / length;
+                        if (direction.X < leftDirection.X)
+                        {
+                            leftDirection = direction;
+                        }
+                        if (direction.X > rightDirection.X)
+                        {
+                            rightDirection = direction;
+                        }
+                    }
+                }
+            }
+        }
+
+        void ExtendedSoundEmitter::updateVoices(const Vector2f& listener, const Vector2f& closestPoint, float closestDistance, float volume)
+        {
+            const bool spread = _spread > 0.0f;
+            const uint32_t voiceCount = spread ? 2 : 1;
+            for (uint32_t i = 0; i < voiceCount; i++)
+            {
+                if (_voices[i] == nullptr)
+                {
+                    _voices[i] = _soundManager->PlayLoopingPositionalSound(_sound, SoundPriority::High, closestPoint, _minDist, _maxDist, 0.0f);
+                }
+            }
+            if (!spread && _voices[1] != nullptr)
+            {
+                _voices[1]->Stop(0.0f);
+                _voices[1] = nullptr;
+            }
+
+            if (!spread)
+            {
+                _voices[0]->SetVolume(volume);
+                _voices[0]->SetPosition(closestPoint);
+                return;
+            }
+
+            // Both voices stay at the distance of the closest point so the spread only changes the panning. From inside
+            // an area, or right on the line, the listener is surrounded and the voices are pushed fully to either side.
+            Vector2f leftDirection = closestDistance > 0.0f ? (closestPoint - listener) / closestDistance : -Vector2f::UnitX;
+            Vector2f rightDirection = closestDistance > 0.0f ? leftDirection : Vector2f::UnitX;
+            if (closestDistance < _spread)
+            {
+                findSpreadDirections(listener, _spread, leftDirection, rightDirection);
+            }
+
+            const float voiceDistance = Max(closestDistance, _minDist);
+            _voices[0]->SetVolume(volume * SpreadVoiceVolume);
+            _voices[0]->SetPosition(listener + leftDirection * voiceDistance);
+            _voices[1]->SetVolume(volume * SpreadVoiceVolume);
+            _voices[1]->SetPosition(listener + rightDirection * voiceDistance);
+        }
+
+        void ExtendedSoundEmitter::stopVoices(float fadeTime)
+        {
+            for (auto& voice : _voices)
+            {
+                if (voice != nullptr)
+                {
+                    voice->Stop(fadeTime);
+                    voice = nullptr;
+                }
+            }
+        }
+
+        SoundEmitterManager::SoundEmitterManager(SoundManager* soundManager)
+            : _soundManager(soundManager)
+            , _emitters()
+            , _virtualCount(0)
+        {
+        }
+
+        std::shared_ptr<ExtendedSoundEmitter> SoundEmitterManager::AddLineEmitter(const Sound* sound, const Chainf& path, float minDistance, float maxDistance)
+        {
+            std::vector<Vector2f> points;
+            for (uint32_t i = 0; i < path.Size(); i++)
+            {
+                points.push_back(path[i]);
+            }
+
+            auto emitter = std::make_shared<ExtendedSoundEmitter>(_soundManager, sound, points, false, minDistance, maxDistance);
+            _emitters.push_back(emitter);
+            return emitter;
+        }
+
+        std::shared_ptr<ExtendedSoundEmitter> SoundEmitterManager::AddAreaEmitter(const Sound* sound, const Polygonf& area, float minDistance, float maxDistance)
+        {
+            auto emitter = std::make_shared<ExtendedSoundEmitter>(_soundManager, sound, area.Points(), true, minDistance, maxDistance);
+            _emitters.push_back(emitter);
+            return emitter;
+        }
+
+        void SoundEmitterManager::Update(double totalTime, float dt, const Camera& camera)
+        {
+            PROFILE_ZONE("SoundEmitterManager::Update");
+
+            const Vector2f& listener = camera.GetPosition();
+
+            _virtualCount = 0;
+            for (auto iter = _emitters.begin(); iter != _emitters.end();)
+            {
+                std::shared_ptr<ExtendedSoundEmitter> emitter = iter->lock();
+                if (emitter == nullptr)
+                {
+                    iter = _emitters.erase(iter);
+                    continue;
+                }
+
+                emitter->Update(dt, listener);
+                _virtualCount += emitter->IsVirtual() ? 1 : 0;
+                iter++;
+            }
+        }
+
+        uint32_t SoundEmitterManager::GetEmitterCount() const
+        {
+            return static_cast<uint32_t>(_emitters.size());
+        }
+
+        uint32_t SoundEmitterManager::GetVirtualEmitterCount() const
+        {
+            return _virtualCount;
+        }
+    }
+}
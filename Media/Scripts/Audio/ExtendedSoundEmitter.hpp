@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Audio/SoundManager.hpp"
+#include "Camera.hpp"
+#include "Geometry/Chain.hpp"
+#include "Geometry/Polygon.hpp"
+#include "Geometry/Rectangle.hpp"
+#include "NonCopyable.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Audio
+    {
+        // A looping sound spread along a line (lava, a waterfall, wind in a shaft) or over an area (rain). The voice
+        // follows the point of the shape closest to the listener, found through a small bounding volume hierarchy over
+        // the shape's segments. With a stereo spread the sound is played by two voices at the ends of the part of the
+        // shape around the listener instead. Emitters out of earshot are virtual: they hold no voices and skip the
+        // closest point query until the listener comes back in range.
+        class ExtendedSoundEmitter : public NonCopyable
+        {
+        public:
+            ExtendedSoundEmitter(SoundManager* manager, const Sound* sound, const std::vector<Vector2f>& points, bool closed,
+                                 float minDistance, float maxDistance);
+            ~ExtendedSoundEmitter();
+
+            void Play(float rampUpTime);
+            void Stop(float fadeTime);
+            bool IsPlaying() const;
+
+            void SetVolume(float volume);
+            float GetVolume() const;
+
+            // Radius around the listener that the spread covers, zero plays a single voice at the closest point
+            void SetStereoSpread(float radius);
+            float GetStereoSpread() const;
+
+            bool IsVirtual() const;
+
+            const Rectanglef& GetBounds() const;
+
+            void Update(float dt, const Vector2f& listener);
+
+        private:
+            struct segment
+            {
+                Vector2f a;
+                Vector2f b;
+            };
+
+            struct node
+            {
+                Rectanglef bounds;
+                uint32_t first;
+                uint32_t count;
+                uint32_t right;
+            };
+
+            uint32_t buildNode(uint32_t first, uint32_t count);
+
+            // Squared distance from listener to the shape, with the closest point on the shape
+            float findClosestPoint(const Vector2f& listener, Vector2f& closestPoint) const;
+            bool isInsideArea(const Vector2f& listener) const;
+
+            // Horizontal extremes of the shape within radius of the listener, as seen from the listener
+            void findSpreadDirections(const Vector2f& listener, float radius, Vector2f& leftDirection, Vector2f& rightDirection) const;
+
+            void updateVoices(const Vector2f& listener, const Vector2f& closestPoint, float closestDistance, float volume);
+            void stopVoices(float fadeTime);
+
+            SoundManager* _soundManager;
+            const Sound* _sound;
+
+            std::vector<segment> _segments;
+            std::vector<node> _nodes;
+            bool _closed;
+
+            const float _minDist;
+            const float _maxDist;
+
+            bool _playing;
+            float _timer;
+            float _rampUpTime;
+            float _volume;
+            float _spread;
+
+            std::shared_ptr<ManagedSoundInstance> _voices[2];
+        };
+
+        // Updates every emitter of a level in one pass against the same listener
+        class SoundEmitterManager : public NonCopyable
+        {
+        public:
+            SoundEmitterManager(SoundManager* soundManager);
+
+            // Emitters stay registered for as long as the returned pointer is held
+            std::shared_ptr<ExtendedSoundEmitter> AddLineEmitter(const Sound* sound, const Chainf& path, float minDistance, float maxDistance);
+            std::shared_ptr<ExtendedSoundEmitter> AddAreaEmitter(const Sound* sound, const Polygonf& area, float minDistance, float maxDistance);
+
+            void Update(double totalTime, float dt, const Camera& camera);
+
+            uint32_t GetEmitterCount() const;
+            uint32_t GetVirtualEmitterCount() const;
+
+        private:
+            SoundManager* _soundManager;
+            std::vector<std::weak_ptr<ExtendedSoundEmitter>> _emitters;
+            uint32_t _virtualCount;
+        };
+    }
+}
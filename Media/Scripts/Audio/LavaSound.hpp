@@ -4,35 +4,24 @@
 #include "Content/ContentManager.hpp"
 #include "Geometry/Chain.hpp"
 #include "NonCopyable.hpp"
-#include "Camera.hpp"
-#include "Audio/SoundManager.hpp"
+#include "Audio/ExtendedSoundEmitter.hpp"
 
 namespace Dwarf
 {
     namespace Audio
     {
+        // Lava loop along a line, updated with the level's other emitters
         class LavaSound : public NonCopyable
         {
         public:
-            LavaSound(Content::ContentManager* cm, SoundManager* manager, const Chainf& path, float minDistance, float maxDistance);
+            LavaSound(Content::ContentManager* cm, SoundEmitterManager* emitters, const Chainf& path, float minDistance, float maxDistance);
             ~LavaSound();
 
             void Play(float rampUpTime);
 
-            void Update(double totalTime, float dt, const Camera& camera);
-
         private:
-            bool _playing;
-            float _timer;
-            float _totalTime;
-            
-            float _minDist;
-            float _maxDist;
-
-            SoundManager* _soundManager;
             const Sound* _sound;
-            std::shared_ptr<ManagedSoundInstance> _soundInstance;
-            const Chainf _path;
+            std::shared_ptr<ExtendedSoundEmitter> _emitter;
         };
     }
 
@@ -0,0 +1,254 @@
+#include "Audio/SoundEventScheduler.hpp"
+#include "Audio/SoundInstance.hpp"
+#include "Levels/BasicLevel.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace Dwarf
+{
+    namespace Audio
+    {
+        static const uint32_t DefaultVoiceLimits[SoundCategory_Count] =
+        {
+            8, // SoundCategory_Footstep
+            6, // SoundCategory_Attack
+            8, // SoundCategory_Impact
+            6, // SoundCategory_Damage
+            4, // SoundCategory_Explosion
+        };
+
+        // Quick enough not to click, short enough that the new sound is not masked by the old one
+        static const float StolenVoiceFadeTime = 0.05f;
+
+        static uint32_t getPriorityRank(SoundPriority priority)
+        {
+            switch (priority)
+            {
+            case SoundPriority::Low:
+                return 0;
+            case SoundPriority::Medium:
+                return 1;
+            case SoundPriority::High:
+                return 2;
+            default:
+                return 1;
+            }
+        }
+
+        SoundEventScheduler::SoundEventScheduler(SoundManager* soundManager)
+            : _soundManager(soundManager)
+            , _events()
+            , _listener(Vector2f::Zero)
+            , _hasListener(false)
+            , _culled(0)
+            , _coalesced(0)
+            , _stolen(0)
+        {
+            for (uint32_t i = 0; i < SoundCategory_Count; i++)
+            {
+                _voiceLimits[i] = DefaultVoiceLimits[i];
+            }
+        }
+
+        void SoundEventScheduler::SetVoiceLimit(SoundCategory category, uint32_t limit)
+        {
+            _voiceLimits[category] = limit;
+        }
+
+        uint32_t SoundEventScheduler::GetVoiceLimit(SoundCategory category) const
+        {
+            return _voiceLimits[category];
+        }
+
+        void SoundEventScheduler::PlaySinglePositionalSound(SoundCategory category, const Sound* sound, SoundPriority priority, const Vector2f& position,
+                                                            float minDistance, float maxDistance, float volume)
+        {
+            if (sound == nullptr || volume <= 0.0f)
+            {
+                return;
+            }
+
+            // Until the first update there is no listener to cull against
+            if (_hasListener && Vector2f::DistanceSquared(_listener, position) > maxDistance * maxDistance)
+            {
+                _culled++;
+                return;
+            }
+
+            soundEvent newEvent;
+            newEvent.sound = sound;
+            newEvent.category = category;
+            newEvent.priority = priority;
+            newEvent.rank = getPriorityRank(priority);
+            newEvent.position = position;
+            newEvent.minDistance = minDistance;
+            newEvent.maxDistance = maxDistance;
+            newEvent.volume = volume;
+            newEvent.loudness = 0.0f;
+            _events.push_back(newEvent);
+        }
+
+        void SoundEventScheduler::Update(const Camera& camera)
+        {
+            PROFILE_ZONE("SoundEventScheduler::Update");
+
+            _listener = camera.GetPosition();
+            _hasListener = true;
+
+            for (auto& voices : _voices)
+            {
+                voices.erase(std::remove_if(voices.begin(), voices.end(), [](const voice& playing)
+                {
+                    return playing.instance == nullptr || playing.instance->GetStatus() == AudioStatus_Stopped;
+                }), voices.end());
+            }
+
+            if (_events.empty())
+            {
+                return;
+            }
+
+            // Events of the same sound in one frame play as a single voice at the loudest of them, the volumes add up
+            // by power like the voices would have when mixed
+            std::vector<soundEvent> merged;
+            std::vector<float> mergedPower;
+            std::unordered_map<const Sound*, uint32_t> mergedIndices;
+            for (soundEvent& newEvent : _events)
+            {
+                newEvent.loudness = getLoudness(newEvent.position, newEvent.minDistance, newEvent.maxDistance, newEvent.volume);
+                if (newEvent.loudness <= 0.0f)
+                {
+                    _culled++;
+                    continue;
+                }
+
+                auto iter = mergedIndices.find(newEvent.sound);
+                if (iter == mergedIndices.end())
+                {
+                    mergedIndices[newEvent.sound] = static_cast<uint32_t>(merged.size());
+                    merged.push_back(newEvent);
+                    mergedPower.push_back(newEvent.volume * newEvent.volume);
+                    continue;
+                }
+
+                soundEvent& existing = merged[iter->second];
+                mergedPower[iter->second] += newEvent.volume * newEvent.volume;
+                if (newEvent.rank > existing.rank)
+                {
+                    existing.priority = newEvent.priority;
+                    existing.rank = newEvent.rank;
+                }
+                if (newEvent.loudness > existing.loudness)
+                {
+                    existing.position = newEvent.position;
+                    existing.minDistance = newEvent.minDistance;
+                    existing.maxDistance = newEvent.maxDistance;
+                    existing.category = newEvent.category;
+                    existing.loudness = newEvent.loudness;
+                }
+                _coalesced++;
+            }
+            _events.clear();
+
+            for (uint32_t i = 0; i < merged.size(); i++)
+            {
+                merged[i].volume = Min(std::sqrt(mergedPower[i]), 1.0f);
+                merged[i].loudness = getLoudness(merged[i].position, merged[i].minDistance, merged[i].maxDistance, merged[i].volume);
+            }
+
+            // The most important events claim the free voices first
+            std::sort(merged.begin(), merged.end(), [](const soundEvent& a, const soundEvent& b)
+            {
+                return a.rank != b.rank ? a.rank > b.rank : a.loudness > b.loudness;
+            });
+
+            for (const soundEvent& nextEvent : merged)
+            {
+                if (!reserveVoice(nextEvent))
+                {
+                    continue;
+                }
+
+                voice newVoice;
+                newVoice.instance = _soundManager->PlaySinglePositionalSound(nextEvent.sound, nextEvent.priority, nextEvent.position,
+                                                                             nextEvent.minDistance, nextEvent.maxDistance, nextEvent.volume);
+                newVoice.rank = nextEvent.rank;
+                newVoice.loudness = nextEvent.loudness;
+                if (newVoice.instance != nullptr)
+                {
+                    _voices[nextEvent.category].push_back(newVoice);
+                }
+            }
+        }
+
+        uint32_t SoundEventScheduler::GetCulledCount() const
+        {
+            return _culled;
+        }
+
+        uint32_t SoundEventScheduler::GetCoalescedCount() const
+        {
+            return _coalesced;
+        }
+
+        uint32_t SoundEventScheduler::GetStolenCount() const
+        {
+            return _stolen;
+        }
+
+        float SoundEventScheduler::getLoudness(const Vector2f& position, float minDistance, float maxDistance, float volume) const
+        {
+            const float distance = Vector2f::Distance(_listener, position);
+            if (distance >= maxDistance)
+            {
+                return 0.0f;
+            }
+
+            const float range = maxDistance - minDistance;
+            const float attenuation = range > 0.0f ? 1.0f - Saturate((distance - minDistance) / range) : 1.0f;
+            return volume * attenuation;
+        }
+
+        bool SoundEventScheduler::reserveVoice(const soundEvent& newEvent)
+        {
+            std::vector<voice>& voices = _voices[newEvent.category];
+            if (voices.size() < _voiceLimits[newEvent.category])
+            {
+                return true;
+            }
+
+            // Lowest priority first, and the quietest of those
+            auto victim = std::min_element(voices.begin(), voices.end(), [](const voice& a, const voice& b)
+            {
+                return a.rank != b.rank ? a.rank < b.rank : a.loudness < b.loudness;
+            });
+            if (victim == voices.end() || victim->rank > newEvent.rank ||
+                (victim->rank == newEvent.rank && victim->loudness >= newEvent.loudness))
+            {
+                return false;
+            }
+
+            victim->instance->Stop(StolenVoiceFadeTime);
+            voices.erase(victim);
+            _stolen++;
+            return true;
+        }
+
+        void PlaySoundEvent(Level::LevelInstance* level, SoundCategory category, const Sound* sound, SoundPriority priority, const Vector2f& position,
+                            float minDistance, float maxDistance, float volume)
+        {
+            Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(level);
+            if (basicLevel)
+            {
+                basicLevel->GetSoundEventScheduler().PlaySinglePositionalSound(category, sound, priority, position, minDistance, maxDistance, volume);
+            }
+            else
+            {
+                level->GetSoundManager()->PlaySinglePositionalSound(sound, priority, position, minDistance, maxDistance, volume);
+            }
+        }
+    }
+}
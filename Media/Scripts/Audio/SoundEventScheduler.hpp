@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Audio/SoundManager.hpp"
+#include "Camera.hpp"
+#include "Level/LevelTypes.hpp"
+#include "NonCopyable.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Audio
+    {
+        enum SoundCategory
+        {
+            SoundCategory_Footstep,
+            SoundCategory_Attack,
+            SoundCategory_Impact,
+            SoundCategory_Damage,
+            SoundCategory_Explosion,
+
+            SoundCategory_Count,
+        };
+
+        // Sits in front of the sound manager for the positional one shots that big fights trigger by the dozen. Events
+        // out of the listener's earshot are dropped as they come in, the rest wait for the end of the frame where the
+        // events of the same sound are merged into one louder voice. Each category then plays at most a fixed number of
+        // voices at a time, a new event takes over the least important playing voice or is dropped.
+        class SoundEventScheduler : public NonCopyable
+        {
+        public:
+            SoundEventScheduler(SoundManager* soundManager);
+
+            void SetVoiceLimit(SoundCategory category, uint32_t limit);
+            uint32_t GetVoiceLimit(SoundCategory category) const;
+
+            void PlaySinglePositionalSound(SoundCategory category, const Sound* sound, SoundPriority priority, const Vector2f& position,
+                                           float minDistance, float maxDistance, float volume);
+
+            // Plays the events queued since the previous call, heard from the camera
+            void Update(const Camera& camera);
+
+            uint32_t GetCulledCount() const;
+            uint32_t GetCoalescedCount() const;
+            uint32_t GetStolenCount() const;
+
+        private:
+            struct soundEvent
+            {
+                const Sound* sound;
+                SoundCategory category;
+                SoundPriority priority;
+                uint32_t rank;
+                Vector2f position;
+                float minDistance;
+                float maxDistance;
+                float volume;
+                float loudness;
+            };
+
+            struct voice
+            {
+                std::shared_ptr<ManagedSoundInstance> instance;
+                uint32_t rank;
+                float loudness;
+            };
+
+            float getLoudness(const Vector2f& position, float minDistance, float maxDistance, float volume) const;
+            bool reserveVoice(const soundEvent& newEvent);
+
+            SoundManager* _soundManager;
+
+            std::vector<soundEvent> _events;
+            std::vector<voice> _voices[SoundCategory_Count];
+            uint32_t _voiceLimits[SoundCategory_Count];
+
+            Vector2f _listener;
+            bool _hasListener;
+
+            uint32_t _culled;
+            uint32_t _coalesced;
+            uint32_t _stolen;
+        };
+
+        // Scheduled by the level's scheduler when it has one, played straight away otherwise
+        void PlaySoundEvent(Level::LevelInstance* level, SoundCategory category, const Sound* sound, SoundPriority priority, const Vector2f& position,
+                            float minDistance, float maxDistance, float volume);
+    }
+}
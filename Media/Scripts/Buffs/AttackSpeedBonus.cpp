@@ -8,12 +8,42 @@ namespace Dwarf
         AttackSpeedBonus::AttackSpeedBonus(const BuffComponentParameters& parameters, float ammount)
             : BuffComponent(parameters)
             , _ammount(ammount)
+            , _modifier(InvalidStatusEffectHandle)
         {
         }
 
+        void AttackSpeedBonus::OnApply()
+        {
+            BuffComponent::OnApply();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                _modifier = statusEffects->AddStatModifier(GetOwner(), StatModifierType_AttackSpeed, _ammount);
+            }
+        }
+
+        void AttackSpeedBonus::OnFinish()
+        {
+            BuffComponent::OnFinish();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                statusEffects->RemoveEffect(_modifier);
+                _modifier = InvalidStatusEffectHandle;
+            }
+        }
+
         void AttackSpeedBonus::OnUpdate(double totalTime, float dt)
         {
-            GetOwner()->AddAttackSpeedMultiplier(_ammount);
+            BuffComponent::OnUpdate(totalTime, dt);
+
+            // Without a level status effect manager the modifier is added every frame, the engine resets it
+            if (!GetStatusEffects())
+            {
+                GetOwner()->AddAttackSpeedMultiplier(_ammount);
+            }
         }
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Buffs/BasicBuff.hpp"
+#include "Buffs/StatusEffectManager.hpp"
 
 namespace Dwarf
 {
@@ -12,10 +13,14 @@ namespace Dwarf
             AttackSpeedBonus(const BuffComponentParameters& parameters, float ammount);
 
         protected:
+            void OnApply() override;
+            void OnFinish() override;
             void OnUpdate(double totalTime, float dt) override;
 
         private:
             const float _ammount;
+
+            StatusEffectHandle _modifier;
         };
     }
 
@@ -1,5 +1,6 @@
 #include "Buffs/BasicBuff.hpp"
 #include "HUD/Tooltip.hpp"
+#include "Levels/BasicLevel.hpp"
 
 namespace Dwarf
 {
@@ -7,6 +8,7 @@ namespace Dwarf
     {
         BuffComponent::BuffComponent(const BuffComponentParameters& parameters)
             : _owner(parameters.owner)
+            , _statusEffects(parameters.statusEffects)
         {
         }
 
@@ -44,6 +46,11 @@ namespace Dwarf
             return _owner;
         }
 
+        StatusEffectManager* BuffComponent::GetStatusEffects() const
+        {
+            return _statusEffects;
+        }
+
         static std::string GetBuffName(Character* owner, const std::string& nameCode)
         {
             assert(owner);
@@ -53,6 +60,11 @@ namespace Dwarf
         BasicBuff::BasicBuff(const BuffParameters& parameters, const std::string& nameCode)
             : Buff(parameters, GetBuffName(parameters.owner, nameCode))
         {
+            Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(parameters.owner->GetLevel());
+            if (basicLevel)
+            {
+                _statusEffects = &basicLevel->GetStatusEffectManager();
+            }
         }
 
         float BasicBuff::GetTotalDuration() const
@@ -12,9 +12,12 @@ namespace Dwarf
 
     namespace Character
     {
+        class StatusEffectManager;
+
         struct BuffComponentParameters
         {
             Character* owner;
+            StatusEffectManager* statusEffects;
         };
 
         class BuffComponent
@@ -33,9 +36,11 @@ namespace Dwarf
 
         protected:
             Character* GetOwner() const;
+            StatusEffectManager* GetStatusEffects() const;
 
         private:
             Character* _owner;
+            StatusEffectManager* _statusEffects;
         };
 
         class BasicBuff : public Buff
@@ -87,6 +92,7 @@ namespace Dwarf
             HUD::PanelDrawable* _iconDrawable = nullptr;
             HUD::Panel* _tooltip = nullptr;
 
+            StatusEffectManager* _statusEffects = nullptr;
             std::vector<BuffComponent*> _components;
         };
 
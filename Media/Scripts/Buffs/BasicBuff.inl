@@ -7,6 +7,7 @@ namespace Dwarf
         {
             BuffComponentParameters params;
             params.owner = GetOwner();
+            params.statusEffects = _statusEffects;
 
             T* component = new T(params, std::forward<argsT>(args)...);
             _components.push_back(component);
@@ -9,13 +9,47 @@ namespace Dwarf
             : BuffComponent(parameters)
             , _chance(critChance)
             , _dmg(critDmg)
+            , _chanceModifier(InvalidStatusEffectHandle)
+            , _dmgModifier(InvalidStatusEffectHandle)
         {
         }
 
+        void CritChanceBonus::OnApply()
+        {
+            BuffComponent::OnApply();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                _chanceModifier = statusEffects->AddStatModifier(GetOwner(), StatModifierType_CriticalChance, _chance);
+                _dmgModifier = statusEffects->AddStatModifier(GetOwner(), StatModifierType_CriticalDamage, _dmg);
+            }
+        }
+
+        void CritChanceBonus::OnFinish()
+        {
+            BuffComponent::OnFinish();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                statusEffects->RemoveEffect(_chanceModifier);
+                statusEffects->RemoveEffect(_dmgModifier);
+                _chanceModifier = InvalidStatusEffectHandle;
+                _dmgModifier = InvalidStatusEffectHandle;
+            }
+        }
+
         void CritChanceBonus::OnUpdate(double totalTime, float dt)
         {
-            GetOwner()->AddCriticalChance(_chance);
-            GetOwner()->AddCriticalDamage(_dmg);
+            BuffComponent::OnUpdate(totalTime, dt);
+
+            // Without a level status effect manager the modifiers are added every frame, the engine resets them
+            if (!GetStatusEffects())
+            {
+                GetOwner()->AddCriticalChance(_chance);
+                GetOwner()->AddCriticalDamage(_dmg);
+            }
         }
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Buffs/BasicBuff.hpp"
+#include "Buffs/StatusEffectManager.hpp"
 
 namespace Dwarf
 {
@@ -12,11 +13,16 @@ namespace Dwarf
             CritChanceBonus(const BuffComponentParameters& parameters, float critChance, float critDmg);
 
         protected:
+            void OnApply() override;
+            void OnFinish() override;
             void OnUpdate(double totalTime, float dt) override;
 
         private:
             const float _chance;
             const float _dmg;
+
+            StatusEffectHandle _chanceModifier;
+            StatusEffectHandle _dmgModifier;
         };
     }
 
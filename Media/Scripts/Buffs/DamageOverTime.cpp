@@ -11,14 +11,33 @@ namespace Dwarf
             , _source(source)
             , _dps(dps)
             , _tickRate(tickRate)
+            , _effect(InvalidStatusEffectHandle)
             , _timer(tickRate)
         {
         }
 
+        void DamageOverTime::OnApply()
+        {
+            BuffComponent::OnApply();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                _effect = statusEffects->AddDamageOverTime(GetOwner(), _source, _dps, _tickRate);
+            }
+        }
+
         void DamageOverTime::OnFinish()
         {
             BuffComponent::OnFinish();
 
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                statusEffects->RemoveEffect(_effect);
+                _effect = InvalidStatusEffectHandle;
+            }
+
             _finished = true;
         }
 
@@ -26,7 +45,7 @@ namespace Dwarf
         {
             BuffComponent::OnUpdate(totalTime, dt);
 
-            if (!_finished)
+            if (!GetStatusEffects() && !_finished)
             {
                 _timer -= dt;
                 while (_timer <= 0.0f)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Buffs/BasicBuff.hpp"
+#include "Buffs/StatusEffectManager.hpp"
 #include "Character/Damage.hpp"
 
 namespace Dwarf
@@ -13,6 +14,7 @@ namespace Dwarf
             DamageOverTime(const BuffComponentParameters& parameters, CharacterID source, const Damage& dps, float tickRate);
 
         protected:
+            void OnApply() override;
             void OnFinish() override;
             void OnUpdate(double totalTime, float dt) override;
 
@@ -21,8 +23,10 @@ namespace Dwarf
             const float _tickRate;
             const Damage _dps;
 
-            float _timer;
+            StatusEffectHandle _effect;
 
+            // Ticks the damage itself when the level has no status effect manager
+            float _timer;
             bool _finished = false;
         };
     }
@@ -11,22 +11,49 @@ namespace Dwarf
             , _source(source)
             , _healthPerSecond(healthPerSecond)
             , _tickRate(tickRate)
+            , _effect(InvalidStatusEffectHandle)
             , _timer(tickRate)
         {
         }
 
+        void HealOverTime::OnApply()
+        {
+            BuffComponent::OnApply();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                _effect = statusEffects->AddHealOverTime(GetOwner(), _source, _healthPerSecond, _tickRate);
+            }
+        }
+
+        void HealOverTime::OnFinish()
+        {
+            BuffComponent::OnFinish();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                statusEffects->RemoveEffect(_effect);
+                _effect = InvalidStatusEffectHandle;
+            }
+        }
+
         void HealOverTime::OnUpdate(double totalTime, float dt)
         {
             BuffComponent::OnUpdate(totalTime, dt);
 
-            _timer -= dt;
-            while (_timer <= 0.0f)
+            if (!GetStatusEffects())
             {
-                Character* owner = GetOwner();
-                Character* healer = owner->GetLevelLayer()->GetCharacter(_source);
-                owner->Heal(healer, _healthPerSecond * _tickRate);
+                _timer -= dt;
+                while (_timer <= 0.0f)
+                {
+                    Character* owner = GetOwner();
+                    Character* healer = owner->GetLevelLayer()->GetCharacter(_source);
+                    owner->Heal(healer, _healthPerSecond * _tickRate);
 
-                _timer += _tickRate;
+                    _timer += _tickRate;
+                }
             }
         }
     }
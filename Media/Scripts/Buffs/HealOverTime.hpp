@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Buffs/BasicBuff.hpp"
+#include "Buffs/StatusEffectManager.hpp"
 
 namespace Dwarf
 {
@@ -12,6 +13,8 @@ namespace Dwarf
             HealOverTime(const BuffComponentParameters& parameters, CharacterID source, float healthPerSecond, float tickRate);
 
         protected:
+            virtual void OnApply() override;
+            virtual void OnFinish() override;
             virtual void OnUpdate(double totalTime, float dt) override;
 
         private:
@@ -19,6 +22,9 @@ namespace Dwarf
             const float _tickRate;
             const float _healthPerSecond;
 
+            StatusEffectHandle _effect;
+
+            // Ticks the healing itself when the level has no status effect manager
             float _timer;
         };
     }
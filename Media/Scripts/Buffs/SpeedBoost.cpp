@@ -8,15 +8,42 @@ namespace Dwarf
         SpeedBoost::SpeedBoost(const BuffComponentParameters& parameters, float percent)
             : BuffComponent(parameters)
             , _percent(percent)
+            , _modifier(InvalidStatusEffectHandle)
         {
         }
 
+        void SpeedBoost::OnApply()
+        {
+            BuffComponent::OnApply();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                _modifier = statusEffects->AddStatModifier(GetOwner(), StatModifierType_MoveSpeed, _percent);
+            }
+        }
+
+        void SpeedBoost::OnFinish()
+        {
+            BuffComponent::OnFinish();
+
+            StatusEffectManager* statusEffects = GetStatusEffects();
+            if (statusEffects)
+            {
+                statusEffects->RemoveEffect(_modifier);
+                _modifier = InvalidStatusEffectHandle;
+            }
+        }
+
         void SpeedBoost::OnUpdate(double totalTime, float dt)
         {
             BuffComponent::OnUpdate(totalTime, dt);
 
-            Character* owner = GetOwner();
-            owner->AddMoveSpeedMultiplier(_percent);
+            // Without a level status effect manager the modifier is added every frame, the engine resets it
+            if (!GetStatusEffects())
+            {
+                GetOwner()->AddMoveSpeedMultiplier(_percent);
+            }
         }
     }
 
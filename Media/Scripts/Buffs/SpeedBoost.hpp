@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Buffs/BasicBuff.hpp"
+#include "Buffs/StatusEffectManager.hpp"
 
 namespace Dwarf
 {
@@ -12,10 +13,14 @@ namespace Dwarf
             SpeedBoost(const BuffComponentParameters& parameters, float percent);
 
         protected:
+            virtual void OnApply() override;
+            virtual void OnFinish() override;
             virtual void OnUpdate(double totalTime, float dt) override;
 
         private:
             const float _percent;
+
+            StatusEffectHandle _modifier;
         };
     }
 
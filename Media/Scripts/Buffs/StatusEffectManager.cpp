@@ -0,0 +1,315 @@
+#include "Buffs/StatusEffectManager.hpp"
+#include "Level/LevelLayerInstance.hpp"
+
+#include <algorithm>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        template <typename T>
+        static bool removeEffect(std::vector<T>& pool, StatusEffectHandle handle, CharacterID& owner)
+        {
+            for (uint32_t i = 0; i < pool.size(); i++)
+            {
+                if (pool[i].handle == handle)
+                {
+                    owner = pool[i].owner;
+                    pool[i] = pool.back();
+                    pool.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename T>
+        static void removeOwnerEffects(std::vector<T>& pool, CharacterID owner)
+        {
+            pool.erase(std::remove_if(pool.begin(), pool.end(), [owner](const T& effect) { return effect.owner == owner; }), pool.end());
+        }
+
+        template <typename T>
+        static void gatherOwnerEffects(const std::vector<T>& pool, CharacterID owner, std::vector<StatusEffectHandle>& handles)
+        {
+            for (const auto& effect : pool)
+            {
+                if (effect.owner == owner)
+                {
+                    handles.push_back(effect.handle);
+                }
+            }
+        }
+
+        StatusEffectManager::StatusEffectManager()
+            : _statModifiers()
+            , _statTotals()
+            , _damageOverTime()
+            , _healOverTime()
+            , _pendingTicks()
+            , _deferredRemovals()
+            , _ticking(false)
+            , _nextHandle(InvalidStatusEffectHandle)
+        {
+        }
+
+        StatusEffectHandle StatusEffectManager::AddStatModifier(Character* owner, StatModifierType type, float ammount)
+        {
+            assert(owner);
+            assert(type < StatModifierType_Count);
+
+            statModifier modifier;
+            modifier.handle = nextHandle();
+            modifier.owner = owner->GetID();
+            modifier.type = type;
+            modifier.ammount = ammount;
+            _statModifiers.push_back(modifier);
+
+            rebuildStatTotals(modifier.owner);
+            return modifier.handle;
+        }
+
+        StatusEffectHandle StatusEffectManager::AddDamageOverTime(Character* owner, CharacterID source, const Damage& dps, float tickRate)
+        {
+            assert(owner);
+            assert(tickRate > 0.0f);
+
+            damageOverTime effect { nextHandle(), owner->GetLevelLayer(), owner->GetID(), source, dps, tickRate, tickRate };
+            _damageOverTime.push_back(effect);
+            return effect.handle;
+        }
+
+        StatusEffectHandle StatusEffectManager::AddHealOverTime(Character* owner, CharacterID source, float healthPerSecond, float tickRate)
+        {
+            assert(owner);
+            assert(tickRate > 0.0f);
+
+            healOverTime effect { nextHandle(), owner->GetLevelLayer(), owner->GetID(), source, healthPerSecond, tickRate, tickRate };
+            _healOverTime.push_back(effect);
+            return effect.handle;
+        }
+
+        void StatusEffectManager::RemoveEffect(StatusEffectHandle handle)
+        {
+            if (handle == InvalidStatusEffectHandle)
+            {
+                return;
+            }
+
+            // Ticks reference the pools by index, removals caused by damage or healing wait until they are all applied
+            if (_ticking)
+            {
+                _deferredRemovals.push_back(handle);
+                return;
+            }
+
+            CharacterID owner;
+            if (removeEffect(_statModifiers, handle, owner))
+            {
+                rebuildStatTotals(owner);
+            }
+            else if (!removeEffect(_damageOverTime, handle, owner))
+            {
+                removeEffect(_healOverTime, handle, owner);
+            }
+        }
+
+        void StatusEffectManager::RemoveCharacterEffects(CharacterID owner)
+        {
+            if (_ticking)
+            {
+                gatherOwnerEffects(_statModifiers, owner, _deferredRemovals);
+                gatherOwnerEffects(_damageOverTime, owner, _deferredRemovals);
+                gatherOwnerEffects(_healOverTime, owner, _deferredRemovals);
+                return;
+            }
+
+            removeOwnerEffects(_statModifiers, owner);
+            removeOwnerEffects(_damageOverTime, owner);
+            removeOwnerEffects(_healOverTime, owner);
+            _statTotals.erase(owner);
+        }
+
+        void StatusEffectManager::ApplyStatModifiers(Character* character) const
+        {
+            auto iter = _statTotals.find(character->GetID());
+            if (iter == _statTotals.end())
+            {
+                return;
+            }
+
+            const statTotals& totals = iter->second;
+            if (totals.counts[StatModifierType_MoveSpeed] > 0)
+            {
+                character->AddMoveSpeedMultiplier(totals.values[StatModifierType_MoveSpeed]);
+            }
+            if (totals.counts[StatModifierType_AttackSpeed] > 0)
+            {
+                character->AddAttackSpeedMultiplier(totals.values[StatModifierType_AttackSpeed]);
+            }
+            if (totals.counts[StatModifierType_CriticalChance] > 0)
+            {
+                character->AddCriticalChance(totals.values[StatModifierType_CriticalChance]);
+            }
+            if (totals.counts[StatModifierType_CriticalDamage] > 0)
+            {
+                character->AddCriticalDamage(totals.values[StatModifierType_CriticalDamage]);
+            }
+        }
+
+        uint32_t StatusEffectManager::GetEffectCount() const
+        {
+            return static_cast<uint32_t>(_statModifiers.size() + _damageOverTime.size() + _healOverTime.size());
+        }
+
+        void StatusEffectManager::Update(double totalTime, float dt)
+        {
+            _pendingTicks.clear();
+            for (uint32_t i = 0; i < _damageOverTime.size(); i++)
+            {
+                damageOverTime& effect = _damageOverTime[i];
+                effect.timer -= dt;
+                if (effect.timer <= 0.0f)
+                {
+                    uint32_t count = static_cast<uint32_t>(-effect.timer / effect.tickRate) + 1;
+                    effect.timer += effect.tickRate * count;
+                    _pendingTicks.push_back(pendingTick { effect.owner, true, i, count });
+                }
+            }
+            for (uint32_t i = 0; i < _healOverTime.size(); i++)
+            {
+                healOverTime& effect = _healOverTime[i];
+                effect.timer -= dt;
+                if (effect.timer <= 0.0f)
+                {
+                    uint32_t count = static_cast<uint32_t>(-effect.timer / effect.tickRate) + 1;
+                    effect.timer += effect.tickRate * count;
+                    _pendingTicks.push_back(pendingTick { effect.owner, false, i, count });
+                }
+            }
+
+            if (_pendingTicks.empty())
+            {
+                return;
+            }
+
+            // Group ticks by target so each one is looked up once, stable to keep the order effects were applied in
+            std::stable_sort(_pendingTicks.begin(), _pendingTicks.end(), [](const pendingTick& a, const pendingTick& b)
+            {
+                return a.owner < b.owner;
+            });
+
+            _deferredRemovals.clear();
+            _ticking = true;
+
+            Character* owner = nullptr;
+            for (uint32_t i = 0; i < _pendingTicks.size(); i++)
+            {
+                const pendingTick& tick = _pendingTicks[i];
+                Level::LevelLayerInstance* layer = tick.isDamage ? _damageOverTime[tick.index].layer : _healOverTime[tick.index].layer;
+                if (i == 0 || tick.owner != _pendingTicks[i - 1].owner)
+                {
+                    owner = layer->GetCharacter(tick.owner);
+                }
+
+                if (tick.isDamage)
+                {
+                    // Copied, damage and healing callbacks can add effects and grow the pools
+                    const damageOverTime effect = _damageOverTime[tick.index];
+                    if (!owner)
+                    {
+                        // Targets that have left the level can no longer finish their buffs
+                        _deferredRemovals.push_back(effect.handle);
+                        continue;
+                    }
+                    if (isRemovalDeferred(effect.handle))
+                    {
+                        continue;
+                    }
+
+                    Character* inflicter = layer->GetCharacter(effect.source);
+                    for (uint32_t j = 0; j < tick.count; j++)
+                    {
+                        owner->ApplyDamage(inflicter, owner->GetBounds().Middle(), effect.dps * effect.tickRate);
+                    }
+                }
+                else
+                {
+                    const healOverTime effect = _healOverTime[tick.index];
+                    if (!owner)
+                    {
+                        _deferredRemovals.push_back(effect.handle);
+                        continue;
+                    }
+                    if (isRemovalDeferred(effect.handle))
+                    {
+                        continue;
+                    }
+
+                    Character* healer = layer->GetCharacter(effect.source);
+                    for (uint32_t j = 0; j < tick.count; j++)
+                    {
+                        owner->Heal(healer, effect.healthPerSecond * effect.tickRate);
+                    }
+                }
+            }
+
+            _ticking = false;
+            for (auto handle : _deferredRemovals)
+            {
+                RemoveEffect(handle);
+            }
+            _deferredRemovals.clear();
+        }
+
+        StatusEffectHandle StatusEffectManager::nextHandle()
+        {
+            return ++_nextHandle;
+        }
+
+        bool StatusEffectManager::isRemovalDeferred(StatusEffectHandle handle) const
+        {
+            return std::find(_deferredRemovals.begin(), _deferredRemovals.end(), handle) != _deferredRemovals.end();
+        }
+
+        void StatusEffectManager::rebuildStatTotals(CharacterID owner)
+        {
+            statTotals totals;
+            for (uint32_t i = 0; i < StatModifierType_Count; i++)
+            {
+                // Speed multipliers stack multiplicatively, critical bonuses additively
+                totals.values[i] = (i == StatModifierType_MoveSpeed || i == StatModifierType_AttackSpeed) ? 1.0f : 0.0f;
+                totals.counts[i] = 0;
+            }
+
+            bool hasModifiers = false;
+            for (const auto& modifier : _statModifiers)
+            {
+                if (modifier.owner != owner)
+                {
+                    continue;
+                }
+
+                if (modifier.type == StatModifierType_MoveSpeed || modifier.type == StatModifierType_AttackSpeed)
+                {
+                    totals.values[modifier.type] *= modifier.ammount;
+                }
+                else
+                {
+                    totals.values[modifier.type] += modifier.ammount;
+                }
+                totals.counts[modifier.type]++;
+                hasModifiers = true;
+            }
+
+            if (hasModifiers)
+            {
+                _statTotals[owner] = totals;
+            }
+            else
+            {
+                _statTotals.erase(owner);
+            }
+        }
+    }
+}
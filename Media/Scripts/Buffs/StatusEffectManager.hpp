@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Character/Character.hpp"
+#include "Character/Damage.hpp"
+#include "NonCopyable.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        class LevelLayerInstance;
+    }
+
+    namespace Character
+    {
+        enum StatModifierType
+        {
+            StatModifierType_MoveSpeed,
+            StatModifierType_AttackSpeed,
+            StatModifierType_CriticalChance,
+            StatModifierType_CriticalDamage,
+
+            StatModifierType_Count,
+        };
+
+        typedef uint32_t StatusEffectHandle;
+        static const StatusEffectHandle InvalidStatusEffectHandle = 0;
+
+        // Level wide storage for buff effects that don't need per-instance behaviour. Stat modifiers are folded into a
+        // cached total per character that is only rebuilt when a modifier is added or removed, and periodic damage and
+        // healing are ticked together once per frame, grouped by target. Buff components on levels that are not a
+        // BasicLevel have no manager and apply their effects themselves every frame.
+        class StatusEffectManager : public NonCopyable
+        {
+        public:
+            StatusEffectManager();
+
+            StatusEffectHandle AddStatModifier(Character* owner, StatModifierType type, float ammount);
+            StatusEffectHandle AddDamageOverTime(Character* owner, CharacterID source, const Damage& dps, float tickRate);
+            StatusEffectHandle AddHealOverTime(Character* owner, CharacterID source, float healthPerSecond, float tickRate);
+            void RemoveEffect(StatusEffectHandle handle);
+
+            // Drops every effect on a character that is leaving the level, its buffs may never reach OnFinish
+            void RemoveCharacterEffects(CharacterID owner);
+
+            // Pushes the cached stat totals into the character's per-frame multipliers
+            void ApplyStatModifiers(Character* character) const;
+
+            uint32_t GetEffectCount() const;
+
+            void Update(double totalTime, float dt);
+
+        private:
+            StatusEffectHandle nextHandle();
+            bool isRemovalDeferred(StatusEffectHandle handle) const;
+            void rebuildStatTotals(CharacterID owner);
+
+            struct statModifier
+            {
+                StatusEffectHandle handle;
+                CharacterID owner;
+                StatModifierType type;
+                float ammount;
+            };
+            std::vector<statModifier> _statModifiers;
+
+            struct statTotals
+            {
+                float values[StatModifierType_Count];
+                uint32_t counts[StatModifierType_Count];
+            };
+            std::unordered_map<CharacterID, statTotals> _statTotals;
+
+            struct damageOverTime
+            {
+                StatusEffectHandle handle;
+                Level::LevelLayerInstance* layer;
+                CharacterID owner;
+                CharacterID source;
+                Damage dps;
+                float tickRate;
+                float timer;
+            };
+            std::vector<damageOverTime> _damageOverTime;
+
+            struct healOverTime
+            {
+                StatusEffectHandle handle;
+                Level::LevelLayerInstance* layer;
+                CharacterID owner;
+                CharacterID source;
+                float healthPerSecond;
+                float tickRate;
+                float timer;
+            };
+            std::vector<healOverTime> _healOverTime;
+
+            struct pendingTick
+            {
+                CharacterID owner;
+                bool isDamage;
+                uint32_t index;
+                uint32_t count;
+            };
+            std::vector<pendingTick> _pendingTicks;
+            std::vector<StatusEffectHandle> _deferredRemovals;
+            bool _ticking;
+
+            StatusEffectHandle _nextHandle;
+        };
+    }
+}
@@ -1,4 +1,5 @@
 #include "Characters/Arrow.hpp"
+#include "Audio/SoundEventScheduler.hpp"
 
 #include "Physics/CircleCollision.hpp"
 
@@ -176,9 +177,8 @@ namespace Dwarf
                 if (GetLevelLayer()->HitTerrain(curPos, outEdgeType, Pathfinding::EdgeType_All))
                 {
                     hitThisFrame = true;
-                    auto soundManager = GetLevel()->GetSoundManager();
-                    soundManager->PlaySinglePositionalSound(_hitGroundSounds.GetNextSound(), Audio::SoundPriority::Low, curPos, 
-                                                            ArrowHitGroundSoundRange.first, ArrowHitGroundSoundRange.second, ArrowHitGroundSoundVolume);
+                    Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Impact, _hitGroundSounds.GetNextSound(), Audio::SoundPriority::Low, curPos,
+                                          ArrowHitGroundSoundRange.first, ArrowHitGroundSoundRange.second, ArrowHitGroundSoundVolume);
                 }
             }
 
@@ -7,21 +7,23 @@
 #include "Item/Trinket.hpp"
 #include "ContentUtility.hpp"
 #include "ParticlesUtility.hpp"
+#include "Profiler.hpp"
 
 #include "Drawables/OverheadTextDisplay.hpp"
 #include "Drawables/EmoteDisplay.hpp"
 
 #include "Items/Weapons/WeaponTraits.hpp"
 
+#include "Levels/BasicLevel.hpp"
+#include "Audio/SoundEventScheduler.hpp"
+#include "Characters/TargetIndex.hpp"
+
 #include "Particles/ParticleSystemInstance.hpp"
 
 namespace Dwarf
 {
     namespace Character
     {
-        static const std::string DamageFontPath = "Fonts/numbers_red.spritefont";
-        static const std::string HealingFontPath = "Fonts/numbers_green.spritefont";
-
         static const uint32_t OverheadTextFontSize = 50;
         static const uint32_t OverheadTextFontCriticalSize = 80;
 
@@ -33,41 +35,39 @@ namespace Dwarf
         BasicCharacter::BasicCharacter(const CharacterParameters& parameters, const std::string& skeletonPath, const std::string& matsetPath)
             : SkeletonCharacter(parameters, skeletonPath, matsetPath)
 
-            , _mouthName()
-            , _headName()
+            , _basicLevel(nullptr)
+            , _archetypeCache(nullptr)
+            , _archetype(std::make_shared<CharacterArchetype>())
+            , _baseArchetype(nullptr)
+            , _archetypeKey()
+            , _buildingArchetype(false)
+            , _privateArchetype(false)
+            , _archetypeContentManager(nullptr)
+
+            , _weaponAttachmentStates()
+
             , _headRotationSpeed(Pi)
             , _hasForcedLookPos(false)
 
-            , _mainArmNames()
-            , _offArmNames()
             , _armRotationSpeed(TwoPi)
 
-            , _damageParticles()
-
-            , _runParticleSystemPath()
-            , _runParticles(nullptr)
-            , _runParticleSystemTags()
+            , _particleEffects(nullptr)
+            , _loadedParticleEffects()
+            , _statusEffects(nullptr)
+            , _itemIndices()
+            , _equipmentRevision(0)
 
-            , _feet()
-            , _baseFootstepSounds()
-            , _terrainFootstepSounds()
-
-            , _jawName()
             , _remainingJawOpenDuration(0.0f)
 
-            , _aggroSounds()
-            , _attackSounds()
             , _attackSoundPlayChance(0.3f)
-            , _idleSounds()
-            , _deathSounds()
-            , _affirmativeSounds()
-            , _negatorySounds()
-            , _tauntSounds()
 
             , _speechMinDist(1000.0f)
             , _speechMaxDist(3000.0f)
 
             , _aggroRange(0.0f)
+            , _aggroCandidateSelection()
+            , _aggroCandidates()
+            , _nextAggroCandidate(0)
 
             , _injuredThreshold(0.2f)
 
@@ -100,6 +100,13 @@ namespace Dwarf
             , _textDisplay(nullptr)
             , _emoteDisplay(nullptr)
         {
+            _basicLevel = AsA<Level::BasicLevel>(GetLevel());
+            if (_basicLevel)
+            {
+                _archetypeCache = &_basicLevel->GetCharacterArchetypeCache();
+                _particleEffects = &_basicLevel->GetParticleEffectManager();
+                _statusEffects = &_basicLevel->GetStatusEffectManager();
+            }
         }
 
         void BasicCharacter::LookAt(const Vector2f& position)
@@ -120,54 +127,54 @@ namespace Dwarf
         void BasicCharacter::PointMainArmAt(const Vector2f& position)
         {
             Animation::SkeletonInstance* skeleton = GetSkeleton();
-            for (uint32_t i = 0; i < _mainArmNames.size(); i++)
+            for (uint32_t i = 0; i < _archetype->MainArmNames.size(); i++)
             {
-                skeleton->PointJointAt(_mainArmNames[i], position, _armRotationSpeed);
+                skeleton->PointJointAt(_archetype->MainArmNames[i], position, _armRotationSpeed);
             }
         }
 
         void BasicCharacter::PointMainArmTo(const Vector2f& direction)
         {
             Animation::SkeletonInstance* skeleton = GetSkeleton();
-            for (uint32_t i = 0; i < _mainArmNames.size(); i++)
+            for (uint32_t i = 0; i < _archetype->MainArmNames.size(); i++)
             {
-                skeleton->PointJointTo(_mainArmNames[i], direction, _armRotationSpeed);
+                skeleton->PointJointTo(_archetype->MainArmNames[i], direction, _armRotationSpeed);
             }
         }
 
         void BasicCharacter::StopPointingMainArm()
         {
             Animation::SkeletonInstance* skeleton = GetSkeleton();
-            for (uint32_t i = 0; i < _mainArmNames.size(); i++)
+            for (uint32_t i = 0; i < _archetype->MainArmNames.size(); i++)
             {
-                skeleton->StopPointingJoint(_mainArmNames[i], _armRotationSpeed);
+                skeleton->StopPointingJoint(_archetype->MainArmNames[i], _armRotationSpeed);
             }
         }
 
         void BasicCharacter::PointOffArmAt(const Vector2f& position)
         {
             Animation::SkeletonInstance* skeleton = GetSkeleton();
-            for (uint32_t i = 0; i < _offArmNames.size(); i++)
+            for (uint32_t i = 0; i < _archetype->OffArmNames.size(); i++)
             {
-                skeleton->PointJointAt(_offArmNames[i], position, _armRotationSpeed);
+                skeleton->PointJointAt(_archetype->OffArmNames[i], position, _armRotationSpeed);
             }
         }
 
         void BasicCharacter::PointOffArmTo(const Vector2f& direction)
         {
             Animation::SkeletonInstance* skeleton = GetSkeleton();
-            for (uint32_t i = 0; i < _offArmNames.size(); i++)
+            for (uint32_t i = 0; i < _archetype->OffArmNames.size(); i++)
             {
-                skeleton->PointJointTo(_offArmNames[i], direction, _armRotationSpeed);
+                skeleton->PointJointTo(_archetype->OffArmNames[i], direction, _armRotationSpeed);
             }
         }
 
         void BasicCharacter::StopPointingOffArm()
         {
             Animation::SkeletonInstance* skeleton = GetSkeleton();
-            for (uint32_t i = 0; i < _offArmNames.size(); i++)
+            for (uint32_t i = 0; i < _archetype->OffArmNames.size(); i++)
             {
-                skeleton->StopPointingJoint(_offArmNames[i], _armRotationSpeed);
+                skeleton->StopPointingJoint(_archetype->OffArmNames[i], _armRotationSpeed);
             }
         }
 
@@ -181,9 +188,9 @@ namespace Dwarf
             const Animation::SkeletonInstance* skeleton = GetSkeleton();
 
             Rectanglef dmgDisplayBounds;
-            if (skeleton->HasJoint(_headName))
+            if (skeleton->HasJoint(_archetype->HeadName))
             {
-                dmgDisplayBounds = skeleton->GetJointBounds(_headName).Bounds();
+                dmgDisplayBounds = skeleton->GetJointBounds(_archetype->HeadName).Bounds();
             }
             else
             {
@@ -219,10 +226,10 @@ namespace Dwarf
                 DoDeathRagdoll(true);
                 DoDeathDropItems();
             }
-            else if (_deathAnimations.Count() > 0)
+            else if (_archetype->DeathAnimations.Count() > 0)
             {
                 _dieing = true;
-                PlayAnimationSet(_deathAnimations, false, 0.1f, 0.0f);
+                PlayAnimationSet(_archetype->DeathAnimations, false, 0.1f, 0.0f);
             }
             else
             {
@@ -239,13 +246,14 @@ namespace Dwarf
 
             const float targetRange = Vector2f::Distance(GetPosition(), target->GetPosition());
 
-            std::map<attackAnimationRequirements*, Animation::AnimationSet> matchingAnimationSets;
-            for (auto& animation : _attackAnimations)
+            using AttackAnimationRequirements = CharacterArchetype::AttackAnimationRequirements;
+            std::map<const AttackAnimationRequirements*, Animation::AnimationSet> matchingAnimationSets;
+            for (const auto& animation : _archetype->AttackAnimations)
             {
                 bool matches = true;
-                for (const auto& requirement : animation.requiredAttachments)
+                for (const auto& requirement : animation.RequiredAttachments)
                 {
-                    if (_weaponAttachmentLocations[requirement.first].equippedWeaponType != requirement.second)
+                    if (_weaponAttachmentStates[requirement.first].equippedWeaponType != requirement.second)
                     {
                         matches = false;
                         break;
@@ -255,13 +263,13 @@ namespace Dwarf
 
                 if (matches)
                 {
-                    for (const auto& rangeRequirement : animation.animationRanges)
+                    for (const auto& rangeRequirement : animation.AnimationRanges)
                     {
                         const AttackRange& range = rangeRequirement.second;
                         if (targetRange >= range.first && targetRange <= range.second)
                         {
                             const std::string& animationName = rangeRequirement.first;
-                            matchingAnimationSets[&animation].AddAnimation(animationName, animation.animationWeights[animationName]);
+                            matchingAnimationSets[&animation].AddAnimation(animationName, animation.AnimationWeights.at(animationName));
                         }
                     }
                 }
@@ -269,25 +277,25 @@ namespace Dwarf
 
             if (!matchingAnimationSets.empty())
             {
-                const std::pair<attackAnimationRequirements*, Animation::AnimationSet>& animation =
+                const std::pair<const AttackAnimationRequirements*, Animation::AnimationSet>& animation =
                     *Random::RandomItem(matchingAnimationSets);
 
-                attackAnimationRequirements& animationRequirements = *animation.first;
+                const AttackAnimationRequirements& animationRequirements = *animation.first;
                 const std::string& nextAnimName = animation.second.PeekNextAnimation();
 
                 float animLength = PlayAnimation(nextAnimName, false, 0.05f, 0.0f);
 
                 _curDmgRangeTags.clear();
-                for (const auto& attackWeapon : animationRequirements.requiredAttachments)
+                for (const auto& attackWeapon : animationRequirements.RequiredAttachments)
                 {
-                    const auto& attackWeaponAttachment = _weaponAttachmentLocations[attackWeapon.first];
-                    _curDmgRangeTags[attackWeaponAttachment.equippedWeapon] = animationRequirements.animationDmgRanges[nextAnimName][attackWeapon.first];
-                    _curDmgResetTags[attackWeaponAttachment.equippedWeapon] = animationRequirements.animationDmgResetTags[nextAnimName][attackWeapon.first];
+                    const auto& attackWeaponAttachment = _weaponAttachmentStates[attackWeapon.first];
+                    _curDmgRangeTags[attackWeaponAttachment.equippedWeapon] = animationRequirements.AnimationDmgRanges.at(nextAnimName).at(attackWeapon.first);
+                    _curDmgResetTags[attackWeaponAttachment.equippedWeapon] = animationRequirements.AnimationDmgResetTags.at(nextAnimName).at(attackWeapon.first);
 
-                    const auto& attackTags = animationRequirements.animationAttackSoundTags[nextAnimName][attackWeapon.first];
+                    const auto& attackTags = animationRequirements.AnimationAttackSoundTags.at(nextAnimName).at(attackWeapon.first);
                     _curAttackSoundTags.insert(attackTags.begin(), attackTags.end());
 
-                    const auto& wooshTags = animationRequirements.animationWooshSoundTags[nextAnimName][attackWeapon.first];
+                    const auto& wooshTags = animationRequirements.AnimationWooshSoundTags.at(nextAnimName).at(attackWeapon.first);
                     for (const auto& wooshTag : wooshTags)
                     {
                         _curWooshSoundTags[wooshTag] = attackWeapon.second;
@@ -297,9 +305,9 @@ namespace Dwarf
                 AttackInfo attackInfo;
                 attackInfo.Duration = animLength;
 
-                for (const auto& requirement : animationRequirements.requiredAttachments)
+                for (const auto& requirement : animationRequirements.RequiredAttachments)
                 {
-                    Item::ItemID weap = _weaponAttachmentLocations[requirement.first].equippedWeapon;
+                    Item::ItemID weap = _weaponAttachmentStates[requirement.first].equippedWeapon;
                     attackInfo.Weapons[weap] = _curDmgResetTags[weap].size() + 1;
                 }
 
@@ -347,13 +355,13 @@ namespace Dwarf
         {
             const Animation::SkeletonInstance* skeleton = GetSkeleton();
 
-            for (const auto& attachmentLocation : _weaponAttachmentLocations)
+            for (const auto& attachmentLocation : _archetype->WeaponAttachments)
             {
-                auto iter = attachmentLocation.second.jointNames.find(type);
-                if (iter != attachmentLocation.second.jointNames.end() && iter->second == name)
+                auto iter = attachmentLocation.second.JointNames.find(type);
+                if (iter != attachmentLocation.second.JointNames.end() && iter->second == name)
                 {
-                    const Vector2f& attachA = skeleton->GetJointPosition(attachmentLocation.second.attachA);
-                    const Vector2f& attachB = skeleton->GetJointPosition(attachmentLocation.second.attachB);
+                    const Vector2f& attachA = skeleton->GetJointPosition(attachmentLocation.second.AttachA);
+                    const Vector2f& attachB = skeleton->GetJointPosition(attachmentLocation.second.AttachB);
                     return Rayf(attachA, attachB - attachA);
                 }
             }
@@ -373,9 +381,9 @@ namespace Dwarf
 
         Vector2f BasicCharacter::GetMouthPosition() const
         {
-            if (!_mouthName.empty())
+            if (!_archetype->MouthName.empty())
             {
-                return GetSkeleton()->GetJointPosition(_mouthName);
+                return GetSkeleton()->GetJointPosition(_archetype->MouthName);
             }
             else
             {
@@ -385,9 +393,9 @@ namespace Dwarf
 
         Vector2f BasicCharacter::GetHeadPosition() const
         {
-            if (!_headName.empty())
+            if (!_archetype->HeadName.empty())
             {
-                return GetSkeleton()->GetJointPosition(_headName);
+                return GetSkeleton()->GetJointPosition(_archetype->HeadName);
             }
             else
             {
@@ -397,7 +405,8 @@ namespace Dwarf
 
         Vector2f BasicCharacter::GetFeetPosition() const
         {
-            if (_feet.empty())
+            const auto& feet = _archetype->Feet;
+            if (feet.empty())
             {
                 return GetBounds().Middle();
             }
@@ -405,19 +414,19 @@ namespace Dwarf
             {
 
                 Vector2f footPositionSum;
-                for (auto& foot : _feet)
+                for (const auto& foot : feet)
                 {
-                    const Vector2f footFront = GetAttachPoint(foot.front).Position;
-                    const Vector2f footBack = GetAttachPoint(foot.back).Position;
+                    const Vector2f footFront = GetAttachPoint(foot.Front).Position;
+                    const Vector2f footBack = GetAttachPoint(foot.Back).Position;
                     footPositionSum += footFront + footBack;
                 }
-                return footPositionSum / Vector2f(_feet.size() * 2);
+                return footPositionSum / Vector2f(feet.size() * 2);
             }
         }
 
         bool BasicCharacter::WantsToLookAtMouse() const
         {
-            for (const auto& mouseLookItem : GetItems<Item::MouseLooker>())
+            for (const auto& mouseLookItem : GetIndexedItems<Item::MouseLooker>())
             {
                 if (mouseLookItem->WantsToLookAtMouse())
                 {
@@ -432,51 +441,32 @@ namespace Dwarf
         {
             SkeletonCharacter::OnLoadContent(contentManager);
 
-            for (auto& damageParticles : _damageParticles)
+            // Shared sounds and fonts are only loaded by the first instance of the archetype and stay loaded until the
+            // level unloads
+            _archetype->LoadContent(contentManager);
+            _archetypeContentManager = contentManager;
+            if (_archetypeCache && !_privateArchetype)
             {
-                damageParticles.particles = Content::CreateParticleSystemInstance(contentManager, damageParticles.path);
-            }
-            
-            if (!_healParticlesPath.empty())
-            {
-                _healParticles = Content::CreateParticleSystemInstance(contentManager, _healParticlesPath);
+                _archetypeCache->KeepContentLoaded(_archetype, contentManager);
             }
 
-            if (_runParticleSystemPath.size() > 0)
+            // Particle effects are burst into the level's pooled emitters, remember what was loaded in case the archetype
+            // is edited before unloading
+            if (_particleEffects)
             {
-                _runParticles = contentManager->Load<Particles::ParticleSystem>(_runParticleSystemPath);
-                for (uint32_t i = 0; i < _feet.size(); i++)
+                for (const auto& damageParticles : _archetype->DamagedParticles)
                 {
-                    _feet[i].particleSystem = new Particles::ParticleSystemInstance(_runParticles);
+                    _loadedParticleEffects.push_back(damageParticles.Path);
                 }
-            }
-
-            _aggroSounds.LoadContent(contentManager);
-            _attackSounds.LoadContent(contentManager);
-            for (auto& attackWooshSound : _attackWooshSounds)
-            {
-                attackWooshSound.second.LoadContent(contentManager);
-            }
-            _idleSounds.LoadContent(contentManager);
-            _deathSounds.LoadContent(contentManager);
-            _affirmativeSounds.LoadContent(contentManager);
-            _negatorySounds.LoadContent(contentManager);
-            _tauntSounds.LoadContent(contentManager);
-            for (auto& damageSound : _damageSounds)
-            {
-                damageSound.sounds.LoadContent(contentManager);
-            }
-            _healingSounds.LoadContent(contentManager);
+                _loadedParticleEffects.push_back(_archetype->HealParticlesPath);
+                _loadedParticleEffects.push_back(_archetype->RunParticlesPath);
 
-            _baseFootstepSounds.LoadContent(contentManager);
-            for (auto& footstepSounds : _terrainFootstepSounds)
-            {
-                footstepSounds.second.LoadContent(contentManager);
+                for (const auto& effectPath : _loadedParticleEffects)
+                {
+                    _particleEffects->LoadEffect(contentManager, effectPath);
+                }
             }
 
-            _damageFont = contentManager->Load<Graphics::Font>(DamageFontPath);
-            _healingFont = contentManager->Load<Graphics::Font>(HealingFontPath);
-
             _textDisplay = new Graphics::OverheadTextDisplay();
 
             _emoteDisplay = new Graphics::EmoteDisplay();
@@ -490,44 +480,19 @@ namespace Dwarf
         {
             SkeletonCharacter::OnUnloadContent();
 
-            for (auto& damageParticles : _damageParticles)
+            for (const auto& effectPath : _loadedParticleEffects)
             {
-                SafeRelease(damageParticles.particles);
+                _particleEffects->UnloadEffect(effectPath);
             }
-            
-            SafeRelease(_healParticles);
+            _loadedParticleEffects.clear();
 
-            SafeRelease(_runParticles);
-            for (uint32_t i = 0; i < _feet.size(); i++)
-            {
-                SafeRelease(_feet[i].particleSystem);
-            }
+            _archetype->UnloadContent();
+            _archetypeContentManager = nullptr;
 
-            _aggroSounds.UnloadContent();
-            _attackSounds.UnloadContent();
-            for (auto& attackWooshSound : _attackWooshSounds)
+            if (_statusEffects)
             {
-                attackWooshSound.second.UnloadContent();
+                _statusEffects->RemoveCharacterEffects(GetID());
             }
-            _idleSounds.UnloadContent();
-            _deathSounds.UnloadContent();
-            _affirmativeSounds.UnloadContent();
-            _negatorySounds.UnloadContent();
-            _tauntSounds.UnloadContent();
-            for (auto& damageSound : _damageSounds)
-            {
-                damageSound.sounds.UnloadContent();
-            }
-            _healingSounds.UnloadContent();
-
-            _baseFootstepSounds.UnloadContent();
-            for (auto& footstepSounds : _terrainFootstepSounds)
-            {
-                footstepSounds.second.UnloadContent();
-            }
-
-            SafeRelease(_damageFont);
-            SafeRelease(_healingFont);
 
             SafeRelease(_textDisplay);
             SafeRelease(_emoteDisplay);
@@ -543,7 +508,25 @@ namespace Dwarf
 
         void BasicCharacter::OnUpdate(double totalTime, float dt)
         {
+            if (IsDormant())
+            {
+                return;
+            }
+
+            PROFILE_ZONE("BasicCharacter::OnUpdate");
+            Level::ScopedSimulationTimer updateTimer(_basicLevel ? _basicLevel->GetSimulationBenchmark() : nullptr, Level::SimulationStage_CharacterUpdate);
+
+            // Buff stat modifiers are aggregated by the level, apply them before anything reads this frame's multipliers
+            if (_statusEffects)
+            {
+                _statusEffects->ApplyStatModifiers(this);
+            }
+
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
             Animation::SkeletonInstance* skeleton = GetSkeleton();
 
@@ -552,7 +535,7 @@ namespace Dwarf
                 CharacterState curState = GetCurrentState();
                 if (curState == CharacterState_Idle)
                 {
-                    Character* nearbyEnemy = FindNearbyAttackableTarget(Max(GetAggroRange(), GetWeaponRange() * 0.1f));
+                    Character* nearbyEnemy = findAggroTarget(Max(GetAggroRange(), GetWeaponRange() * 0.1f));
                     if (nearbyEnemy)
                     {
                         Emote(Emote_Surprised, 2.0f);
@@ -600,52 +583,25 @@ namespace Dwarf
             Character* attackTarget = GetAttackTarget();
             if (IsAlive() && attackTarget)
             {
-                if (!_headName.empty())
+                if (!_archetype->HeadName.empty())
                 {
-                    Vector2f headPos = GetAttachPoint(_headName).Position;
+                    Vector2f headPos = GetAttachPoint(_archetype->HeadName).Position;
                     Vector2f lookPos = attackTarget->GetBounds().Middle();
 
                     if (IsA<BasicCharacter>(attackTarget))
                     {
                         BasicCharacter* attackTargetBasicCharacter = AsA<BasicCharacter>(attackTarget);
-                        if (attackTargetBasicCharacter->_headName.size() > 0)
+                        const std::string& targetHeadName = attackTargetBasicCharacter->_archetype->HeadName;
+                        if (targetHeadName.size() > 0)
                         {
                             // Look at the closest point between the target's middle and head
-                            const Polygonf& targetHeadBounds = attackTargetBasicCharacter->GetSkeleton()->GetJointBounds(attackTargetBasicCharacter->_headName);
+                            const Polygonf& targetHeadBounds = attackTargetBasicCharacter->GetSkeleton()->GetJointBounds(targetHeadName);
                             Math::PointToLineDistance(Vector2f(lookPos.X, targetHeadBounds.Bounds().Top()), Vector2f(lookPos.X, lookPos.Y), headPos, lookPos);
                         }
                     }
 
                     lookAt(lookPos, false);
                 }
-
-                for (const auto& dmgResets : _curDmgResetTags)
-                {
-                    for (const auto& dmgResetTag : dmgResets.second)
-                    {
-                        if (skeleton->HasAnimationTagJustPassed(dmgResetTag))
-                        {
-                            ResetHitAttackTargets(GetItem<Item::Weapon>(dmgResets.first));
-                        }
-                    }
-                }
-                for (const auto& attackSoundTag : _curAttackSoundTags)
-                {
-                    if (skeleton->HasAnimationTagJustPassed(attackSoundTag) && Random::RandomBetween(0.0f, 1.0f) < _attackSoundPlayChance)
-                    {
-                        Speak(_attackSounds, false, true);
-                    }
-                }
-                for (const auto& wooshSoundTag : _curWooshSoundTags)
-                {
-                    if (skeleton->HasAnimationTagJustPassed(wooshSoundTag.first))
-                    {
-                        auto soundManager = GetLevel()->GetSoundManager();
-                        soundManager->PlaySinglePositionalSound(_attackWooshSounds[wooshSoundTag.second].GetNextSound(),
-                                                                Audio::SoundPriority::High, GetMouthPosition(), _speechMinDist, _speechMaxDist,
-                                                                _speechPositionalVolume);
-                    }
-                }
             }
             else if (IsAlive() && IsMoving())
             {
@@ -659,100 +615,6 @@ namespace Dwarf
                 stopLooking(false);
             }
 
-            for (auto& damageParticles : _damageParticles)
-            {
-                damageParticles.particles->Update(totalTime, dt);
-            }
-            
-            if (_healParticles)
-            {
-                _healParticles->Update(totalTime, dt);
-            }
-
-            bool burstFootParticles = false;
-            for (const auto& runParticleSystemTag : _runParticleSystemTags)
-            {
-                if (skeleton->HasAnimationTagJustPassed(runParticleSystemTag))
-                {
-                    burstFootParticles = true;
-                    break;
-                }
-            }
-
-            for (auto& foot : _feet)
-            {
-                if (foot.particleSystem)
-                {
-                    if (burstFootParticles)
-                    {
-                        const Vector2f footFront = GetAttachPoint(foot.front).Position;
-                        const Vector2f footBack = GetAttachPoint(foot.back).Position;
-
-                        foot.particleSystem->SetLineSpawner(footFront, footBack);
-
-                        Rotatorf rotation(0.0f);
-                        if (footFront != footBack)
-                        {
-                            rotation = footFront - footBack;
-                        }
-                        else
-                        {
-                            auto path = GetCurrentPath();
-                            if (path)
-                            {
-                                rotation = Rotatorf::Reflect(path->GetCurrentRotation(), Rotatorf::PiOver2);
-                            }
-                        }
-
-                        foot.particleSystem->SetInvertedX(skeleton->IsInvertedX());
-                        foot.particleSystem->SetInvertedY(skeleton->IsInvertedY());
-                        foot.particleSystem->SetRotation(rotation);
-
-                        foot.particleSystem->Burst();
-                    }
-
-                    foot.particleSystem->Update(totalTime, dt);
-                }
-            }
-
-            const auto& currentPath = GetCurrentPath();
-            if (burstFootParticles && _feet.size() > 0 && currentPath != nullptr)
-            {
-                Vector2f avgFootPos = GetFeetPosition();
-                float footstepMinDist = _speechMinDist;
-                float footstepMaxDist = _speechMaxDist;
-                Pathfinding::TerrainType curTurrain = currentPath->GetCurrentPosition()->GetTerrain();
-
-                auto soundManager = GetLevel()->GetSoundManager();
-
-                auto baseSound = _baseFootstepSounds.GetNextSound();
-                soundManager->PlaySinglePositionalSound(baseSound, Audio::SoundPriority::Low, avgFootPos,
-                    footstepMinDist, footstepMaxDist, Random::RandomBetween(_footstepVolumeRange.first, _footstepVolumeRange.second));
-
-                auto terrainSound = _terrainFootstepSounds[curTurrain].GetNextSound();
-                soundManager->PlaySinglePositionalSound(terrainSound, Audio::SoundPriority::Low, avgFootPos,
-                    footstepMinDist, footstepMaxDist, Random::RandomBetween(_footstepVolumeRange.first, _footstepVolumeRange.second));
-
-                if (_footstepCameraShakeEnabled)
-                {
-                    float length = 0.1f;
-                    if (baseSound)
-                    {
-                        length = Max(length, baseSound->GetLength());
-                    }
-                    if (terrainSound)
-                    {
-                        length = Max(length, terrainSound->GetLength());
-                    }
-
-                    static const float MaximumStepShake = 0.8f;
-                    length = Min(length, MaximumStepShake);
-
-                    auto& cameraController = GetLevel()->GetCameraController();
-                    cameraController.Shake(avgFootPos, footstepMinDist, footstepMaxDist, _footstepCameraShakeMagnitude, _footstepCameraShakeFrequency, length);
-                }
-            }
-
             if (_weaponAlphaTimer >= 0.0f)
             {
                 _weaponAlphaTimer -= dt;
@@ -787,11 +649,6 @@ namespace Dwarf
                 }
             }
 
-            _textDisplay->Update(totalTime, dt);
-
-            const Rectanglef& emoteHeadLocation = skeleton->HasJoint(_headName) ? skeleton->GetJointBounds(_headName).Bounds() : GetBounds();
-            _emoteDisplay->Update(emoteHeadLocation, totalTime, dt);
-
             auto vocalizationIter = _vocalizations.begin();
             while (vocalizationIter != _vocalizations.end())
             {
@@ -807,7 +664,8 @@ namespace Dwarf
             }
 
             _remainingJawOpenDuration -= dt;
-            if (!_jawName.empty())
+            const std::string& jawName = _archetype->JawName;
+            if (!jawName.empty())
             {
                 if (!_vocalizations.empty())
                 {
@@ -822,40 +680,170 @@ namespace Dwarf
 
                     Vector2f jointTargetPos = _remainingJawOpenDuration > jawCloseThreshold ? Vector2f(0.0f, 1000.0f) : Vector2f(0.0f, -1000.0f);
 
-                    skeleton->PointJointTo(_jawName, jointTargetPos, jawRotationSpeed);
+                    skeleton->PointJointTo(jawName, jointTargetPos, jawRotationSpeed);
                 }
                 else
                 {
-                    skeleton->StopPointingJoint(_jawName);
+                    skeleton->StopPointingJoint(jawName);
                 }
             }
         }
 
-        void BasicCharacter::OnDraw(Graphics::LevelRenderer* levelRenderer) const
+        bool BasicCharacter::IsIdle() const
         {
-            SkeletonCharacter::OnDraw(levelRenderer);
+            return SkeletonCharacter::IsIdle() && IsAlive() && !_dieing && GetCurrentState() == CharacterState_Idle &&
+                   _weaponAlphaTimer < 0.0f;
+        }
+
+        void BasicCharacter::OnParallelUpdate(double totalTime, float dt, CharacterCommandBuffer& commands)
+        {
+            SkeletonCharacter::OnParallelUpdate(totalTime, dt, commands);
 
-            for (const auto& damageParticles : _damageParticles)
+            Animation::SkeletonInstance* skeleton = GetSkeleton();
+
+            if (IsAlive() && GetAttackTarget())
             {
-                if (damageParticles.particles->GetParticleCount() > 0)
+                for (const auto& dmgResets : _curDmgResetTags)
                 {
-                    levelRenderer->AddDrawable(damageParticles.particles, false);
+                    for (const auto& dmgResetTag : dmgResets.second)
+                    {
+                        if (skeleton->HasAnimationTagJustPassed(dmgResetTag))
+                        {
+                            // Items are looked up through the level
+                            Item::ItemID weaponID = dmgResets.first;
+                            commands.Call([this, weaponID]()
+                            {
+                                ResetHitAttackTargets(GetItem<Item::Weapon>(weaponID));
+                            });
+                        }
+                    }
+                }
+                for (const auto& attackSoundTag : _curAttackSoundTags)
+                {
+                    if (skeleton->HasAnimationTagJustPassed(attackSoundTag))
+                    {
+                        // Random numbers are drawn when the commands run so that they are drawn in a fixed order
+                        commands.Call([this]()
+                        {
+                            if (Random::RandomBetween(0.0f, 1.0f) < _attackSoundPlayChance)
+                            {
+                                Speak(_archetype->AttackSounds, false, true);
+                            }
+                        });
+                    }
+                }
+                for (const auto& wooshSoundTag : _curWooshSoundTags)
+                {
+                    auto wooshSounds = _archetype->AttackWooshSounds.find(wooshSoundTag.second);
+                    if (skeleton->HasAnimationTagJustPassed(wooshSoundTag.first) && wooshSounds != _archetype->AttackWooshSounds.end())
+                    {
+                        commands.PlaySinglePositionalSound(Audio::SoundCategory_Attack, wooshSounds->second, Audio::SoundPriority::High,
+                                                           GetMouthPosition(), _speechMinDist, _speechMaxDist, _speechPositionalVolume);
+                    }
                 }
             }
 
-            if (_healParticles && _healParticles->GetParticleCount() > 0)
+            bool burstFootParticles = false;
+            for (const auto& runParticleSystemTag : _archetype->RunParticleTags)
             {
-                levelRenderer->AddDrawable(_healParticles, false);
+                if (skeleton->HasAnimationTagJustPassed(runParticleSystemTag))
+                {
+                    burstFootParticles = true;
+                    break;
+                }
             }
-            
-            for (uint32_t i = 0; i < _feet.size(); i++)
+
+            const auto& feet = _archetype->Feet;
+            if (burstFootParticles && _particleEffects && !_archetype->RunParticlesPath.empty())
             {
-                if (_feet[i].particleSystem)
+                for (const auto& foot : feet)
                 {
-                    levelRenderer->AddDrawable(_feet[i].particleSystem, false);
+                    const Vector2f footFront = GetAttachPoint(foot.Front).Position;
+                    const Vector2f footBack = GetAttachPoint(foot.Back).Position;
+
+                    Graphics::ParticleBurst burst;
+                    if (footFront != footBack)
+                    {
+                        burst.Rotation = footFront - footBack;
+                    }
+                    else
+                    {
+                        auto path = GetCurrentPath();
+                        if (path)
+                        {
+                            burst.Rotation = Rotatorf::Reflect(path->GetCurrentRotation(), Rotatorf::PiOver2);
+                        }
+                    }
+                    burst.InvertedX = skeleton->IsInvertedX();
+                    burst.InvertedY = skeleton->IsInvertedY();
+
+                    commands.Call([this, footFront, footBack, burst]()
+                    {
+                        _particleEffects->Burst(GetLevelLayer(), _archetype->RunParticlesPath, footFront, footBack, burst);
+                    });
                 }
             }
 
+            const auto& currentPath = GetCurrentPath();
+            if (burstFootParticles && feet.size() > 0 && currentPath != nullptr)
+            {
+                Vector2f feetPosition = GetFeetPosition();
+                Pathfinding::TerrainType terrain = currentPath->GetCurrentPosition()->GetTerrain();
+                commands.Call([this, feetPosition, terrain]()
+                {
+                    playFootsteps(feetPosition, terrain);
+                });
+            }
+
+            const std::string& headName = _archetype->HeadName;
+            const Rectanglef emoteHeadLocation = skeleton->HasJoint(headName) ? skeleton->GetJointBounds(headName).Bounds() : GetBounds();
+
+            // Emote materials and text fonts are shared between characters, the displays are only updated on the main thread
+            commands.Call([this, emoteHeadLocation, totalTime, dt]()
+            {
+                _textDisplay->Update(totalTime, dt);
+                _emoteDisplay->Update(emoteHeadLocation, totalTime, dt);
+            });
+        }
+
+        void BasicCharacter::playFootsteps(const Vector2f& position, Pathfinding::TerrainType terrain)
+        {
+            float footstepMinDist = _speechMinDist;
+            float footstepMaxDist = _speechMaxDist;
+
+            auto baseSound = _archetype->BaseFootstepSounds.GetNextSound();
+            Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Footstep, baseSound, Audio::SoundPriority::Low, position,
+                footstepMinDist, footstepMaxDist, Random::RandomBetween(_footstepVolumeRange.first, _footstepVolumeRange.second));
+
+            auto terrainSounds = _archetype->TerrainFootstepSounds.find(terrain);
+            auto terrainSound = terrainSounds != _archetype->TerrainFootstepSounds.end() ? terrainSounds->second.GetNextSound() : nullptr;
+            Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Footstep, terrainSound, Audio::SoundPriority::Low, position,
+                footstepMinDist, footstepMaxDist, Random::RandomBetween(_footstepVolumeRange.first, _footstepVolumeRange.second));
+
+            if (_footstepCameraShakeEnabled)
+            {
+                float length = 0.1f;
+                if (baseSound)
+                {
+                    length = Max(length, baseSound->GetLength());
+                }
+                if (terrainSound)
+                {
+                    length = Max(length, terrainSound->GetLength());
+                }
+
+                static const float MaximumStepShake = 0.8f;
+                length = Min(length, MaximumStepShake);
+
+                auto& cameraController = GetLevel()->GetCameraController();
+                cameraController.Shake(position, footstepMinDist, footstepMaxDist, _footstepCameraShakeMagnitude, _footstepCameraShakeFrequency, length);
+            }
+        }
+
+        void BasicCharacter::OnDraw(Graphics::LevelRenderer* levelRenderer) const
+        {
+            SkeletonCharacter::OnDraw(levelRenderer);
+
             _textDisplay->Draw(levelRenderer);
             _emoteDisplay->Draw(levelRenderer);
         }
@@ -914,13 +902,13 @@ namespace Dwarf
         {
             switch (type)
             {
-            case Speech_Affirmative: return _affirmativeSounds;
-            case Speech_Negatory: return _negatorySounds;
-            case Speech_Aggro: return _aggroSounds;
-            case Speech_Taunt: return _tauntSounds;
-            case Speech_Death: return _deathSounds;
-            case Speech_Idle: return _idleSounds;
-            default: assert(false); return _deathSounds;
+            case Speech_Affirmative: return _archetype->AffirmativeSounds;
+            case Speech_Negatory: return _archetype->NegatorySounds;
+            case Speech_Aggro: return _archetype->AggroSounds;
+            case Speech_Taunt: return _archetype->TauntSounds;
+            case Speech_Death: return _archetype->DeathSounds;
+            case Speech_Idle: return _archetype->IdleSounds;
+            default: assert(false); return _archetype->DeathSounds;
             }
         }
 
@@ -929,6 +917,62 @@ namespace Dwarf
             return Speak(getSoundsForSpeech(type), false, positional);
         }
 
+        Character* BasicCharacter::findAggroTarget(float range)
+        {
+            const TargetIndex* targetIndex = GetTargetIndex(this);
+            if (!targetIndex)
+            {
+                return FindNearbyAttackableTarget(range);
+            }
+
+            const Vector2f& position = GetPosition();
+            auto isCandidate = [this, &position, range](const Character* target)
+            {
+                return target != this && target->IsAlive() && IsCharacterAttackable(target, false) &&
+                       Vector2f::DistanceSquared(position, target->GetPosition()) <= range * range;
+            };
+
+            if (_nextAggroCandidate >= _aggroCandidates.size())
+            {
+                _aggroCandidateSelection.Reset();
+                targetIndex->FindTargets(GetLevelLayer(), position, range, isCandidate,
+                    [&position](const Character* target) { return Vector2f::DistanceSquared(position, target->GetPosition()); },
+                    _aggroCandidateSelection);
+                _aggroCandidateSelection.Finish();
+
+                _aggroCandidates.clear();
+                for (uint32_t i = 0; i < _aggroCandidateSelection.GetCount(); i++)
+                {
+                    _aggroCandidates.push_back(_aggroCandidateSelection.GetTarget(i)->GetID());
+                }
+                _nextAggroCandidate = 0;
+            }
+
+            // Line of sight is the expensive check, only a few candidates are tested each frame and the search picks up
+            // where it left off on the next one
+            const uint32_t MaxAggroSightTestsPerFrame = 4;
+            uint32_t sightTests = 0;
+            Level::LevelLayerInstance* layer = GetLevelLayer();
+            while (_nextAggroCandidate < _aggroCandidates.size() && sightTests < MaxAggroSightTestsPerFrame)
+            {
+                Character* candidate = layer->GetCharacter(_aggroCandidates[_nextAggroCandidate++]);
+                if (!candidate || !isCandidate(candidate))
+                {
+                    continue;
+                }
+
+                sightTests++;
+                if (HasLineOfSight(candidate))
+                {
+                    _aggroCandidates.clear();
+                    _nextAggroCandidate = 0;
+                    return candidate;
+                }
+            }
+
+            return nullptr;
+        }
+
         void BasicCharacter::aggroNearbyFriendlies(const Character* target) const
         {
             if (GetController() != nullptr)
@@ -1047,23 +1091,25 @@ namespace Dwarf
         void BasicCharacter::AddWeaponAttachment(const std::string& name, const std::string attachA, const std::string attachB,
                                                  const std::map<Item::WeaponType, std::string>& weapTypesAttachJoints)
         {
-            weaponAttachment attachment;
-            attachment.attachA = attachA;
-            attachment.attachB = attachB;
-            attachment.jointNames = weapTypesAttachJoints;
-            attachment.equippedWeaponType = Item::WeaponType_None;
-            _weaponAttachmentLocations[name] = attachment;
+            CharacterArchetype& archetype = editArchetype();
+
+            CharacterArchetype::WeaponAttachment attachment;
+            attachment.AttachA = attachA;
+            attachment.AttachB = attachB;
+            attachment.JointNames = weapTypesAttachJoints;
+            archetype.WeaponAttachments[name] = attachment;
 
             for (const auto& weapTypesAttachJoint : weapTypesAttachJoints)
             {
-                _weaponAttachmentTypes[weapTypesAttachJoint.first].push_back(name);
+                archetype.WeaponAttachmentTypes[weapTypesAttachJoint.first].push_back(name);
             }
         }
 
         void BasicCharacter::ClearWeaponAttachments()
         {
-            _weaponAttachmentLocations.clear();
-            _weaponAttachmentTypes.clear();
+            CharacterArchetype& archetype = editArchetype();
+            archetype.WeaponAttachments.clear();
+            archetype.WeaponAttachmentTypes.clear();
             assignWeapons();
         }
 
@@ -1077,92 +1123,92 @@ namespace Dwarf
                 requiredAttachments[attachment.first] = attachment.second.Type;
             }
 
-            for (auto& animation : _attackAnimations)
+            CharacterArchetype& archetype = editArchetype();
+            for (auto& animation : archetype.AttackAnimations)
             {
-                if (animation.requiredAttachments == requiredAttachments)
+                if (animation.RequiredAttachments == requiredAttachments)
                 {
-                    animation.animationWeights[animName] = weight;
+                    animation.AnimationWeights[animName] = weight;
 
                     for (const auto& attachment : attachments)
                     {
-                        animation.animationDmgRanges[animName][attachment.first] = attachment.second.DamageRangeTags;
-                        animation.animationDmgResetTags[animName][attachment.first] = attachment.second.DamageResetTags;
-                        animation.animationAttackSoundTags[animName][attachment.first] = attachment.second.AttackSoundTags;
-                        animation.animationWooshSoundTags[animName][attachment.first] = attachment.second.WooshSoundTags;
-                        animation.animationRanges[animName] = attackRange;
+                        animation.AnimationDmgRanges[animName][attachment.first] = attachment.second.DamageRangeTags;
+                        animation.AnimationDmgResetTags[animName][attachment.first] = attachment.second.DamageResetTags;
+                        animation.AnimationAttackSoundTags[animName][attachment.first] = attachment.second.AttackSoundTags;
+                        animation.AnimationWooshSoundTags[animName][attachment.first] = attachment.second.WooshSoundTags;
+                        animation.AnimationRanges[animName] = attackRange;
                     }
                     return;
                 }
             }
 
-            attackAnimationRequirements newAnim;
-            newAnim.requiredAttachments = requiredAttachments;
-            newAnim.animationWeights[animName] = weight;
+            CharacterArchetype::AttackAnimationRequirements newAnim;
+            newAnim.RequiredAttachments = requiredAttachments;
+            newAnim.AnimationWeights[animName] = weight;
             for (const auto& attachment : attachments)
             {
-                newAnim.animationDmgRanges[animName][attachment.first] = attachment.second.DamageRangeTags;
-                newAnim.animationDmgResetTags[animName][attachment.first] = attachment.second.DamageResetTags;
-                newAnim.animationAttackSoundTags[animName][attachment.first] = attachment.second.AttackSoundTags;
-                newAnim.animationWooshSoundTags[animName][attachment.first] = attachment.second.WooshSoundTags;
-                newAnim.animationRanges[animName] = attackRange;
+                newAnim.AnimationDmgRanges[animName][attachment.first] = attachment.second.DamageRangeTags;
+                newAnim.AnimationDmgResetTags[animName][attachment.first] = attachment.second.DamageResetTags;
+                newAnim.AnimationAttackSoundTags[animName][attachment.first] = attachment.second.AttackSoundTags;
+                newAnim.AnimationWooshSoundTags[animName][attachment.first] = attachment.second.WooshSoundTags;
+                newAnim.AnimationRanges[animName] = attackRange;
             }
 
-            _attackAnimations.push_back(newAnim);
+            archetype.AttackAnimations.push_back(newAnim);
         }
 
         void BasicCharacter::ClearAttackAnimations()
         {
-            _attackAnimations.clear();
+            editArchetype().AttackAnimations.clear();
         }
 
         void BasicCharacter::AddInteractAnimation(const std::string& animName, float weight)
         {
-            _interactAnimations.AddAnimation(animName, weight);
+            editArchetype().InteractAnimations.AddAnimation(animName, weight);
         }
 
         void BasicCharacter::SetMouthName(const std::string& jointName)
         {
-            _mouthName = jointName;
+            editArchetype().MouthName = jointName;
         }
 
         void BasicCharacter::SetHeadName(const std::string& jointName)
         {
-            _headName = jointName;
+            editArchetype().HeadName = jointName;
         }
 
         void BasicCharacter::AddMainArmJoint(const std::string& jointName)
         {
-            _mainArmNames.push_back(jointName);
+            editArchetype().MainArmNames.push_back(jointName);
         }
 
         void BasicCharacter::AddOffArmJoint(const std::string& jointName)
         {
-            _offArmNames.push_back(jointName);
+            editArchetype().OffArmNames.push_back(jointName);
         }
 
         void BasicCharacter::AddFootJoint(const std::string& jointAName, const std::string& jointBName)
         {
-            foot foot;
-            foot.front = jointAName;
-            foot.back = jointBName;
-            foot.particleSystem = _runParticles ? new Particles::ParticleSystemInstance(_runParticles) : nullptr;
-            _feet.push_back(foot);
+            CharacterArchetype::Foot foot;
+            foot.Front = jointAName;
+            foot.Back = jointBName;
+            editArchetype().Feet.push_back(foot);
         }
 
         void BasicCharacter::SetJawJoint(const std::string& jointName)
         {
-            _jawName = jointName;
+            editArchetype().JawName = jointName;
         }
 
         void BasicCharacter::AddTerrainAnimation(AnimationType type, Pathfinding::EdgeType edgeType, Pathfinding::TerrainType terrainType,
                                                  float minAngle, AnimationVariant variant, const std::string& animationName, float weight)
         {
-            _terrainAnimations[type][edgeType][terrainType][minAngle][variant].AddAnimation(animationName, weight);
+            editArchetype().TerrainAnimations[type][edgeType][terrainType][minAngle][variant].AddAnimation(animationName, weight);
         }
 
         void BasicCharacter::ClearTerrainAnimations(AnimationType type, Pathfinding::EdgeType edgeType)
         {
-            for (auto& edgeTypeAnimation : _terrainAnimations[type])
+            for (auto& edgeTypeAnimation : editArchetype().TerrainAnimations[type])
             {
                 if ((edgeTypeAnimation.first & edgeType) != 0)
                 {
@@ -1173,17 +1219,17 @@ namespace Dwarf
 
         void BasicCharacter::AddDamagedParticleSystem(const DamageType& damageType, const std::string& particleSystemPath, const std::string& spawnJoint)
         {
-            damageParticles parts;
-            parts.damageType = damageType;
-            parts.path = particleSystemPath;
-            parts.spawnJoint = spawnJoint;
+            CharacterArchetype::DamageParticles parts;
+            parts.DamageType = damageType;
+            parts.Path = particleSystemPath;
+            parts.SpawnJoint = spawnJoint;
 
-            _damageParticles.push_back(parts);
+            editArchetype().DamagedParticles.push_back(parts);
         }
 
         void BasicCharacter::AddHealingParticleSystem(const std::string& particleSystemPath)
         {
-            _healParticlesPath = particleSystemPath;
+            editArchetype().HealParticlesPath = particleSystemPath;
         }
         
         void BasicCharacter::SetAggroRange(float range)
@@ -1193,27 +1239,27 @@ namespace Dwarf
 
         void BasicCharacter::SetRunParticleSystem(const std::string& particleSystemPath)
         {
-            _runParticleSystemPath = particleSystemPath;
+            editArchetype().RunParticlesPath = particleSystemPath;
         }
 
         void BasicCharacter::AddRunParticleTag(const std::string& animationTagName)
         {
-            _runParticleSystemTags.push_back(animationTagName);
+            editArchetype().RunParticleTags.push_back(animationTagName);
         }
 
         void BasicCharacter::AddAggroSounds(const Audio::SoundPathVector& sounds)
         {
-            _aggroSounds.AddSounds(sounds);
+            editArchetype().AggroSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddAttackSounds(const Audio::SoundPathVector& sounds)
         {
-            _attackSounds.AddSounds(sounds);
+            editArchetype().AttackSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddAttackWooshSounds(Item::WeaponType weaponType, const Audio::SoundPathVector& sounds)
         {
-            _attackWooshSounds[weaponType].AddSounds(sounds);
+            editArchetype().AttackWooshSounds[weaponType].AddSounds(sounds);
         }
 
         void BasicCharacter::AddAttackWooshSounds(const std::map<Item::WeaponType, Audio::SoundPathVector>& sounds)
@@ -1231,7 +1277,7 @@ namespace Dwarf
 
         void BasicCharacter::AddIdleSounds(const Audio::SoundPathVector& sounds)
         {
-            _idleSounds.AddSounds(sounds);
+            editArchetype().IdleSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::SetIdleSoundInterval(float minTimeout, float maxTimeout)
@@ -1241,22 +1287,22 @@ namespace Dwarf
 
         void BasicCharacter::AddDeathSounds(const Audio::SoundPathVector& sounds)
         {
-            _deathSounds.AddSounds(sounds);
+            editArchetype().DeathSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddAffirmativeSounds(const Audio::SoundPathVector& sounds)
         {
-            _affirmativeSounds.AddSounds(sounds);
+            editArchetype().AffirmativeSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddNegatorySounds(const Audio::SoundPathVector& sounds)
         {
-            _negatorySounds.AddSounds(sounds);
+            editArchetype().NegatorySounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddTauntSounds(const Audio::SoundPathVector& sounds)
         {
-            _tauntSounds.AddSounds(sounds);
+            editArchetype().TauntSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::SetGlobalSpeechParameters(float volume)
@@ -1273,13 +1319,15 @@ namespace Dwarf
 
         void BasicCharacter::AddDamageSounds(const Audio::DamageSoundPaths& sounds)
         {
+            CharacterArchetype& archetype = editArchetype();
+
             bool foundMatch = false;
-            for (auto& currentDamageSound : _damageSounds)
+            for (auto& currentDamageSound : archetype.DamageSounds)
             {
-                if (currentDamageSound.damageType == sounds.DamageType &&
-                    currentDamageSound.materialType == sounds.MaterialType)
+                if (currentDamageSound.DamageType == sounds.DamageType &&
+                    currentDamageSound.MaterialType == sounds.MaterialType)
                 {
-                    currentDamageSound.sounds.AddSounds(sounds.Sounds);
+                    currentDamageSound.Sounds.AddSounds(sounds.Sounds);
                     foundMatch = true;
                     break;
                 }
@@ -1287,11 +1335,11 @@ namespace Dwarf
 
             if (!foundMatch)
             {
-                damageSoundSet newSet;
-                newSet.damageType = sounds.DamageType;
-                newSet.materialType = sounds.MaterialType;
-                newSet.sounds.AddSounds(sounds.Sounds);
-                _damageSounds.push_back(newSet);
+                CharacterArchetype::DamageSoundSet newSet;
+                newSet.DamageType = sounds.DamageType;
+                newSet.MaterialType = sounds.MaterialType;
+                newSet.Sounds.AddSounds(sounds.Sounds);
+                archetype.DamageSounds.push_back(newSet);
             }
         }
 
@@ -1305,17 +1353,17 @@ namespace Dwarf
 
         void BasicCharacter::AddHealingSounds(const Audio::SoundPathVector& sounds)
         {
-            _healingSounds.AddSounds(sounds);
+            editArchetype().HealingSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddBaseFootstepSounds(const Audio::SoundPathVector& sounds)
         {
-            _baseFootstepSounds.AddSounds(sounds);
+            editArchetype().BaseFootstepSounds.AddSounds(sounds);
         }
 
         void BasicCharacter::AddTerrainFootstepSounds(Pathfinding::TerrainType terrainType, const Audio::SoundPathVector& sounds)
         {
-            _terrainFootstepSounds[terrainType].AddSounds(sounds);
+            editArchetype().TerrainFootstepSounds[terrainType].AddSounds(sounds);
         }
 
         void BasicCharacter::SetFootstepVolumeRange(float minVolume, float maxVolume)
@@ -1366,15 +1414,6 @@ namespace Dwarf
             _bodyMaterial = material;
         }
 
-        void BasicCharacter::OnScaleChange(float oldScale, float newScale)
-        {
-            SkeletonCharacter::OnScaleChange(oldScale, newScale);
-            for (auto& damageParticles : _damageParticles)
-            {
-                damageParticles.particles->SetScale(newScale);
-            }
-        }
-
         Damage BasicCharacter::OnPreRecieveDamage(Character* source, const Vector2f& pos, const Damage& dmg)
         {
             return dmg;
@@ -1382,26 +1421,29 @@ namespace Dwarf
 
         void BasicCharacter::OnPostRecieveDamage(Character* source, const Vector2f& position, const ResolvedDamage& dmg)
         {
+            Wake();
+
             if (dmg.Amount > 0.0f)
             {
-                for (const auto& damageParticles : _damageParticles)
+                for (const auto& damageParticles : _archetype->DamagedParticles)
                 {
-                    if ((dmg.Type & damageParticles.damageType) != 0)
+                    if ((dmg.Type & damageParticles.DamageType) != 0 && _particleEffects)
                     {
                         Animation::SkeletonInstance* skeleton = GetSkeleton();
 
                         Vector2f particleSpawnPos;
-                        if (skeleton->HasJoint(damageParticles.spawnJoint))
+                        if (skeleton->HasJoint(damageParticles.SpawnJoint))
                         {
-                            particleSpawnPos = skeleton->GetJointPosition(damageParticles.spawnJoint);
+                            particleSpawnPos = skeleton->GetJointPosition(damageParticles.SpawnJoint);
                         }
                         else
                         {
                             particleSpawnPos = position;
                         }
 
-                        damageParticles.particles->SetPointSpawner(particleSpawnPos);
-                        damageParticles.particles->Burst();
+                        Graphics::ParticleBurst burst;
+                        burst.Scale = GetScale();
+                        _particleEffects->Burst(GetLevelLayer(), damageParticles.Path, particleSpawnPos, burst);
                     }
                 }
 
@@ -1412,24 +1454,21 @@ namespace Dwarf
                 // Find a sound to play
                 std::vector<Item::Armor*> armors = GetArmors();
                 MaterialType material = armors.empty() ? GetBodyMaterial() : armors.front()->GetMaterial();
-                for (auto& damageSound : _damageSounds)
+                for (const auto& damageSound : _archetype->DamageSounds)
                 {
-                    if ((damageSound.damageType & dmg.Type) != 0 &&
-                        (damageSound.materialType & material) != 0)
+                    if ((damageSound.DamageType & dmg.Type) != 0 &&
+                        (damageSound.MaterialType & material) != 0)
                     {
-                        auto soundManager = GetLevel()->GetSoundManager();
-
                         float damageSoundVolume = dmg.Critical ? DamageCriticalSoundVolume : DamageSoundVolume;
-                        soundManager->PlaySinglePositionalSound(damageSound.sounds.GetNextSound(), Audio::SoundPriority::Medium,
-                                                                position, DamageHealingSoundRange.first, DamageHealingSoundRange.second,
-                                                                damageSoundVolume);
+                        Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Damage, damageSound.Sounds.GetNextSound(), Audio::SoundPriority::Medium,
+                                              position, DamageHealingSoundRange.first, DamageHealingSoundRange.second, damageSoundVolume);
                         break;
                     }
                 }
             }
 
             uint32_t dmgTextSize = dmg.Critical ? OverheadTextFontCriticalSize : OverheadTextFontSize;
-            AddOverheadText(Graphics::PreparedText(Format("%i", static_cast<int32_t>(dmg.Amount)), _damageFont, dmgTextSize, Color::White, false, false));
+            AddOverheadText(Graphics::PreparedText(Format("%i", static_cast<int32_t>(dmg.Amount)), _archetype->DamageFont, dmgTextSize, Color::White, false, false));
 
             // Attack the attacker if idle
             if (source != nullptr && IsAlive() && GetCurrentState() == CharacterState_Idle)
@@ -1455,9 +1494,9 @@ namespace Dwarf
 
         float BasicCharacter::OnPreInteractWithCharacter(Character* target)
         {
-            if (_interactAnimations.Count() > 0)
+            if (_archetype->InteractAnimations.Count() > 0)
             {
-                return PlayAnimationSet(_interactAnimations, false, 0.1f, 0.0f);
+                return PlayAnimationSet(_archetype->InteractAnimations, false, 0.1f, 0.0f);
             }
             else
             {
@@ -1467,9 +1506,9 @@ namespace Dwarf
 
         float BasicCharacter::OnPreInteractWithItem(Item::Item* target)
         {
-            if (_interactAnimations.Count() > 0)
+            if (_archetype->InteractAnimations.Count() > 0)
             {
-                return PlayAnimationSet(_interactAnimations, false, 0.1f, 0.0f);
+                return PlayAnimationSet(_archetype->InteractAnimations, false, 0.1f, 0.0f);
             }
             else
             {
@@ -1481,18 +1520,17 @@ namespace Dwarf
         {
             if (ammount > 0.0f)
             {
-                AddOverheadText(Graphics::PreparedText(Format("%i", static_cast<int32_t>(ammount)), _healingFont, OverheadTextFontSize, 
+                AddOverheadText(Graphics::PreparedText(Format("%i", static_cast<int32_t>(ammount)), _archetype->HealingFont, OverheadTextFontSize, 
                                                        Color::White, false, false));
 
                 auto soundManager = GetLevel()->GetSoundManager();
-                soundManager->PlaySinglePositionalSound(_healingSounds.GetNextSound(), Audio::SoundPriority::Medium,
+                soundManager->PlaySinglePositionalSound(_archetype->HealingSounds.GetNextSound(), Audio::SoundPriority::Medium,
                                                         GetPosition(), DamageHealingSoundRange.first, DamageHealingSoundRange.second,
                                                         HealingSoundVolume);
 
-                if (_healParticles)
+                if (_particleEffects && !_archetype->HealParticlesPath.empty())
                 {
-                    Particles::FitParticlesToSkeleton(_healParticles, GetSkeleton());
-                    _healParticles->Burst();
+                    _particleEffects->Burst(GetLevelLayer(), _archetype->HealParticlesPath, GetSkeleton());
                 }
             }
         }
@@ -1511,8 +1549,15 @@ namespace Dwarf
             }
         }
 
+        uint32_t BasicCharacter::GetEquipmentRevision() const
+        {
+            return _equipmentRevision;
+        }
+
         void BasicCharacter::OnEquipItem(Item::Item* item)
         {
+            invalidateItemIndices();
+
             if (item->GetSlot() == +Item::ItemSlot::Weapon)
             {
                 assignWeapons();
@@ -1521,12 +1566,20 @@ namespace Dwarf
 
         void BasicCharacter::OnUnequipItem(Item::Item* item)
         {
+            invalidateItemIndices();
+
             if (item->GetSlot() == +Item::ItemSlot::Weapon)
             {
                 assignWeapons();
             }
         }
 
+        void BasicCharacter::invalidateItemIndices()
+        {
+            _itemIndices.clear();
+            _equipmentRevision++;
+        }
+
         const Animation::AnimationSet& BasicCharacter::getTerrainAnimation(AnimationType type, Pathfinding::EdgeType edgeType,
                                                                            Pathfinding::TerrainType terrainType, float angle,
                                                                            AnimationVariant variant) const
@@ -1534,8 +1587,8 @@ namespace Dwarf
             static const Animation::AnimationSet DefaultEmptyAnimationSet;
 
             // Animation type and edge type require a specific animation, can't fall back
-            terrainAnimations::const_iterator animationTypeIter = _terrainAnimations.find(type);
-            if (animationTypeIter == _terrainAnimations.end())
+            CharacterArchetype::TerrainAnimationMap::const_iterator animationTypeIter = _archetype->TerrainAnimations.find(type);
+            if (animationTypeIter == _archetype->TerrainAnimations.end())
             {
                 return DefaultEmptyAnimationSet;
             }
@@ -1620,11 +1673,11 @@ namespace Dwarf
 
         void BasicCharacter::lookAt(const Vector2f& position, bool forced)
         {
-            if (_headName.size() > 0)
+            if (_archetype->HeadName.size() > 0)
             {
                 if (forced || !_hasForcedLookPos)
                 {
-                    GetSkeleton()->PointJointAt(_headName, position, _headRotationSpeed);
+                    GetSkeleton()->PointJointAt(_archetype->HeadName, position, _headRotationSpeed);
                     _hasForcedLookPos = forced;
                 }
             }
@@ -1632,11 +1685,11 @@ namespace Dwarf
 
         void BasicCharacter::lookTo(const Vector2f& direction, bool forced)
         {
-            if (_headName.size() > 0)
+            if (_archetype->HeadName.size() > 0)
             {
                 if (forced || !_hasForcedLookPos)
                 {
-                    GetSkeleton()->PointJointTo(_headName, direction, _headRotationSpeed);
+                    GetSkeleton()->PointJointTo(_archetype->HeadName, direction, _headRotationSpeed);
                     _hasForcedLookPos = forced;
                 }
             }
@@ -1644,11 +1697,11 @@ namespace Dwarf
 
         void BasicCharacter::stopLooking(bool forced)
         {
-            if (_headName.size() > 0)
+            if (_archetype->HeadName.size() > 0)
             {
                 if (forced == _hasForcedLookPos)
                 {
-                    GetSkeleton()->StopPointingJoint(_headName, _headRotationSpeed);
+                    GetSkeleton()->StopPointingJoint(_archetype->HeadName, _headRotationSpeed);
                     _hasForcedLookPos = false;
                 }
             }
@@ -1657,33 +1710,37 @@ namespace Dwarf
         void BasicCharacter::assignWeapons()
         {
             // Clear attachments
-            for (auto& weapAttachment : _weaponAttachmentLocations)
+            _weaponAttachmentStates.clear();
+
+            static const std::vector<std::string> NoAttachmentLocations;
+            const auto& attachmentTypes = _archetype->WeaponAttachmentTypes;
+            auto getAttachmentLocations = [&](Item::WeaponType type) -> const std::vector<std::string>&
             {
-                weapAttachment.second.equippedWeaponType = Item::WeaponType_None;
-                weapAttachment.second.equippedWeapon = 0;
-            }
+                auto iter = attachmentTypes.find(type);
+                return iter != attachmentTypes.end() ? iter->second : NoAttachmentLocations;
+            };
 
             // Grab weapons
             std::vector<Item::Weapon*> weapons = GetWeapons();
 
             // Sort weapons by the number of viable locations they can fit, this makes sure that shields
             // and other items that only fit in one place get the first choice.
-            std::sort(weapons.begin(), weapons.end(), [this](const Item::Weapon* a, const Item::Weapon* b)
+            std::sort(weapons.begin(), weapons.end(), [&](const Item::Weapon* a, const Item::Weapon* b)
             {
-                return _weaponAttachmentTypes[a->GetWeaponType()].size() < _weaponAttachmentTypes[b->GetWeaponType()].size();
+                return getAttachmentLocations(a->GetWeaponType()).size() < getAttachmentLocations(b->GetWeaponType()).size();
             });
 
             // Assign weapons
             for (Item::Weapon* weap : weapons)
             {
                 Item::WeaponType type = weap->GetWeaponType();
-                const auto& attachmentLocations = _weaponAttachmentTypes[type];
+                const auto& attachmentLocations = getAttachmentLocations(type);
                 for (const auto& location : attachmentLocations)
                 {
-                    auto& attachmentLocation = _weaponAttachmentLocations[location];
+                    auto& attachmentLocation = _weaponAttachmentStates[location];
                     if (attachmentLocation.equippedWeaponType == Item::WeaponType_None)
                     {
-                        weap->SetAttachPoint(attachmentLocation.jointNames[type]);
+                        weap->SetAttachPoint(_archetype->WeaponAttachments.at(location).JointNames.at(type));
                         attachmentLocation.equippedWeaponType = type;
                         attachmentLocation.equippedWeapon = weap->GetID();
                         break;
@@ -1694,15 +1751,108 @@ namespace Dwarf
 
         Vector2f BasicCharacter::GetLineOfSightPoint() const
         {
-            if (_headName.empty())
+            if (_archetype->HeadName.empty())
             {
                 return SkeletonCharacter::GetLineOfSightPoint();
             }
             else
             {
-                return GetSkeleton()->GetJointPosition(_headName);
+                return GetSkeleton()->GetJointPosition(_archetype->HeadName);
+            }
+        }
+
+        void BasicCharacter::BuildArchetype(const std::string& name, std::function<void()> buildFunc)
+        {
+            assert(_baseArchetype == nullptr);
+            _archetypeKey = _archetypeKey.empty() ? name : _archetypeKey + "/" + name;
+
+            if (_privateArchetype)
+            {
+                buildFunc();
+                return;
+            }
+
+            if (_archetypeCache)
+            {
+                std::shared_ptr<CharacterArchetype> cached = _archetypeCache->Find(_archetypeKey);
+                if (cached)
+                {
+                    _archetype = cached;
+                    return;
+                }
+            }
+
+            _archetype = std::make_shared<CharacterArchetype>(*_archetype);
+
+            _buildingArchetype = true;
+            buildFunc();
+            _buildingArchetype = false;
+
+            if (_archetypeCache)
+            {
+                _archetypeCache->Register(_archetypeKey, _archetype);
             }
         }
+
+        void BasicCharacter::UseArchetypeVariant(const std::string& variant, std::function<void()> buildFunc)
+        {
+            // Nothing to share with, the edits are made to the instance's own archetype
+            if (_privateArchetype || !_archetypeCache)
+            {
+                buildFunc();
+                return;
+            }
+
+            if (_baseArchetype == nullptr)
+            {
+                _baseArchetype = _archetype;
+            }
+
+            const std::string key = _archetypeKey + "#" + variant;
+            std::shared_ptr<CharacterArchetype> archetype = _archetypeCache->Find(key);
+            if (archetype == nullptr)
+            {
+                archetype = std::make_shared<CharacterArchetype>(*_baseArchetype);
+
+                std::shared_ptr<CharacterArchetype> previous = _archetype;
+                _archetype = archetype;
+                _buildingArchetype = true;
+                buildFunc();
+                _buildingArchetype = false;
+                _archetype = previous;
+
+                _archetypeCache->Register(key, archetype);
+            }
+
+            if (archetype != _archetype)
+            {
+                if (_archetypeContentManager)
+                {
+                    archetype->LoadContent(_archetypeContentManager);
+                    _archetypeCache->KeepContentLoaded(archetype, _archetypeContentManager);
+                    _archetype->UnloadContent();
+                }
+                _archetype = archetype;
+            }
+        }
+
+        CharacterArchetype& BasicCharacter::editArchetype()
+        {
+            if (!_buildingArchetype && !_privateArchetype)
+            {
+                // Copy on write, other instances of this type keep using the shared archetype
+                std::shared_ptr<CharacterArchetype> archetype = std::make_shared<CharacterArchetype>(*_archetype);
+                if (_archetypeContentManager)
+                {
+                    archetype->LoadContent(_archetypeContentManager);
+                    _archetype->UnloadContent();
+                }
+                _archetype = archetype;
+                _privateArchetype = true;
+            }
+
+            return *_archetype;
+        }
     }
 
     template <>
@@ -1713,7 +1863,6 @@ namespace Dwarf
         preloads.insert("Fonts/hud_font.ttf");
         preloads.insert("HUD/emotes.hudmatset");
 
-        preloads.insert(Character::DamageFontPath);
-        preloads.insert(Character::HealingFontPath);
+        EnumeratePreloads<Character::CharacterArchetype>(preloads);
     }
 }
@@ -1,17 +1,24 @@
 #pragma once
 
 #include "Characters/SkeletonCharacter.hpp"
+#include "Characters/CharacterArchetype.hpp"
+#include "Characters/TargetIndex.hpp"
 
 #include "SoundSet.hpp"
 #include "Characters/DamageSounds.hpp"
 #include "EmoteTypes.hpp"
 
+#include <functional>
+#include <memory>
+#include <typeindex>
+
 namespace Dwarf
 {
     namespace Graphics
     {
         class OverheadTextDisplay;
         class EmoteDisplay;
+        class ParticleEffectManager;
     }
 
     namespace Particles
@@ -19,13 +26,14 @@ namespace Dwarf
         class ParticleSystem;
         class ParticleSystemInstance;
     }
+
+    namespace Level
+    {
+        class BasicLevel;
+    }
     namespace Character
     {
-        enum AnimationType
-        {
-            AnimationType_Idle = 0,
-            AnimationType_Move = 1,
-        };
+        class StatusEffectManager;
 
         class BasicCharacter : public SkeletonCharacter
         {
@@ -66,7 +74,27 @@ namespace Dwarf
 
             void SetWeaponAlpha(float alpha, float time);
 
+            // Equipped items or weapons implementing T. The result is built on the first query and kept until the
+            // equipment changes, prefer these over GetItems<T>/GetWeapons<T> for queries made every frame. The returned
+            // vector is invalidated by equipping or unequipping an item.
+            template <typename T>
+            const std::vector<T*>& GetIndexedItems() const;
+            template <typename T>
+            const std::vector<T*>& GetIndexedWeapons() const;
+
+            // Incremented whenever an item is equipped or unequipped, for caching values derived from the equipment
+            uint32_t GetEquipmentRevision() const;
+
         protected:
+            // Configuration made inside buildFunc is shared by every character built with the same chain of archetype
+            // names, buildFunc is only run for the first one. Configuration made outside of it is private to the instance.
+            void BuildArchetype(const std::string& name, std::function<void()> buildFunc);
+
+            // Switches the instance to a shared variant of its archetype for state that changes at runtime (equipment,
+            // stances, boss phases). Variants are built from the archetype the constructors built, buildFunc only runs
+            // for the first character of the type to use the variant.
+            void UseArchetypeVariant(const std::string& variant, std::function<void()> buildFunc);
+
             void AddWeaponAttachment(const std::string& name, const std::string attachA, const std::string attachB,
                                      const std::map<Item::WeaponType, std::string>& weapTypesAttachJoints);
             void ClearWeaponAttachments();
@@ -80,7 +108,7 @@ namespace Dwarf
                 std::vector<std::string> WooshSoundTags;
             };
 
-            using AttackRange = std::pair<float, float>;
+            using AttackRange = CharacterArchetype::AttackRange;
 
             void AddAttackAnimation(const std::string& animName, float weight,
                                     const std::map<std::string, AttackAnimation>& attachments, 
@@ -141,8 +169,6 @@ namespace Dwarf
 
             void SetBodyMaterial(MaterialType material);
 
-            virtual void OnScaleChange(float oldScale, float newScale) override;
-
             virtual Damage OnPreRecieveDamage(Character* source, const Vector2f& pos, const Damage& dmg) override;
             virtual void OnPostRecieveDamage(Character* source, const Vector2f& position, const ResolvedDamage& dmg) override;
 
@@ -171,6 +197,10 @@ namespace Dwarf
 
             virtual void OnUpdate(double totalTime, float dt) override;
 
+            virtual void OnParallelUpdate(double totalTime, float dt, CharacterCommandBuffer& commands) override;
+
+            virtual bool IsIdle() const override;
+
             virtual void OnDraw(Graphics::LevelRenderer* levelRenderer) const override;
 
             void DoDeathRagdoll(bool forcedPhysics);
@@ -179,6 +209,7 @@ namespace Dwarf
             virtual Vector2f GetDeathImpulse(const Physics::Collision* collision) const;
 
         private:
+            Character* findAggroTarget(float range);
             void aggroNearbyFriendlies(const Character* target) const;
 
             Vector2f getDeathPosition() const;
@@ -197,122 +228,73 @@ namespace Dwarf
             void updateMoveAnimation();
             void updateIdleAnimation();
 
+            void playFootsteps(const Vector2f& position, Pathfinding::TerrainType terrain);
+
             void assignWeapons();
 
             const Audio::SoundSet& getSoundsForSpeech(SpeechType type) const;
 
-            struct weaponAttachment
-            {
-                std::string attachA;
-                std::string attachB;
-                std::map<Item::WeaponType, std::string> jointNames;
-                Item::WeaponType equippedWeaponType;
-                Item::ItemID equippedWeapon;
-            };
-            std::map<std::string, weaponAttachment> _weaponAttachmentLocations;
-            std::map<Item::WeaponType, std::vector<std::string>> _weaponAttachmentTypes;
+            CharacterArchetype& editArchetype();
+
+            // Set when spawned into a BasicLevel, saves looking the level type up every update
+            Level::BasicLevel* _basicLevel;
+
+            CharacterArchetypeCache* _archetypeCache;
+            std::shared_ptr<CharacterArchetype> _archetype;
+            std::shared_ptr<CharacterArchetype> _baseArchetype;
+            std::string _archetypeKey;
+            bool _buildingArchetype;
+            bool _privateArchetype;
+            Content::ContentManager* _archetypeContentManager;
 
-            struct attackAnimationRequirements
+            struct weaponAttachmentState
             {
-                std::map<std::string, Item::WeaponType> requiredAttachments;
-                std::map<std::string, float> animationWeights;
-                std::map<std::string, std::map<std::string, std::vector<std::pair<std::string, std::string>>>> animationDmgRanges;
-                std::map<std::string, std::map<std::string, std::vector<std::string>>> animationDmgResetTags;
-                std::map<std::string, std::map<std::string, std::vector<std::string>>> animationAttackSoundTags;
-                std::map<std::string, std::map<std::string, std::vector<std::string>>> animationWooshSoundTags;
-                std::map<std::string, AttackRange> animationRanges;
+                Item::WeaponType equippedWeaponType = Item::WeaponType_None;
+                Item::ItemID equippedWeapon = 0;
             };
-            std::vector<attackAnimationRequirements> _attackAnimations;
+            std::map<std::string, weaponAttachmentState> _weaponAttachmentStates;
 
             std::unordered_map<Item::ItemID, std::vector<std::pair<std::string, std::string>>> _curDmgRangeTags;
             std::unordered_map<Item::ItemID, std::vector<std::string>> _curDmgResetTags;
             std::set<std::string> _curAttackSoundTags;
             std::map<std::string, Item::WeaponType> _curWooshSoundTags;
 
-            std::string _mouthName;
-            std::string _headName;
             float _headRotationSpeed;
             bool _hasForcedLookPos;
 
-            std::vector<std::string> _mainArmNames;
-            std::vector<std::string> _offArmNames;
             float _armRotationSpeed;
 
-            struct damageParticles
-            {
-                DamageType damageType = 0;
-                std::string path = "";
-                Particles::ParticleSystemInstance* particles = nullptr;
-                std::string spawnJoint = "";
-            };
-            std::vector<damageParticles> _damageParticles;
-            
-            std::string _healParticlesPath = "";
-            Particles::ParticleSystemInstance* _healParticles = nullptr;
-
-            std::string _runParticleSystemPath;
-            const Particles::ParticleSystem* _runParticles;
-            std::vector<std::string> _runParticleSystemTags;
-
-            struct foot
-            {
-                std::string front;
-                std::string back;
-                Particles::ParticleSystemInstance* particleSystem;
-            };
-            std::vector<foot> _feet;
+            Graphics::ParticleEffectManager* _particleEffects;
+            StatusEffectManager* _statusEffects;
+            std::vector<std::string> _loadedParticleEffects;
 
-            Audio::SoundSet _baseFootstepSounds;
-            std::map<Pathfinding::TerrainType, Audio::SoundSet> _terrainFootstepSounds;
             std::pair<float, float> _footstepVolumeRange = std::make_pair(1.0f, 1.0f);
             bool _footstepCameraShakeEnabled = false;
             float _footstepCameraShakeMagnitude = 0.0f;
             float _footstepCameraShakeFrequency = 0.0f;
 
-            std::string _jawName;
             float _remainingJawOpenDuration;
 
-            using animationVariantMap = std::map<AnimationVariant, Animation::AnimationSet>;
-            using animationAngleMap = std::map<float, animationVariantMap>;
-            using terrainTypeAnimations = std::map<Pathfinding::TerrainType, animationAngleMap>;
-            using edgeTypeAnimations = std::map<Pathfinding::EdgeType, terrainTypeAnimations>;
-            using terrainAnimations = std::map<AnimationType, edgeTypeAnimations>;
-            terrainAnimations _terrainAnimations;
-
-            Animation::AnimationSet _interactAnimations;
-            Animation::AnimationSet _deathAnimations;
-
-            Audio::SoundSet _aggroSounds;
-            Audio::SoundSet _attackSounds;
-            std::map<Item::WeaponType, Audio::SoundSet> _attackWooshSounds;
             float _attackSoundPlayChance; 
-            Audio::SoundSet _idleSounds;
             std::pair<float, float> _idleSoundTimeout = std::make_pair(10, 30);
             float _idleSoundTimer = 0.0f;
-            Audio::SoundSet _deathSounds;
-            Audio::SoundSet _affirmativeSounds;
-            Audio::SoundSet _negatorySounds;
-            Audio::SoundSet _tauntSounds;
             float _speechMinDist;
             float _speechMaxDist;
             float _speechPositionalVolume = 1.0f;
             float _speechGlobalVolume = 1.0f;
 
-            struct damageSoundSet
-            {
-                MaterialType materialType;
-                DamageType damageType;
-                Audio::SoundSet sounds;
-            };
-            std::vector<damageSoundSet> _damageSounds;
-            Audio::SoundSet _healingSounds;
-
             std::vector<std::weak_ptr<Audio::ManagedSoundInstance>> _vocalizations;
 
             MaterialType _bodyMaterial;
 
             float _aggroRange;
 
+            // Attackable characters in aggro range, closest first, that are still waiting for a line of sight test. The
+            // tests are spread over frames, candidates past the per frame budget are tested on the next frames.
+            TargetSelection<> _aggroCandidateSelection;
+            std::vector<CharacterID> _aggroCandidates;
+            uint32_t _nextAggroCandidate;
+
             float _injuredThreshold;
 
             float _physicsTime;
@@ -341,18 +323,38 @@ namespace Dwarf
             CharacterID _lastAttacker;
             Vector2f _lastDmgPos;
 
-            const Graphics::Font* _damageFont;
-            const Graphics::Font* _healingFont;
-
             Graphics::OverheadTextDisplay* _textDisplay;
             Graphics::EmoteDisplay* _emoteDisplay;
 
             float _targetWeaponAlpha = 1.0f;
             float _weaponAlphaTimer = 0.0f;
             float _weaponAlphaTotalTime = 0.0f;
+
+            void invalidateItemIndices();
+
+            struct itemIndexBase
+            {
+                virtual ~itemIndexBase() {}
+            };
+
+            template <typename T>
+            struct itemIndex : public itemIndexBase
+            {
+                std::vector<T*> items;
+            };
+
+            using itemIndexKey = std::pair<std::type_index, bool>;
+            mutable std::map<itemIndexKey, std::unique_ptr<itemIndexBase>> _itemIndices;
+            uint32_t _equipmentRevision;
         };
+
+        // Uses the owner's item index when it is a BasicCharacter, falls back to scanning the inventory otherwise
+        template <typename T>
+        const std::vector<T*>& GetIndexedWeapons(const Character* character);
     }
 
     template <>
     void EnumeratePreloads<Character::BasicCharacter>(PreloadSet& preloads);
 }
+
+#include "BasicCharacter.inl"
@@ -0,0 +1,46 @@
+namespace Dwarf
+{
+    namespace Character
+    {
+        template <typename T>
+        const std::vector<T*>& BasicCharacter::GetIndexedItems() const
+        {
+            std::unique_ptr<itemIndexBase>& index = _itemIndices[itemIndexKey(typeid(T), false)];
+            if (!index)
+            {
+                itemIndex<T>* newIndex = new itemIndex<T>();
+                newIndex->items = GetItems<T>();
+                index.reset(newIndex);
+            }
+            return static_cast<const itemIndex<T>*>(index.get())->items;
+        }
+
+        template <typename T>
+        const std::vector<T*>& BasicCharacter::GetIndexedWeapons() const
+        {
+            std::unique_ptr<itemIndexBase>& index = _itemIndices[itemIndexKey(typeid(T), true)];
+            if (!index)
+            {
+                itemIndex<T>* newIndex = new itemIndex<T>();
+                newIndex->items = GetWeapons<T>();
+                index.reset(newIndex);
+            }
+            return static_cast<const itemIndex<T>*>(index.get())->items;
+        }
+
+        template <typename T>
+        const std::vector<T*>& GetIndexedWeapons(const Character* character)
+        {
+            const BasicCharacter* basicCharacter = AsA<BasicCharacter>(character);
+            if (basicCharacter)
+            {
+                return basicCharacter->GetIndexedWeapons<T>();
+            }
+
+            // Other characters have no index, their weapons are copied into storage that the next call replaces
+            static thread_local std::vector<T*> weapons;
+            weapons = character->GetWeapons<T>();
+            return weapons;
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include "Characters/Bomb.hpp"
+#include "Audio/SoundEventScheduler.hpp"
 
 namespace Dwarf
 {
@@ -41,8 +42,8 @@ namespace Dwarf
 
                 if (!collision->GetCurrentContacts().empty())
                 {
-                    auto soundManager = GetLevel()->GetSoundManager();
-                    soundManager->PlaySinglePositionalSound(_bounceSounds.GetNextSound(), Audio::SoundPriority::Low, GetPosition(), BounceSoundRadius.first, BounceSoundRadius.second, BounceSoundVolume);
+                    Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Impact, _bounceSounds.GetNextSound(), Audio::SoundPriority::Low, GetPosition(),
+                                          BounceSoundRadius.first, BounceSoundRadius.second, BounceSoundVolume);
                 }
             }
         }
@@ -6,6 +6,7 @@
 #include "SkeletonUtility.hpp"
 #include "Item/Item.hpp"
 #include "HUD/Tooltip.hpp"
+#include "Levels/PathGraphPatcher.hpp"
 
 namespace Dwarf
 {
@@ -100,8 +101,7 @@ namespace Dwarf
 
                 if (_remainingBuildTime <= 0.0f)
                 {
-                    Pathfinding::PathSystem* pathSystem = GetLevelLayer()->GetPathSystem();
-                    _pathId = pathSystem->AddChain(_bridge->GetPathChain(), Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::Wood);
+                    _pathId = Level::AddPathChain(GetLevelLayer(), _bridge->GetPathChain(), Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::Wood);
 
                     _buildFinished = true;
                 }
@@ -389,7 +389,11 @@ namespace Dwarf
                 updateSide(_a);
                 updateSide(_b);
             }
-            _bounds = Rectanglef::Merge(updateSideSkeletons(_a), updateSideSkeletons(_b));
+            if (!_baked || GetColor() != _bakedColor)
+            {
+                _bounds = Rectanglef::Merge(updateSideSkeletons(_a), updateSideSkeletons(_b));
+                _bakedColor = GetColor();
+            }
 
             if (_pathId == Pathfinding::PathItemID_Invalid && _buildPerc >= 1.0f)
             {
@@ -429,7 +433,7 @@ namespace Dwarf
 
                 pathChain.AddPoint(_b.position);
 
-                _pathId = GetLevelLayer()->GetPathSystem()->AddChain(pathChain, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::Wood);
+                _pathId = Level::AddPathChain(GetLevelLayer(), pathChain, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::Wood);
 
                 SetEntityMask(GetEntityMask() & ~CharacterMask_Usable);
 
@@ -441,6 +445,8 @@ namespace Dwarf
 
                 makeSideStatic(_a);
                 makeSideStatic(_b);
+
+                _baked = true;
             }
         }
 
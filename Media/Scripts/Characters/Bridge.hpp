@@ -131,6 +131,10 @@ namespace Dwarf
 
             Pathfinding::PathItemID _pathId = Pathfinding::PathItemID_Invalid;
 
+            // Built bridges no longer move, their pieces are only touched again when the bridge's color changes
+            bool _baked = false;
+            Color _bakedColor;
+
             Rectanglef _bounds;
         };
     }
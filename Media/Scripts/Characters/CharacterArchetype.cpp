@@ -0,0 +1,196 @@
+#include "Characters/CharacterArchetype.hpp"
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        static const std::string DamageFontPath = "Fonts/numbers_red.spritefont";
+        static const std::string HealingFontPath = "Fonts/numbers_green.spritefont";
+
+        CharacterArchetype::CharacterArchetype()
+            : WeaponAttachments()
+            , WeaponAttachmentTypes()
+            , AttackAnimations()
+            , MouthName()
+            , HeadName()
+            , JawName()
+            , MainArmNames()
+            , OffArmNames()
+            , DamagedParticles()
+            , HealParticlesPath()
+            , RunParticlesPath()
+            , RunParticleTags()
+            , Feet()
+            , TerrainAnimations()
+            , InteractAnimations()
+            , DeathAnimations()
+            , AggroSounds()
+            , AttackSounds()
+            , AttackWooshSounds()
+            , IdleSounds()
+            , DeathSounds()
+            , AffirmativeSounds()
+            , NegatorySounds()
+            , TauntSounds()
+            , DamageSounds()
+            , HealingSounds()
+            , BaseFootstepSounds()
+            , TerrainFootstepSounds()
+            , DamageFont()
+            , HealingFont()
+            , _contentRefCount(0)
+        {
+        }
+
+        CharacterArchetype::CharacterArchetype(const CharacterArchetype& other)
+            : WeaponAttachments(other.WeaponAttachments)
+            , WeaponAttachmentTypes(other.WeaponAttachmentTypes)
+            , AttackAnimations(other.AttackAnimations)
+            , MouthName(other.MouthName)
+            , HeadName(other.HeadName)
+            , JawName(other.JawName)
+            , MainArmNames(other.MainArmNames)
+            , OffArmNames(other.OffArmNames)
+            , DamagedParticles(other.DamagedParticles)
+            , HealParticlesPath(other.HealParticlesPath)
+            , RunParticlesPath(other.RunParticlesPath)
+            , RunParticleTags(other.RunParticleTags)
+            , Feet(other.Feet)
+            , TerrainAnimations(other.TerrainAnimations)
+            , InteractAnimations(other.InteractAnimations)
+            , DeathAnimations(other.DeathAnimations)
+            , AggroSounds(other.AggroSounds)
+            , AttackSounds(other.AttackSounds)
+            , AttackWooshSounds(other.AttackWooshSounds)
+            , IdleSounds(other.IdleSounds)
+            , DeathSounds(other.DeathSounds)
+            , AffirmativeSounds(other.AffirmativeSounds)
+            , NegatorySounds(other.NegatorySounds)
+            , TauntSounds(other.TauntSounds)
+            , DamageSounds(other.DamageSounds)
+            , HealingSounds(other.HealingSounds)
+            , BaseFootstepSounds(other.BaseFootstepSounds)
+            , TerrainFootstepSounds(other.TerrainFootstepSounds)
+            , DamageFont()
+            , HealingFont()
+            , _contentRefCount(0)
+        {
+        }
+
+        bool CharacterArchetype::IsContentLoaded() const
+        {
+            return _contentRefCount > 0;
+        }
+
+        void CharacterArchetype::LoadContent(Content::ContentManager* contentManager)
+        {
+            if (_contentRefCount++ > 0)
+            {
+                return;
+            }
+
+            AggroSounds.LoadContent(contentManager);
+            AttackSounds.LoadContent(contentManager);
+            for (auto& attackWooshSound : AttackWooshSounds)
+            {
+                attackWooshSound.second.LoadContent(contentManager);
+            }
+            IdleSounds.LoadContent(contentManager);
+            DeathSounds.LoadContent(contentManager);
+            AffirmativeSounds.LoadContent(contentManager);
+            NegatorySounds.LoadContent(contentManager);
+            TauntSounds.LoadContent(contentManager);
+            for (auto& damageSound : DamageSounds)
+            {
+                damageSound.Sounds.LoadContent(contentManager);
+            }
+            HealingSounds.LoadContent(contentManager);
+
+            BaseFootstepSounds.LoadContent(contentManager);
+            for (auto& footstepSounds : TerrainFootstepSounds)
+            {
+                footstepSounds.second.LoadContent(contentManager);
+            }
+
+            DamageFont = EmplaceResource(contentManager->Load<Graphics::Font>(DamageFontPath));
+            HealingFont = EmplaceResource(contentManager->Load<Graphics::Font>(HealingFontPath));
+        }
+
+        void CharacterArchetype::UnloadContent()
+        {
+            assert(_contentRefCount > 0);
+            if (--_contentRefCount > 0)
+            {
+                return;
+            }
+
+            AggroSounds.UnloadContent();
+            AttackSounds.UnloadContent();
+            for (auto& attackWooshSound : AttackWooshSounds)
+            {
+                attackWooshSound.second.UnloadContent();
+            }
+            IdleSounds.UnloadContent();
+            DeathSounds.UnloadContent();
+            AffirmativeSounds.UnloadContent();
+            NegatorySounds.UnloadContent();
+            TauntSounds.UnloadContent();
+            for (auto& damageSound : DamageSounds)
+            {
+                damageSound.Sounds.UnloadContent();
+            }
+            HealingSounds.UnloadContent();
+
+            BaseFootstepSounds.UnloadContent();
+            for (auto& footstepSounds : TerrainFootstepSounds)
+            {
+                footstepSounds.second.UnloadContent();
+            }
+
+            DamageFont.Reset();
+            HealingFont.Reset();
+        }
+
+        CharacterArchetypeCache::CharacterArchetypeCache()
+            : _archetypes()
+            , _loadedArchetypes()
+        {
+        }
+
+        std::shared_ptr<CharacterArchetype> CharacterArchetypeCache::Find(const std::string& key) const
+        {
+            auto iter = _archetypes.find(key);
+            return (iter != _archetypes.end()) ? iter->second : nullptr;
+        }
+
+        void CharacterArchetypeCache::Register(const std::string& key, std::shared_ptr<CharacterArchetype> archetype)
+        {
+            _archetypes[key] = archetype;
+        }
+
+        void CharacterArchetypeCache::KeepContentLoaded(std::shared_ptr<CharacterArchetype> archetype, Content::ContentManager* contentManager)
+        {
+            if (_loadedArchetypes.insert(archetype).second)
+            {
+                archetype->LoadContent(contentManager);
+            }
+        }
+
+        void CharacterArchetypeCache::Clear()
+        {
+            for (auto& archetype : _loadedArchetypes)
+            {
+                archetype->UnloadContent();
+            }
+            _loadedArchetypes.clear();
+            _archetypes.clear();
+        }
+    }
+
+    template <>
+    void EnumeratePreloads<Character::CharacterArchetype>(PreloadSet& preloads)
+    {
+        preloads.insert(Character::DamageFontPath);
+        preloads.insert(Character::HealingFontPath);
+    }
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Characters/SkeletonCharacter.hpp"
+#include "Characters/DamageSounds.hpp"
+
+#include "SoundSet.hpp"
+
+#include <memory>
+#include <set>
+#include <unordered_map>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        enum AnimationType
+        {
+            AnimationType_Idle = 0,
+            AnimationType_Move = 1,
+        };
+
+        // Configuration shared by every instance of a character type: animations, weapon attachments, sounds and
+        // particle paths. Content is loaded by the first instance that loads and released by the last one to unload.
+        class CharacterArchetype
+        {
+        public:
+            CharacterArchetype();
+            CharacterArchetype(const CharacterArchetype& other);
+
+            bool IsContentLoaded() const;
+            void LoadContent(Content::ContentManager* contentManager);
+            void UnloadContent();
+
+            using AttackRange = std::pair<float, float>;
+
+            struct WeaponAttachment
+            {
+                std::string AttachA;
+                std::string AttachB;
+                std::map<Item::WeaponType, std::string> JointNames;
+            };
+            std::map<std::string, WeaponAttachment> WeaponAttachments;
+            std::map<Item::WeaponType, std::vector<std::string>> WeaponAttachmentTypes;
+
+            struct AttackAnimationRequirements
+            {
+                std::map<std::string, Item::WeaponType> RequiredAttachments;
+                std::map<std::string, float> AnimationWeights;
+                std::map<std::string, std::map<std::string, std::vector<std::pair<std::string, std::string>>>> AnimationDmgRanges;
+                std::map<std::string, std::map<std::string, std::vector<std::string>>> AnimationDmgResetTags;
+                std::map<std::string, std::map<std::string, std::vector<std::string>>> AnimationAttackSoundTags;
+                std::map<std::string, std::map<std::string, std::vector<std::string>>> AnimationWooshSoundTags;
+                std::map<std::string, AttackRange> AnimationRanges;
+            };
+            std::vector<AttackAnimationRequirements> AttackAnimations;
+
+            std::string MouthName;
+            std::string HeadName;
+            std::string JawName;
+            std::vector<std::string> MainArmNames;
+            std::vector<std::string> OffArmNames;
+
+            struct DamageParticles
+            {
+                Character::DamageType DamageType = 0;
+                std::string Path = "";
+                std::string SpawnJoint = "";
+            };
+            std::vector<DamageParticles> DamagedParticles;
+            std::string HealParticlesPath;
+
+            std::string RunParticlesPath;
+            std::vector<std::string> RunParticleTags;
+
+            struct Foot
+            {
+                std::string Front;
+                std::string Back;
+            };
+            std::vector<Foot> Feet;
+
+            using AnimationVariantMap = std::map<AnimationVariant, Animation::AnimationSet>;
+            using AnimationAngleMap = std::map<float, AnimationVariantMap>;
+            using TerrainTypeAnimations = std::map<Pathfinding::TerrainType, AnimationAngleMap>;
+            using EdgeTypeAnimations = std::map<Pathfinding::EdgeType, TerrainTypeAnimations>;
+            using TerrainAnimationMap = std::map<AnimationType, EdgeTypeAnimations>;
+            TerrainAnimationMap TerrainAnimations;
+
+            Animation::AnimationSet InteractAnimations;
+            Animation::AnimationSet DeathAnimations;
+
+            Audio::SoundSet AggroSounds;
+            Audio::SoundSet AttackSounds;
+            std::map<Item::WeaponType, Audio::SoundSet> AttackWooshSounds;
+            Audio::SoundSet IdleSounds;
+            Audio::SoundSet DeathSounds;
+            Audio::SoundSet AffirmativeSounds;
+            Audio::SoundSet NegatorySounds;
+            Audio::SoundSet TauntSounds;
+
+            struct DamageSoundSet
+            {
+                Character::MaterialType MaterialType;
+                Character::DamageType DamageType;
+                Audio::SoundSet Sounds;
+            };
+            std::vector<DamageSoundSet> DamageSounds;
+            Audio::SoundSet HealingSounds;
+
+            Audio::SoundSet BaseFootstepSounds;
+            std::map<Pathfinding::TerrainType, Audio::SoundSet> TerrainFootstepSounds;
+
+            ResourcePointer<const Graphics::Font> DamageFont;
+            ResourcePointer<const Graphics::Font> HealingFont;
+
+        private:
+            uint32_t _contentRefCount;
+        };
+
+        // Archetypes are keyed by the chain of names passed to BasicCharacter::BuildArchetype, owned by the level so that
+        // they never outlive its content manager. Archetypes are kept until the level unloads, also when no instance
+        // uses them, so that the next wave of a character type is neither built nor loaded again.
+        class CharacterArchetypeCache : public NonCopyable
+        {
+        public:
+            CharacterArchetypeCache();
+
+            std::shared_ptr<CharacterArchetype> Find(const std::string& key) const;
+            void Register(const std::string& key, std::shared_ptr<CharacterArchetype> archetype);
+
+            // Holds a reference to the content of the archetype until the cache is cleared
+            void KeepContentLoaded(std::shared_ptr<CharacterArchetype> archetype, Content::ContentManager* contentManager);
+
+            void Clear();
+
+        private:
+            std::unordered_map<std::string, std::shared_ptr<CharacterArchetype>> _archetypes;
+            std::set<std::shared_ptr<CharacterArchetype>> _loadedArchetypes;
+        };
+    }
+
+    template <>
+    void EnumeratePreloads<Character::CharacterArchetype>(PreloadSet& preloads);
+}
@@ -0,0 +1,95 @@
+#include "Characters/CharacterCommandBuffer.hpp"
+#include "Level/LevelInstance.hpp"
+#include "Level/LevelLayerInstance.hpp"
+
+#include <algorithm>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        CharacterCommandBuffer::CharacterCommandBuffer()
+            : _commands()
+            , _layer(nullptr)
+            , _source()
+        {
+        }
+
+        void CharacterCommandBuffer::SetSource(Level::LevelLayerInstance* layer, CharacterID source)
+        {
+            _layer = layer;
+            _source = source;
+        }
+
+        void CharacterCommandBuffer::PlaySinglePositionalSound(Audio::SoundCategory category, const Audio::SoundSet& sounds, Audio::SoundPriority priority,
+                                                               const Vector2f& position, float minDistance, float maxDistance, float volume)
+        {
+            const Audio::SoundSet* soundSet = &sounds;
+            addCommand([=](Level::LevelInstance* level)
+            {
+                Audio::PlaySoundEvent(level, category, soundSet->GetNextSound(), priority, position, minDistance, maxDistance, volume);
+            });
+        }
+
+        void CharacterCommandBuffer::Call(std::function<void()> func)
+        {
+            addCommand([func](Level::LevelInstance*)
+            {
+                func();
+            });
+        }
+
+        bool CharacterCommandBuffer::IsEmpty() const
+        {
+            return _commands.empty();
+        }
+
+        void CharacterCommandBuffer::Clear()
+        {
+            _commands.clear();
+        }
+
+        void CharacterCommandBuffer::Execute(Level::LevelInstance* level)
+        {
+            Execute(level, { this });
+        }
+
+        void CharacterCommandBuffer::Execute(Level::LevelInstance* level, const std::vector<CharacterCommandBuffer*>& buffers)
+        {
+            // A character is only ever updated by one thread, so its commands are all in one buffer in recording order
+            std::vector<const command*> commands;
+            for (const CharacterCommandBuffer* buffer : buffers)
+            {
+                for (const command& cmd : buffer->_commands)
+                {
+                    commands.push_back(&cmd);
+                }
+            }
+            std::sort(commands.begin(), commands.end(), [](const command* a, const command* b)
+            {
+                return a->source != b->source ? a->source < b->source : a->sequence < b->sequence;
+            });
+
+            for (const command* cmd : commands)
+            {
+                cmd->execute(level);
+            }
+
+            for (CharacterCommandBuffer* buffer : buffers)
+            {
+                buffer->Clear();
+            }
+        }
+
+        void CharacterCommandBuffer::addCommand(std::function<void(Level::LevelInstance*)> execute)
+        {
+            assert(_layer != nullptr);
+
+            command cmd;
+            cmd.source = _source;
+            cmd.sequence = static_cast<uint32_t>(_commands.size());
+            cmd.execute = std::move(execute);
+            _commands.push_back(std::move(cmd));
+        }
+    }
+}
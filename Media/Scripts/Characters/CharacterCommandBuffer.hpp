@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Character/Character.hpp"
+#include "Audio/SoundEventScheduler.hpp"
+#include "Audio/SoundManager.hpp"
+#include "Level/LevelTypes.hpp"
+#include "SoundSet.hpp"
+#include "NonCopyable.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        // Records the side effects a character's parallel update has on the rest of the level so that they can be
+        // applied on the main thread once every character has finished. Commands are executed ordered by the character
+        // that recorded them and then by the order they were recorded in, which keeps the result independent of how
+        // the characters were split between threads.
+        class CharacterCommandBuffer : public NonCopyable
+        {
+        public:
+            CharacterCommandBuffer();
+
+            // Sets the character that following commands are recorded for
+            void SetSource(Level::LevelLayerInstance* layer, CharacterID source);
+
+            // The sound is picked from the set when the command is executed and scheduled with the level's sound events
+            void PlaySinglePositionalSound(Audio::SoundCategory category, const Audio::SoundSet& sounds, Audio::SoundPriority priority,
+                                           const Vector2f& position, float minDistance, float maxDistance, float volume);
+
+            // Any other work that has to run on the main thread
+            void Call(std::function<void()> func);
+
+            bool IsEmpty() const;
+            void Clear();
+
+            void Execute(Level::LevelInstance* level);
+            static void Execute(Level::LevelInstance* level, const std::vector<CharacterCommandBuffer*>& buffers);
+
+        private:
+            struct command
+            {
+                CharacterID source;
+                uint32_t sequence;
+                std::function<void(Level::LevelInstance*)> execute;
+            };
+
+            void addCommand(std::function<void(Level::LevelInstance*)> execute);
+
+            std::vector<command> _commands;
+            Level::LevelLayerInstance* _layer;
+            CharacterID _source;
+        };
+    }
+}
@@ -1,6 +1,8 @@
 #include "Characters/Checkpoint.hpp"
 
 #include "Drawables/Flame.hpp"
+#include "Drawables/FlameManager.hpp"
+#include "Levels/BasicLevel.hpp"
 #include "ContentUtility.hpp"
 
 namespace Dwarf
@@ -59,6 +61,7 @@ namespace Dwarf
             , _idleSounds(CheckpointIdleSoundPaths)
             , _curIdleSound()
             , _flames()
+            , _flameManager(nullptr)
             , _attachedSkeletons()
         {
             SetEntityMask(CharacterMask_Usable);
@@ -68,6 +71,7 @@ namespace Dwarf
 
             DisablePhysics();
             SetInvulnerable(true);
+            SetCanSleep(true);
 
             for (const auto& flameAttachPt : FlameAttachPoints)
             {
@@ -92,6 +96,8 @@ namespace Dwarf
                 return;
             }
 
+            Wake();
+
             if (_callback)
             {
                 _callback(interactor);
@@ -118,10 +124,18 @@ namespace Dwarf
         {
             SkeletonCharacter::OnLoadContent(contentManager);
 
+            Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(GetLevel());
+            _flameManager = basicLevel ? &basicLevel->GetFlameManager() : nullptr;
+
             for (auto& flame : _flames)
             {
                 flame.second->LoadContent(contentManager);
                 AttachDrawable(flame.first, flame.second.get());
+
+                if (_flameManager)
+                {
+                    _flameManager->AddFlame(flame.second.get());
+                }
             }
 
             for (const auto& skeleton : CheckpointSkeletonAttachments)
@@ -147,9 +161,15 @@ namespace Dwarf
         {
             for (auto& flame : _flames)
             {
+                if (_flameManager)
+                {
+                    _flameManager->RemoveFlame(flame.second.get());
+                }
+
                 flame.second->UnloadContent();
                 DetachDrawable(flame.first, flame.second.get());
             }
+            _flameManager = nullptr;
 
             for (auto& skeleton : _attachedSkeletons)
             {
@@ -192,6 +212,10 @@ namespace Dwarf
         void Checkpoint::OnUpdate(double totalTime, float dt)
         {
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
             if (!_state && _captureOnFirstUpdate)
             {
@@ -203,7 +227,10 @@ namespace Dwarf
             {
                 flame.second->SetPosition(skeleton->GetJointPosition(flame.first));
                 flame.second->SetScale(GetScale() * 0.75f);
-                flame.second->Update(totalTime, dt);
+                if (!_flameManager)
+                {
+                    flame.second->Update(totalTime, dt);
+                }
             }
 
             if (skeleton->GetCurrentAnimation() == CheckpointOpenAnimation &&
@@ -235,6 +262,12 @@ namespace Dwarf
             }
         }
 
+        bool Checkpoint::IsIdle() const
+        {
+            // Checkpoints captured on the first update have to get that update
+            return SkeletonCharacter::IsIdle() && (_state || !_captureOnFirstUpdate);
+        }
+
         void Checkpoint::OnDraw(Graphics::LevelRenderer* levelRenderer) const
         {
             SkeletonCharacter::OnDraw(levelRenderer);
@@ -8,6 +8,7 @@ namespace Dwarf
     namespace Graphics
     {
         class Flame;
+        class FlameManager;
     }
 
     namespace Character
@@ -30,6 +31,7 @@ namespace Dwarf
             virtual void OnDeath() override;
 
             virtual void OnUpdate(double totalTime, float dt) override;
+            virtual bool IsIdle() const override;
 
             virtual void OnDraw(Graphics::LevelRenderer* levelRenderer) const override;
 
@@ -47,6 +49,7 @@ namespace Dwarf
             std::shared_ptr<Audio::ManagedSoundInstance> _curIdleSound;
 
             std::vector<std::pair<std::string, std::shared_ptr<Graphics::Flame>>> _flames;
+            Graphics::FlameManager* _flameManager;
             std::vector<std::pair<std::string, Animation::SkeletonInstance*>> _attachedSkeletons;
         };
     }
@@ -44,6 +44,7 @@ namespace Dwarf
         {
             SetMoveType(MoveType_None);
             SetMoveSpeed(0.0f);
+            SetCanSleep(true);
 
             SetDropWeaponsOnDeath(true);
             SetDropArmorsOnDeath(true);
@@ -76,20 +77,24 @@ namespace Dwarf
                 attachJoints[type] = "";
             }
 
-            uint32_t attachIndex = 0;
+            uint32_t attachCount = 0;
             for (const auto& weaponClass : _items.Weapons)
             {
                 for (const auto& weapon : weaponClass.second)
                 {
-                    const auto& weaponCount = weapon.second != Item::InfiniteItemCount ? weapon.second : 1;
-                    for (uint32_t i = 0; i < weaponCount; i++)
-                    {
-                        AddWeaponAttachment(Format("attach%u", attachIndex), "origin", "weapon_attach", attachJoints);
-                        attachIndex++;
-                    }
+                    attachCount += weapon.second != Item::InfiniteItemCount ? weapon.second : 1;
                 }
             }
 
+            // Chests holding the same number of weapons share their attachments
+            BuildArchetype(Format("Chest%u", attachCount), [this, attachCount, &attachJoints]()
+            {
+                for (uint32_t i = 0; i < attachCount; i++)
+                {
+                    AddWeaponAttachment(Format("attach%u", i), "origin", "weapon_attach", attachJoints);
+                }
+            });
+
             SetMaxHealth(30.0f);
 
             _pickupItemSounds.AddSounds(ChestItemPickupSounds);
@@ -204,7 +209,10 @@ namespace Dwarf
 
             SetTooltip("character_lockbox_name");
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_All, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_close", 1.0f);
+            BuildArchetype("IronChest", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_All, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_close", 1.0f);
+            });
 
             _openAnimation.AddAnimation("open", 1.0f);
             _damagedAnimations.AddAnimation("hit", 1.0f);
@@ -287,6 +295,10 @@ namespace Dwarf
         void IronChest::OnUpdate(double totalTime, float dt)
         {
             Chest::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
             _glowParticles->Update(totalTime, dt);
             _glowParticles->SetLineSpawner(GetSkeleton()->GetJointPosition("particles_base"), GetSkeleton()->GetJointPosition("particles_extent"));
@@ -304,8 +316,11 @@ namespace Dwarf
             std::string anim = _openAnimation.PopNextAnimation();
             PlayAnimation(anim, false, 0.0f, instantaneous ? GetAnimationLength(anim) : 0.0f);
             ExpelItems();
-            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_All);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_All, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_open", 1.0f);
+            UseArchetypeVariant("IronChestOpen", [this]()
+            {
+                ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_All);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_All, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_open", 1.0f);
+            });
 
             _glowParticles->Start();
         }
@@ -319,7 +334,10 @@ namespace Dwarf
             SetSkeletonInvertedX(true);
 
             SetTooltip("character_wood_chest_name");
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_All, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle", 1.0f);
+            BuildArchetype("WoodChest", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_All, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle", 1.0f);
+            });
             _damagedAnimations.AddAnimation("hit", 1.0f);
         }
 
@@ -82,8 +82,11 @@ namespace Dwarf
 
             SetSkeletonRotatesWithDirection(true);
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run", 1.0f);
+            BuildArchetype("Rat", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run", 1.0f);
+            });
         }
 
         Rat::Rat(const CharacterParameters& parameters, const Splinef& followSpline)
@@ -111,8 +114,11 @@ namespace Dwarf
 
             SetSkeletonRotatesWithDirection(true);
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run", 1.0f);
+            BuildArchetype("SkeletonRat", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run", 1.0f);
+            });
         }
 
         SkeletonRat::SkeletonRat(const CharacterParameters& parameters, const Splinef& followSpline)
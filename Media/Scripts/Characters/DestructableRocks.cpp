@@ -1,6 +1,7 @@
 #include "Characters/DestructableRocks.hpp"
 
 #include "DamageTypes.hpp"
+#include "Levels/PathGraphPatcher.hpp"
 
 namespace Dwarf
 {
@@ -32,11 +33,16 @@ namespace Dwarf
             SetSkeletonJointStrength(0.0f);
 
             SetAttachToGroundOnSpawn(false);
+            SetCanSleep(true);
         }
 
         void DestructableRocks::OnUpdate(double totalTime, float dt)
         {
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
             if (_destroyed)
             {
@@ -58,16 +64,25 @@ namespace Dwarf
             }
         }
 
+        bool DestructableRocks::IsIdle() const
+        {
+            return SkeletonCharacter::IsIdle() && !_destroyed;
+        }
+
         Damage DestructableRocks::OnPreRecieveDamage(Character* source, const Vector2f& pos, const Damage& dmg)
         {
             Damage updatedDmg = SkeletonCharacter::OnPreRecieveDamage(source, pos, dmg);
 
             if ((dmg.Type & DamageType_Type_Explosion) != 0)
             {
+                // Taken before the impulse scatters the pieces
+                const Rectanglef collisionBounds = GetCollision()->GetBounds();
+
+                Wake();
                 SetSkeletonJointStrength(0.0f);
                 EnablePhysics(true);
                 ApplyRadialImpulse(GetBounds().Middle(), 1500.0f * GetCollision()->GetMass());
-                GetLevelLayer()->SetTerrainCollisionEnabled(_collisionName, false);
+                Level::SetPathCollisionEnabled(GetLevelLayer(), _collisionName, collisionBounds, false);
                 SetSkeletonCastsShadows(false);
                 _destroyed = true;
                 if (_callback)
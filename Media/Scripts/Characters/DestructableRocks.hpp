@@ -16,6 +16,7 @@ namespace Dwarf
 
         protected:
             void OnUpdate(double totalTime, float dt) override;
+            bool IsIdle() const override;
 
             Damage OnPreRecieveDamage(Character* source, const Vector2f& pos, const Damage& dmg) override;
 
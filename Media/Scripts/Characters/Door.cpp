@@ -1,6 +1,7 @@
 #include "Characters/Door.hpp"
 
 #include "ContentUtility.hpp"
+#include "Levels/PathGraphPatcher.hpp"
 
 namespace Dwarf
 {
@@ -61,6 +62,7 @@ namespace Dwarf
 
             DisablePhysics();
             SetInvulnerable(true);
+            SetCanSleep(true);
 
             for (const auto& doorHitSounds : DoorHitSoundPaths)
             {
@@ -81,8 +83,9 @@ namespace Dwarf
                 _state = open;
                 const std::string& anim = _state ? DoorOpenAnimation : DoorCloseAnimation;
                 PlayAnimation(anim, false, 0.0f, 0.0f);
-                GetLevelLayer()->SetTerrainCollisionEnabled(_collisionClosedName, !_state);
-                GetLevelLayer()->SetTerrainCollisionEnabled(_collisionOpenName, _state);
+                const Rectanglef collisionBounds = GetCollision()->GetBounds();
+                Level::SetPathCollisionEnabled(GetLevelLayer(), _collisionClosedName, collisionBounds, !_state);
+                Level::SetPathCollisionEnabled(GetLevelLayer(), _collisionOpenName, collisionBounds, _state);
 
                 SetSkeletonCastsShadows(!open);
 
@@ -155,6 +158,10 @@ namespace Dwarf
         void Door::OnUpdate(double totalTime, float dt)
         {
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
             if (IsPlayingAnimation() && HasAnimationTagJustPassed(DoorHitTag))
             {
@@ -194,6 +201,11 @@ namespace Dwarf
             _hitParticles->Update(totalTime, dt);
         }
 
+        bool Door::IsIdle() const
+        {
+            return SkeletonCharacter::IsIdle() && _hitParticles->GetParticleCount() == 0;
+        }
+
         void Door::OnDraw(Graphics::LevelRenderer* levelRenderer) const
         {
             SkeletonCharacter::OnDraw(levelRenderer);
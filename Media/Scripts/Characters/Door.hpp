@@ -34,6 +34,7 @@ namespace Dwarf
             void OnUnloadContent() override;
 
             void OnUpdate(double totalTime, float dt) override;
+            bool IsIdle() const override;
             void OnDraw(Graphics::LevelRenderer* levelRenderer) const override;
 
         private:
@@ -0,0 +1,210 @@
+#include "Characters/DormancyManager.hpp"
+#include "Characters/SkeletonCharacter.hpp"
+#include "Levels/BasicLevel.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        DormancyManager::DormancyManager(float cellSize, float viewMargin)
+            : _layers()
+            , _waking()
+            , _dormantCount(0)
+            , _cellSize(cellSize)
+            , _viewMargin(viewMargin)
+            , _enabled(true)
+        {
+            assert(_cellSize > 0.0f);
+        }
+
+        void DormancyManager::SetEnabled(bool enabled)
+        {
+            _enabled = enabled;
+        }
+
+        bool DormancyManager::IsEnabled() const
+        {
+            return _enabled;
+        }
+
+        bool DormancyManager::IsInView(Level::LevelLayerInstance* layer, const Rectanglef& bounds) const
+        {
+            return !_enabled || Rectanglef::Intersects(getViewBounds(layer), bounds);
+        }
+
+        void DormancyManager::Sleep(SkeletonCharacter* character)
+        {
+            layerSleepers* sleepers = findLayer(character->GetLevelLayer());
+            if (!sleepers)
+            {
+                _layers.push_back(layerSleepers());
+                sleepers = &_layers.back();
+                sleepers->layer = character->GetLevelLayer();
+            }
+
+            const CharacterID id = character->GetID();
+            forEachCell(character->GetBounds(), [&](cellKey key)
+            {
+                sleepers->cells[key].push_back(id);
+            });
+            _dormantCount++;
+        }
+
+        void DormancyManager::Wake(SkeletonCharacter* character)
+        {
+            layerSleepers* sleepers = findLayer(character->GetLevelLayer());
+            if (!sleepers)
+            {
+                return;
+            }
+
+            // Sleeping props do not move, so their bounds still cover the cells they were added to
+            const CharacterID id = character->GetID();
+            forEachCell(character->GetBounds(), [&](cellKey key)
+            {
+                auto iter = sleepers->cells.find(key);
+                if (iter == sleepers->cells.end())
+                {
+                    return;
+                }
+
+                std::vector<CharacterID>& ids = iter->second;
+                ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+                if (ids.empty())
+                {
+                    sleepers->cells.erase(iter);
+                }
+            });
+            _dormantCount--;
+        }
+
+        void DormancyManager::Update()
+        {
+            for (auto& sleepers : _layers)
+            {
+                if (sleepers.cells.empty())
+                {
+                    continue;
+                }
+
+                _waking.clear();
+                if (!_enabled)
+                {
+                    for (auto& cell : sleepers.cells)
+                    {
+                        _waking.insert(_waking.end(), cell.second.begin(), cell.second.end());
+                    }
+                }
+                else
+                {
+                    // Zoomed far out the view can cover more cells than there are occupied ones, walk the smaller set
+                    const Rectanglef viewBounds = getViewBounds(sleepers.layer);
+                    const int32_t minX = getCellCoordinate(viewBounds.Left());
+                    const int32_t maxX = getCellCoordinate(viewBounds.Right());
+                    const int32_t minY = getCellCoordinate(viewBounds.Top());
+                    const int32_t maxY = getCellCoordinate(viewBounds.Bottom());
+                    const uint64_t viewCellCount = static_cast<uint64_t>(maxX - minX + 1) * static_cast<uint64_t>(maxY - minY + 1);
+
+                    if (viewCellCount > sleepers.cells.size())
+                    {
+                        for (auto& cell : sleepers.cells)
+                        {
+                            const int32_t x = static_cast<int32_t>(static_cast<uint32_t>(cell.first) ^ 0x80000000u);
+                            const int32_t y = static_cast<int32_t>(static_cast<uint32_t>(cell.first >> 32) ^ 0x80000000u);
+                            if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                            {
+                                _waking.insert(_waking.end(), cell.second.begin(), cell.second.end());
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (int32_t y = minY; y <= maxY; y++)
+                        {
+                            for (int32_t x = minX; x <= maxX; x++)
+                            {
+                                auto iter = sleepers.cells.find(getCellKey(x, y));
+                                if (iter != sleepers.cells.end())
+                                {
+                                    _waking.insert(_waking.end(), iter->second.begin(), iter->second.end());
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // Waking removes the props from the cells, so they are gathered first. Props spanning several cells
+                // are gathered more than once, waking an awake prop does nothing. Terminated props have already left
+                // the cells when their content was unloaded.
+                for (CharacterID id : _waking)
+                {
+                    SkeletonCharacter* character = sleepers.layer->GetCharacter<SkeletonCharacter>(id);
+                    if (character)
+                    {
+                        character->Wake();
+                    }
+                }
+            }
+        }
+
+        uint32_t DormancyManager::GetDormantCount() const
+        {
+            return _dormantCount;
+        }
+
+        DormancyManager::cellKey DormancyManager::getCellKey(int32_t x, int32_t y) const
+        {
+            const uint64_t row = static_cast<uint32_t>(y) ^ 0x80000000u;
+            const uint64_t column = static_cast<uint32_t>(x) ^ 0x80000000u;
+            return (row << 32) | column;
+        }
+
+        int32_t DormancyManager::getCellCoordinate(float value) const
+        {
+            return static_cast<int32_t>(std::floor(value / _cellSize));
+        }
+
+        Rectanglef DormancyManager::getViewBounds(Level::LevelLayerInstance* layer) const
+        {
+            const Rectanglef viewBounds = layer->GetCamera().GetViewBounds().ToRectangle();
+            return Rectanglef(viewBounds.Position - _viewMargin, viewBounds.Size + (_viewMargin * 2.0f));
+        }
+
+        template <typename func>
+        void DormancyManager::forEachCell(const Rectanglef& bounds, func function) const
+        {
+            const int32_t minX = getCellCoordinate(bounds.Left());
+            const int32_t maxX = getCellCoordinate(bounds.Right());
+            const int32_t minY = getCellCoordinate(bounds.Top());
+            const int32_t maxY = getCellCoordinate(bounds.Bottom());
+            for (int32_t y = minY; y <= maxY; y++)
+            {
+                for (int32_t x = minX; x <= maxX; x++)
+                {
+                    function(getCellKey(x, y));
+                }
+            }
+        }
+
+        DormancyManager::layerSleepers* DormancyManager::findLayer(Level::LevelLayerInstance* layer)
+        {
+            for (auto& sleepers : _layers)
+            {
+                if (sleepers.layer == layer)
+                {
+                    return &sleepers;
+                }
+            }
+            return nullptr;
+        }
+
+        DormancyManager* GetDormancyManager(Character* character)
+        {
+            Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(character->GetLevel());
+            return basicLevel ? &basicLevel->GetDormancyManager() : nullptr;
+        }
+    }
+}
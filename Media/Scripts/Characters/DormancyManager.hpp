@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Character/Character.hpp"
+#include "Geometry/Rectangle.hpp"
+#include "Level/LevelLayerInstance.hpp"
+#include "NonCopyable.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        class SkeletonCharacter;
+
+        // Spatial hash of the bounds of sleeping props. Props put themselves to sleep once they are idle and out of
+        // view and are skipped by the update loop until the level's cameras move over them again, or until something
+        // wakes them directly (an interaction, damage or an animation request).
+        class DormancyManager : public NonCopyable
+        {
+        public:
+            DormancyManager(float cellSize, float viewMargin);
+
+            // Disabling the manager wakes every sleeping prop on the next update and keeps them awake
+            void SetEnabled(bool enabled);
+            bool IsEnabled() const;
+
+            // Whether bounds are within the padded view of the layer's camera, props in view are never put to sleep
+            bool IsInView(Level::LevelLayerInstance* layer, const Rectanglef& bounds) const;
+
+            void Sleep(SkeletonCharacter* character);
+            void Wake(SkeletonCharacter* character);
+
+            // Wakes the sleeping props that the layer cameras have moved over
+            void Update();
+
+            uint32_t GetDormantCount() const;
+
+        private:
+            using cellKey = uint64_t;
+            cellKey getCellKey(int32_t x, int32_t y) const;
+            int32_t getCellCoordinate(float value) const;
+
+            Rectanglef getViewBounds(Level::LevelLayerInstance* layer) const;
+
+            template <typename func>
+            void forEachCell(const Rectanglef& bounds, func function) const;
+
+            struct layerSleepers
+            {
+                Level::LevelLayerInstance* layer;
+                std::unordered_map<cellKey, std::vector<CharacterID>> cells;
+            };
+            layerSleepers* findLayer(Level::LevelLayerInstance* layer);
+
+            std::vector<layerSleepers> _layers;
+            std::vector<CharacterID> _waking;
+            uint32_t _dormantCount;
+
+            const float _cellSize;
+            const float _viewMargin;
+            bool _enabled;
+        };
+
+        // Level wide manager when the character's level provides one, nullptr otherwise
+        DormancyManager* GetDormancyManager(Character* character);
+    }
+}
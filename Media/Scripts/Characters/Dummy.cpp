@@ -17,20 +17,23 @@ namespace Dwarf
             SetMaxHealth(10000.0f);
             SetHealthRegeneration(10000.0f);
 
-            SetHeadName("head");
+            BuildArchetype("Dummy", [this]()
+            {
+                SetHeadName("head");
+
+                AddDamagedParticleSystem(DamageType_Element_Physical, DummyDamageParticlesPath, "");
+                AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
+            });
 
             SetSkeletonCastsShadows(false);
 
             SetSkeletonScale(1.0f);
             SetSkeletonColor(Color::White);
 
-            AddDamagedParticleSystem(DamageType_Element_Physical, DummyDamageParticlesPath, "");
-
             //AddIdleAnimation("idle1", 1.0f);
             _damagedAnimations.AddAnimation("damage", 1.0f);
 
             SetBodyMaterial(MaterialType_Type_Flesh);
-            AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
         }
 
         void Dummy::OnPostRecieveDamage(Character* attacker, const Vector2f& position, const ResolvedDamage& dmg)
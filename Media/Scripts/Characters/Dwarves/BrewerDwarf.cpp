@@ -15,7 +15,11 @@ namespace Dwarf
         BrewerDwarf::BrewerDwarf(const CharacterParameters& parameters, const DwarfInfo& info)
             : Dwarf(parameters, info, BrewerMatsetPath)
         {
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, NormalRunAnimation, 1.0f);
+            BuildArchetype("BrewerDwarf", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, NormalRunAnimation, 1.0f);
+            });
+
             SetIcon(BrewerIconMatsetPath, "class_brewer");
         }
     }
@@ -22,7 +22,11 @@ namespace Dwarf
         BuilderDwarf::BuilderDwarf(const CharacterParameters& parameters, const DwarfInfo& info)
             : Dwarf(parameters, info, BuilderMatsetPath)
         {
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, BackwardRunAnimation, 1.0f);
+            BuildArchetype("BuilderDwarf", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, BackwardRunAnimation, 1.0f);
+            });
+
             SetIcon(BuilderIconMatsetPath, "class_builder");
         }
 
@@ -121,7 +125,7 @@ namespace Dwarf
         {
             float modifier = 1.0f;
 
-            for (auto modifierItem : GetItems<Item::BuildRateModifier>())
+            for (auto modifierItem : GetIndexedItems<Item::BuildRateModifier>())
             {
                 modifier *= modifierItem->GetBuildRateMultiplier();
             }
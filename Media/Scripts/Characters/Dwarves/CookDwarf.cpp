@@ -15,7 +15,11 @@ namespace Dwarf
         CookDwarf::CookDwarf(const CharacterParameters& parameters, const DwarfInfo& info)
             : Dwarf(parameters, info, CookMatsetPath)
         {
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, ForwardRunAnimation, 1.0f);
+            BuildArchetype("CookDwarf", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, ForwardRunAnimation, 1.0f);
+            });
+
             SetIcon(CookIconMatsetPath, "class_cook");
         }
     }
@@ -247,121 +247,137 @@ namespace Dwarf
             SetSkeletonScale(info.Size);
             SetSkeletonColor(Color::White);
 
-            AddMainArmJoint("upperarma");
-            AddMainArmJoint("forearma");
-            AddMainArmJoint("handa");
-
-            AddOffArmJoint("upperarmb");
-            AddOffArmJoint("forearmb");
-            AddOffArmJoint("handb");
-
-            // Standing standard idle
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_0", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_1", 0.01f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_2", 0.01f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_3", 0.01f);
-
-            // TODO: use SIT_0 animation
-
-            // Standing incapacitated idle
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Incapacitated, "DOWN_IDLE", 1.0f);
-
-            // Standing injured idle
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Injured, "HPLOW_IDLE_0", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Injured, "HPLOW_IDLE_1", 1.0f);
-
-            // Standing injured moving
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Incapacitated, "DOWN_CRAWL", 1.0f);
-
-            // Climbing rope
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.5f,   AnimationVariant_Standard, "ROPE_CLIMB_DOWN_0", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.375f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_1", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.25f,  AnimationVariant_Standard, "ROPE_CLIMB_DOWN_2", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.125f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_3", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, 0.0f,         AnimationVariant_Standard, "ROPE_CLIMB_3", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.125f,  AnimationVariant_Standard, "ROPE_CLIMB_2", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.25f,   AnimationVariant_Standard, "ROPE_CLIMB_1", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.375f,  AnimationVariant_Standard, "ROPE_CLIMB_0", 1.0f);
-
-            // Idle rope
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.5f,   AnimationVariant_Standard, "ROPE_CLIMB_DOWN_0_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.375f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_1_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.25f,  AnimationVariant_Standard, "ROPE_CLIMB_DOWN_2_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.125f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_3_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, 0.0f,         AnimationVariant_Standard, "ROPE_CLIMB_3_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.125f,  AnimationVariant_Standard, "ROPE_CLIMB_2_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.25f,   AnimationVariant_Standard, "ROPE_CLIMB_1_IDLE", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.375f,  AnimationVariant_Standard, "ROPE_IDLE_0", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.375f,  AnimationVariant_Standard, "ROPE_IDLE_1", 0.05f);
-
-            // Climbing ladder
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Wood, -PiOver2, AnimationVariant_Standard, "LADDER_CLIMB", 1.0f);
-
-            // Idle ladder
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Wood, -PiOver2, AnimationVariant_Standard, "LADDER_IDLE_0", 1.0f);
-
-            AddInteractAnimation("INTERACT", 1.0f);
-
-            AddWeaponAttachment("main_hand", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa_back" },
-                                                                           { Item::WeaponType_Melee_Shield, "handa_front" },
-                                                                           { Item::WeaponType_Ranged_Gun_1H, "handa_back" },
-                                                                           { Item::WeaponType_Ranged_Gun_2H, "handa_back" },
-                                                                           { Item::WeaponType_Ranged_Thrown, "handa_back" }, });
-            AddWeaponAttachment("off_hand", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_1H, "handb" }, });
-
-            AddAttackAnimation("ATTACK_1H_0", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
-
-            AddAttackAnimation("ATTACK_2H_0", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
-            AddAttackAnimation("ATTACK_2H_1", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
-            AddAttackAnimation("ATTACK_2H_2", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
-            AddAttackAnimation("ATTACK_2H_3", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
-            AddAttackAnimation("ATTACK_2H_4", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh0", } } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
-
-            AddAttackAnimation("ATTACK_SH_0", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
-            AddAttackAnimation("ATTACK_SH_1", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
-            AddAttackAnimation("ATTACK_SH_2", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H,     {}, {}, {} } } });
-            AddAttackAnimation("ATTACK_SH_3", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
-            AddAttackAnimation("ATTACK_SH_4", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start0", "dmg_end0" }, { "dmg_start1", "dmg_end1" }, { "dmg_start2", "dmg_end2" }, }, { "dmg_reset0", "dmg_reset1", }, {}, { "woosh0", "woosh1", "woosh2", } } } });
-            AddAttackAnimation("ATTACK_SH_5", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
-                                                      { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
-
-            AddAttackAnimation("ATTACK_RIFLE_0", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_2H, { { "fire", "fire" } }, {}, {}, {} } } });
-            AddAttackAnimation("ATTACK_RIFLE_1", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_2H, { { "fire_0", "fire_0" }, { "fire_1", "fire_1" }, { "fire_2", "fire_2" }, }, { "dmg_reset0", "dmg_reset1" }, {}, {} } } });
-            AddAttackAnimation("ATTACK_RIFLE_2", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_2H, { { "fire", "fire" } }, {}, {} } } });
-
-            AddAttackAnimation("ATTACK_PISTOL_0", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_1H, { { "fire", "fire" } }, {} } } });
-            AddAttackAnimation("ATTACK_PISTOL_1", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_1H, { { "fire_0", "fire_0" }, { "fire_1", "fire_1" } }, { "dmg_reset" }, {}, {} } } });
-            AddAttackAnimation("ATTACK_PISTOL_2", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_1H, { { "fire", "fire" } }, {}, {}, {} } } });
-
-            AddAttackAnimation("ATTACK_THROW_0", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Thrown, { { "fire", "fire" } }, {}, {}, { "woosh0", } } } });
-            AddAttackAnimation("ATTACK_THROW_1", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Thrown, { { "fire", "fire" } }, {}, {}, { "woosh0", } } } });
-
-            AddAttackWooshSounds(DwarfAttackWooshSounds);
-
-            AddFootJoint("foota", "foota");
-            AddFootJoint("footb", "footb");
-            SetRunParticleSystem(DwarfRunParticlesPath);
-            AddRunParticleTag("DUST_0");
-            AddRunParticleTag("DUST_1");
+            BuildArchetype("Dwarf", [this]()
+            {
+                AddMainArmJoint("upperarma");
+                AddMainArmJoint("forearma");
+                AddMainArmJoint("handa");
+
+                AddOffArmJoint("upperarmb");
+                AddOffArmJoint("forearmb");
+                AddOffArmJoint("handb");
+
+                // Standing standard idle
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_1", 0.01f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_2", 0.01f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "IDLE_3", 0.01f);
+
+                // TODO: use SIT_0 animation
+
+                // Standing incapacitated idle
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Incapacitated, "DOWN_IDLE", 1.0f);
+
+                // Standing injured idle
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Injured, "HPLOW_IDLE_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Injured, "HPLOW_IDLE_1", 1.0f);
+
+                // Standing injured moving
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Incapacitated, "DOWN_CRAWL", 1.0f);
+
+                // Climbing rope
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.5f,   AnimationVariant_Standard, "ROPE_CLIMB_DOWN_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.375f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_1", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.25f,  AnimationVariant_Standard, "ROPE_CLIMB_DOWN_2", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.125f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_3", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, 0.0f,         AnimationVariant_Standard, "ROPE_CLIMB_3", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.125f,  AnimationVariant_Standard, "ROPE_CLIMB_2", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.25f,   AnimationVariant_Standard, "ROPE_CLIMB_1", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.375f,  AnimationVariant_Standard, "ROPE_CLIMB_0", 1.0f);
+
+                // Idle rope
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.5f,   AnimationVariant_Standard, "ROPE_CLIMB_DOWN_0_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.375f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_1_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.25f,  AnimationVariant_Standard, "ROPE_CLIMB_DOWN_2_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, -Pi * 0.125f, AnimationVariant_Standard, "ROPE_CLIMB_DOWN_3_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, 0.0f,         AnimationVariant_Standard, "ROPE_CLIMB_3_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.125f,  AnimationVariant_Standard, "ROPE_CLIMB_2_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.25f,   AnimationVariant_Standard, "ROPE_CLIMB_1_IDLE", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.375f,  AnimationVariant_Standard, "ROPE_IDLE_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope, Pi * 0.375f,  AnimationVariant_Standard, "ROPE_IDLE_1", 0.05f);
+
+                // Climbing ladder
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Wood, -PiOver2, AnimationVariant_Standard, "LADDER_CLIMB", 1.0f);
+
+                // Idle ladder
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Wood, -PiOver2, AnimationVariant_Standard, "LADDER_IDLE_0", 1.0f);
+
+                AddInteractAnimation("INTERACT", 1.0f);
+
+                AddWeaponAttachment("main_hand", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa_back" },
+                                                                               { Item::WeaponType_Melee_Shield, "handa_front" },
+                                                                               { Item::WeaponType_Ranged_Gun_1H, "handa_back" },
+                                                                               { Item::WeaponType_Ranged_Gun_2H, "handa_back" },
+                                                                               { Item::WeaponType_Ranged_Thrown, "handa_back" }, });
+                AddWeaponAttachment("off_hand", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_1H, "handb" }, });
+
+                AddAttackAnimation("ATTACK_1H_0", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
+
+                AddAttackAnimation("ATTACK_2H_0", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
+                AddAttackAnimation("ATTACK_2H_1", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
+                AddAttackAnimation("ATTACK_2H_2", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
+                AddAttackAnimation("ATTACK_2H_3", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" } }, {}, {}, { "woosh0", } } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
+                AddAttackAnimation("ATTACK_2H_4", 1.0f, { { "main_hand", { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh0", } } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" } }, {}, {}, { "woosh1", } } } });
+
+                AddAttackAnimation("ATTACK_SH_0", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
+                AddAttackAnimation("ATTACK_SH_1", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
+                AddAttackAnimation("ATTACK_SH_2", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H,     {}, {}, {} } } });
+                AddAttackAnimation("ATTACK_SH_3", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
+                AddAttackAnimation("ATTACK_SH_4", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start0", "dmg_end0" }, { "dmg_start1", "dmg_end1" }, { "dmg_start2", "dmg_end2" }, }, { "dmg_reset0", "dmg_reset1", }, {}, { "woosh0", "woosh1", "woosh2", } } } });
+                AddAttackAnimation("ATTACK_SH_5", 1.0f, { { "main_hand", { Item::WeaponType_Melee_Shield, {}, {}, {} } },
+                                                          { "off_hand",  { Item::WeaponType_Melee_1H,     { { "dmg_start", "dmg_end" } }, {}, {}, { "woosh0", } } } });
+
+                AddAttackAnimation("ATTACK_RIFLE_0", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_2H, { { "fire", "fire" } }, {}, {}, {} } } });
+                AddAttackAnimation("ATTACK_RIFLE_1", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_2H, { { "fire_0", "fire_0" }, { "fire_1", "fire_1" }, { "fire_2", "fire_2" }, }, { "dmg_reset0", "dmg_reset1" }, {}, {} } } });
+                AddAttackAnimation("ATTACK_RIFLE_2", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_2H, { { "fire", "fire" } }, {}, {} } } });
+
+                AddAttackAnimation("ATTACK_PISTOL_0", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_1H, { { "fire", "fire" } }, {} } } });
+                AddAttackAnimation("ATTACK_PISTOL_1", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_1H, { { "fire_0", "fire_0" }, { "fire_1", "fire_1" } }, { "dmg_reset" }, {}, {} } } });
+                AddAttackAnimation("ATTACK_PISTOL_2", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Gun_1H, { { "fire", "fire" } }, {}, {}, {} } } });
+
+                AddAttackAnimation("ATTACK_THROW_0", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Thrown, { { "fire", "fire" } }, {}, {}, { "woosh0", } } } });
+                AddAttackAnimation("ATTACK_THROW_1", 1.0f, { { "main_hand", { Item::WeaponType_Ranged_Thrown, { { "fire", "fire" } }, {}, {}, { "woosh0", } } } });
+
+                AddAttackWooshSounds(DwarfAttackWooshSounds);
+
+                AddFootJoint("foota", "foota");
+                AddFootJoint("footb", "footb");
+                SetRunParticleSystem(DwarfRunParticlesPath);
+                AddRunParticleTag("DUST_0");
+                AddRunParticleTag("DUST_1");
+
+                SetHeadName("head");
+
+                AddDamagedParticleSystem(DamageType_Element_Physical, DwarfDamageParticlesPath);
+                AddHealingParticleSystem(DwarfHealParticlesPath);
+                AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
+                AddDamageSounds(Audio::GetStandardOnClothDamageSoundPaths());
+                AddDamageSounds(Audio::GetStandardOnMetalDamageSoundPaths());
+                AddHealingSounds(Audio::GetStandardHealingSoundPaths());
+
+                AddAffirmativeSounds(DwarfAffirmativeSounds);
+                AddNegatorySounds(DwarfNegatorySounds);
+
+                AddBaseFootstepSounds(Audio::GetStandardBasicFootstepSoundPaths());
+                for (const auto& terrainFootsteps : Audio::GetStandardTerrainFootstepSoundPaths())
+                {
+                    AddTerrainFootstepSounds(terrainFootsteps.first, terrainFootsteps.second);
+                }
+            });
 
             SetAggroRange(1500.0f);
-
-            SetHeadName("head");
             AddMaterial("mouth", GetDwarfBeardMaterial(info.Name), 1.0f);
 
-            AddDamagedParticleSystem(DamageType_Element_Physical, DwarfDamageParticlesPath);
-            AddHealingParticleSystem(DwarfHealParticlesPath);
-
             SetDeadIcon(DwarfIconMatsetPath, "class_dead");
 
             _throwReleaseTag = "fire";
@@ -409,22 +425,9 @@ namespace Dwarf
             AddCustomAttachPoint(DwarfDrinkingCupAttachName, "weapon_a_0", "weapon_a_1");
 
             SetBodyMaterial(MaterialType_Type_Flesh);
-            AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
-            AddDamageSounds(Audio::GetStandardOnClothDamageSoundPaths());
-            AddDamageSounds(Audio::GetStandardOnMetalDamageSoundPaths());
-            AddHealingSounds(Audio::GetStandardHealingSoundPaths());
-
-            AddAffirmativeSounds(DwarfAffirmativeSounds);
-            AddNegatorySounds(DwarfNegatorySounds);
 
             _downedSounds.AddSounds(DwarfDeathSounds);
             _eatingSounds.AddSounds(DwarfEatingSounds);
-
-            AddBaseFootstepSounds(Audio::GetStandardBasicFootstepSoundPaths());
-            for (const auto& terrainFootsteps : Audio::GetStandardTerrainFootstepSoundPaths())
-            {
-                AddTerrainFootstepSounds(terrainFootsteps.first, terrainFootsteps.second);
-            }
             SetFootstepVolumeRange(DwarfFootstepVolumeRange.first, DwarfFootstepVolumeRange.second);
 
             SetGlobalSpeechParameters(DwarfSpeechGlobalVolume);
@@ -45,14 +45,21 @@ namespace Dwarf
                 }
             }
 
-            ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
             if (hasShield)
             {
-                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "RUN_4", 1.0f);
+                UseArchetypeVariant("FighterShield", [this]()
+                {
+                    ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "RUN_4", 1.0f);
+                });
             }
             else
             {
-                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, ForwardRunAnimation, 1.0f);
+                UseArchetypeVariant("FighterNoShield", [this]()
+                {
+                    ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, ForwardRunAnimation, 1.0f);
+                });
             }
         }
     }
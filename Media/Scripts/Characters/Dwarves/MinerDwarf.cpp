@@ -40,14 +40,17 @@ namespace Dwarf
         {
             SetItemSlotCount(Item::ItemSlot::Weapon, 2);
 
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, BackwardRunAnimation, 1.0f);
+            BuildArchetype("MinerDwarf", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, BackwardRunAnimation, 1.0f);
+                AddWeaponAttachment("off_hand", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Special, "handb" }, });
+            });
+
             SetIcon(MinerIconMatsetPath, "class_miner");
 
             _miningAnimations.AddAnimation("MINE_0", 1.0f);
             //_miningAnimations.AddAnimation("MINE_1", 1.0f);
 
-            AddWeaponAttachment("off_hand", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Special, "handb" }, });
-
             SetPlayFasterAnimationsForMoving(false);
 
         }
@@ -95,7 +98,7 @@ namespace Dwarf
             {
                 ResourceNode* miningNode = GetLevelLayer()->GetCharacter<ResourceNode>(_miningTarget);
 
-                std::vector<Item::Miner*> miningItems = GetWeapons<Item::Miner>();
+                const std::vector<Item::Miner*>& miningItems = GetIndexedWeapons<Item::Miner>();
                 if (!miningNode || !miningNode->IsAlive() || miningItems.empty())
                 {
                     CancelCurrentAction();
@@ -130,7 +133,7 @@ namespace Dwarf
                         if (_nextMineAmmount == 0)
                         {
                             float miningModifier = 1.0f;
-                            std::vector<Item::MineRateModifier*> miningModifiers = GetWeapons<Item::MineRateModifier>();
+                            const std::vector<Item::MineRateModifier*>& miningModifiers = GetIndexedWeapons<Item::MineRateModifier>();
                             for (auto modifier : miningModifiers)
                             {
                                 miningModifier *= modifier->GetMineRateMultiplier();
@@ -142,7 +145,7 @@ namespace Dwarf
                 }
             }
 
-            if (GetWeapons<Item::MinerSack>().size() > 0 && !IsPlayingAnimation(MinerSackSmashAnimation))
+            if (GetIndexedWeapons<Item::MinerSack>().size() > 0 && !IsPlayingAnimation(MinerSackSmashAnimation))
             {
                 for (const auto& sackJointPositions : MinerDwarfSacktargetJoints)
                 {
@@ -160,14 +163,21 @@ namespace Dwarf
             bool shouldBeUsingSprintAnims = GetMoveSpeedMultiplier() > 1.0f;
             if (shouldBeUsingSprintAnims != _usingSprintAnimations)
             {
-                ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
                 if (shouldBeUsingSprintAnims)
                 {
-                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "SPRINT", 1.0f);
+                    UseArchetypeVariant("MinerSprint", [this]()
+                    {
+                        ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                        AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "SPRINT", 1.0f);
+                    });
                 }
                 else
                 {
-                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, BackwardRunAnimation, 1.0f);
+                    UseArchetypeVariant("MinerRun", [this]()
+                    {
+                        ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                        AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, BackwardRunAnimation, 1.0f);
+                    });
                 }
                 _usingSprintAnimations = shouldBeUsingSprintAnims;
             }
@@ -15,7 +15,11 @@ namespace Dwarf
         NavigatorDwarf::NavigatorDwarf(const CharacterParameters& parameters, const DwarfInfo& info)
             : Dwarf(parameters, info, NavigatorMatsetPath)
         {
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, NormalRunAnimation, 1.0f);
+            BuildArchetype("NavigatorDwarf", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, NormalRunAnimation, 1.0f);
+            });
+
             SetIcon(NavigatorIconMatsetPath, "class_navigator");
         }
     }
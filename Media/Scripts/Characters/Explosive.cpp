@@ -1,6 +1,8 @@
 #include "Characters/Explosive.hpp"
 #include "DamageTypes.hpp"
 #include "ContentUtility.hpp"
+#include "Audio/SoundEventScheduler.hpp"
+#include "Drawables/LightCuller.hpp"
 
 namespace Dwarf
 {
@@ -202,8 +204,8 @@ namespace Dwarf
                     _explosion->Burst();
                     _explosionLight.Position = blastOrigin;
 
-                    auto soundManager = GetLevel()->GetSoundManager();
-                    soundManager->PlaySinglePositionalSound(_explosionSounds.GetNextSound(), Audio::SoundPriority::High, blastOrigin, ExplosiveBlastSoundRadius.first, ExplosiveBlastSoundRadius.second, 1.0f);
+                    Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Explosion, _explosionSounds.GetNextSound(), Audio::SoundPriority::High, blastOrigin,
+                                          ExplosiveBlastSoundRadius.first, ExplosiveBlastSoundRadius.second, 1.0f);
 
                     Rectanglef blastRect(blastOrigin - Vector2f(_blastRadius * 2.0f), Vector2f(_blastRadius * 4.0f));
 
@@ -255,7 +257,7 @@ namespace Dwarf
             if (_fuse)
             {
                 levelRenderer->AddDrawable(_fuse, false);
-                if (_countingDown && !_exploding)
+                if (_countingDown && !_exploding && Graphics::IsLightInView(GetLevelLayer(), _fuseLight))
                 {
                     levelRenderer->AddLight(_fuseLight);
                 }
@@ -263,7 +265,7 @@ namespace Dwarf
 
             levelRenderer->AddDrawable(_explosion, false);
 
-            if (_exploding && _timeDead < _blastLightDuration)
+            if (_exploding && _timeDead < _blastLightDuration && Graphics::IsLightInView(GetLevelLayer(), _explosionLight))
             {
                 levelRenderer->AddLight(_explosionLight);
             }
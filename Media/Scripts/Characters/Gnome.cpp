@@ -45,27 +45,33 @@ namespace Dwarf
             SetSkeletonScale(size);
             SetSkeletonColor(Color::White);
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle0", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle2", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle3", 1.0f);
+            BuildArchetype("Gnome", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle2", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle3", 1.0f);
+
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run1", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run2", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run3", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run4", 1.0f);
 
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run1", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run2", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run3", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run4", 1.0f);
+                AddWeaponAttachment("handa", "weapona_0", "weapona_1", { { Item::WeaponType_Melee_2H, "handa" } });
+                //AddWeaponAttachment("handb", "weaponb_0", "weaponb_1", { });
 
-            AddWeaponAttachment("handa", "weapona_0", "weapona_1", { { Item::WeaponType_Melee_2H, "handa" } });
-            //AddWeaponAttachment("handb", "weaponb_0", "weaponb_1", { });
+                AddAttackAnimation("attack0", 1.0f, { { "handa", { Item::WeaponType_Melee_2H, {}, {}, {} } } });
+                AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_2H, {}, {}, {} } } });
 
-            AddAttackAnimation("attack0", 1.0f, { { "handa", { Item::WeaponType_Melee_2H, {}, {}, {} } } });
-            AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_2H, {}, {}, {} } } });
+                AddFootJoint("foota_front", "foota_back");
+                AddFootJoint("footb_front", "footb_back");
+                SetRunParticleSystem(GnomeRunParticlesPath);
+                AddRunParticleTag("dust_0");
+                AddRunParticleTag("dust_1");
 
-            AddFootJoint("foota_front", "foota_back");
-            AddFootJoint("footb_front", "footb_back");
-            SetRunParticleSystem(GnomeRunParticlesPath);
-            AddRunParticleTag("dust_0");
-            AddRunParticleTag("dust_1");
+                AddDamagedParticleSystem(DamageType_Element_Physical, GnomeDamageParticlePath);
+                AddDamageSounds(Audio::GetStandardOnClothDamageSoundPaths());
+            });
 
             for (auto interchangeMat : GnomeInterchangeMatsetPaths)
             {
@@ -77,10 +83,7 @@ namespace Dwarf
 
             SetAggroRange(1000.0f);
 
-            AddDamagedParticleSystem(DamageType_Element_Physical, GnomeDamageParticlePath);
-
             SetBodyMaterial(MaterialType_Type_Cloth);
-            AddDamageSounds(Audio::GetStandardOnClothDamageSoundPaths());
         }
     }
 
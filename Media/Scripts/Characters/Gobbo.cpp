@@ -208,20 +208,9 @@ namespace Dwarf
             SetSkeletonScale(size);
             SetSkeletonColor(Color::White);
 
+            // Idle and run animations are picked per gobbo, each combination gets its own archetype
             const float sitIdleChance = 0.3f;
-            if (Random::RandomBetween(0.0f, 1.0f) < sitIdleChance)
-            {
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_sit", 1.0f);
-            }
-            else
-            {
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 1.0f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle2", 0.02f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle3", 0.02f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle4", 0.02f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle5", 0.02f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle6", 0.02f);
-            }
+            const bool sitIdle = Random::RandomBetween(0.0f, 1.0f) < sitIdleChance;
 
             std::vector<std::string> runAnimations =
             {
@@ -229,34 +218,68 @@ namespace Dwarf
                 "run_2",
                 "run3",
             };
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, Random::RandomItem(runAnimations), 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Jump, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "fall_0", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "ladder_climb0", 1.0f);
+            const std::string runAnimation = Random::RandomItem(runAnimations);
+
+            BuildArchetype(Format("Gobbo_%s_%s", sitIdle ? "sit" : "stand", runAnimation.c_str()), [&]()
+            {
+                if (sitIdle)
+                {
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_sit", 1.0f);
+                }
+                else
+                {
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 1.0f);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle2", 0.02f);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle3", 0.02f);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle4", 0.02f);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle5", 0.02f);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle6", 0.02f);
+                }
+
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, runAnimation, 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Jump, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "fall_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "ladder_climb0", 1.0f);
+
+                AddWeaponAttachment("handa", "weapona_0", "weapona_1", { { Item::WeaponType_Melee_1H, "handa" },
+                                                                         { Item::WeaponType_Ranged_Thrown, "handa" }, });
+                AddWeaponAttachment("handb", "weaponb_0", "weaponb_1", { { Item::WeaponType_Melee_1H, "handb" },
+                                                                         { Item::WeaponType_Ranged_Bow, "handb" }, });
+
+                AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
+                AddAttackAnimation("attack2", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
+                AddAttackAnimation("attack4", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
+
+                AddAttackAnimation("attack3", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } },
+                                                      { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
 
-            AddWeaponAttachment("handa", "weapona_0", "weapona_1", { { Item::WeaponType_Melee_1H, "handa" },
-                                                                     { Item::WeaponType_Ranged_Thrown, "handa" }, });
-            AddWeaponAttachment("handb", "weaponb_0", "weaponb_1", { { Item::WeaponType_Melee_1H, "handb" },
-                                                                     { Item::WeaponType_Ranged_Bow, "handb" }, });
+                AddAttackAnimation("throw", 1.0f, { { "handa", { Item::WeaponType_Ranged_Thrown, { { "throw_0", "throw_0" } },{}, { "attack_sound0", }, {} } } });
+                AddAttackAnimation("range_attack1", 1.0f, { { "handb", { Item::WeaponType_Ranged_Bow, { { "fire_arrow", "fire_arrow" } }, {}, { "attack_sound0", }, { "fire_arrow", } } } });
 
-            AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
-            AddAttackAnimation("attack2", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
-            AddAttackAnimation("attack4", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
+                AddAttackWooshSounds(GobboAttackWooshSounds);
 
-            AddAttackAnimation("attack3", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } },
-                                                  { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
+                SetHeadName("head");
+                SetJawJoint("Jaw");
+                AddFootJoint("foota", "foota");
+                AddFootJoint("footb", "footb");
+                SetRunParticleSystem(GobboRunParticlesPath);
+                AddRunParticleTag("dust_0");
+                AddRunParticleTag("dust_1");
 
-            AddAttackAnimation("throw", 1.0f, { { "handa", { Item::WeaponType_Ranged_Thrown, { { "throw_0", "throw_0" } },{}, { "attack_sound0", }, {} } } });
-            AddAttackAnimation("range_attack1", 1.0f, { { "handb", { Item::WeaponType_Ranged_Bow, { { "fire_arrow", "fire_arrow" } }, {}, { "attack_sound0", }, { "fire_arrow", } } } });
+                AddDamagedParticleSystem(DamageType_Element_Physical, GobboDamageParticlePath);
+                AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
 
-            AddAttackWooshSounds(GobboAttackWooshSounds);
+                AddIdleSounds(GobboIdleSounds);
 
-            SetHeadName("head");
-            SetJawJoint("Jaw");
-            AddFootJoint("foota", "foota");
-            AddFootJoint("footb", "footb");
-            SetRunParticleSystem(GobboRunParticlesPath);
-            AddRunParticleTag("dust_0");
-            AddRunParticleTag("dust_1");
+                AddAttackSounds(GobboAttackSounds);
+                AddAggroSounds(GobboAggroSounds);
+                AddDeathSounds(GobboDeathSounds);
+
+                AddBaseFootstepSounds(Audio::GetStandardBasicFootstepSoundPaths());
+                for (const auto& terrainFootsteps : Audio::GetStandardTerrainFootstepSoundPaths())
+                {
+                    AddTerrainFootstepSounds(terrainFootsteps.first, terrainFootsteps.second);
+                }
+            });
 
             for (auto interchangeMat : GobboInterchangeMatsetPaths)
             {
@@ -268,23 +291,8 @@ namespace Dwarf
 
             SetAggroRange(1000.0f);
 
-            AddDamagedParticleSystem(DamageType_Element_Physical, GobboDamageParticlePath);
-
             SetBodyMaterial(MaterialType_Type_Flesh);
-            AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
-
-            AddIdleSounds(GobboIdleSounds);
             SetIdleSoundInterval(10.0f, 40.0f);
-
-            AddAttackSounds(GobboAttackSounds);
-            AddAggroSounds(GobboAggroSounds);
-            AddDeathSounds(GobboDeathSounds);
-
-            AddBaseFootstepSounds(Audio::GetStandardBasicFootstepSoundPaths());
-            for (const auto& terrainFootsteps : Audio::GetStandardTerrainFootstepSoundPaths())
-            {
-                AddTerrainFootstepSounds(terrainFootsteps.first, terrainFootsteps.second);
-            }
         }
 
         GobboThrower::GobboThrower(const CharacterParameters& parameters)
@@ -327,7 +335,11 @@ namespace Dwarf
             }
 
             SetBodyMaterial(MaterialType_Type_Cloth);
-            AddDamageSounds(Audio::GetStandardOnClothDamageSoundPaths());
+
+            BuildArchetype("GobboBowman", [this]()
+            {
+                AddDamageSounds(Audio::GetStandardOnClothDamageSoundPaths());
+            });
         }
     }
 
@@ -415,8 +427,11 @@ namespace Dwarf
             SetMoveSpeed(500.0f);
             AddCharacterAttachPoint("handb");
 
-            ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "suicide_run", 1.0f);
+            BuildArchetype("GobboBomber", [this]()
+            {
+                ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "suicide_run", 1.0f);
+            });
 
             ClearMaterialGroup("body");
             for (auto interchangeMat : GobboBomberInterchangeMatsetPaths)
@@ -492,18 +507,22 @@ namespace Dwarf
             SetAggroRange(1200.0f);
 
             SetBodyMaterial(MaterialType_Type_Metal);
-            AddDamageSounds(Audio::GetStandardOnMetalDamageSoundPaths());
 
-            ClearAttackAnimations();
-            AddAttackAnimation("chief_attack0", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{ "attack_sound0", },{} } } });
-            AddAttackAnimation("chief_attack1", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{ "attack_sound0", },{} } } });
+            BuildArchetype("GobboChief", [this]()
+            {
+                AddDamageSounds(Audio::GetStandardOnMetalDamageSoundPaths());
+
+                ClearAttackAnimations();
+                AddAttackAnimation("chief_attack0", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{ "attack_sound0", },{} } } });
+                AddAttackAnimation("chief_attack1", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{ "attack_sound0", },{} } } });
 
-            ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "chief_run", 1.0f);
+                ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "chief_run", 1.0f);
 
-            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "chief_idle1", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "chief_idle2", 1.0f);
+                ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "chief_idle1", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "chief_idle2", 1.0f);
+            });
         }
 
         static const std::string GobboTowerSkeletonPath = "Skeletons/Characters/gobtower/gobtower.skel";
@@ -543,7 +562,11 @@ namespace Dwarf
             AddCharacterAttachPoint("platform_4");
 
             SetBodyMaterial(MaterialType_Type_Metal);
-            AddDamageSounds(Audio::GetStandardOnMetalDamageSoundPaths());
+
+            BuildArchetype("GobboTower", [this]()
+            {
+                AddDamageSounds(Audio::GetStandardOnMetalDamageSoundPaths());
+            });
 
             SetMaterialCollisionSound(GobboTowerCollisionSounds);
 
@@ -2,6 +2,7 @@
 
 #include "Level/LevelInstance.hpp"
 #include "Level/LevelLayerInstance.hpp"
+#include "Levels/PathGraphPatcher.hpp"
 
 #include "Physics/RopeCollision.hpp"
 
@@ -101,8 +102,7 @@ namespace Dwarf
         {
             if (!_createdPath && _curTime >= Min(_createPathTime, _totalTime))
             {
-                Pathfinding::PathSystem* pathSystem = GetLevelLayer()->GetPathSystem();
-                _pathId = pathSystem->AddChain(_targetRope, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope);
+                _pathId = Level::AddPathChain(GetLevelLayer(), _targetRope, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope);
                 _createdPath = true;
             }
 
@@ -197,7 +197,7 @@ namespace Dwarf
         {
             if (newState == CharacterState_Dead)
             {
-                GetLevelLayer()->GetPathSystem()->RemoveObject(_pathId);
+                Level::RemovePathObject(GetLevelLayer(), _pathId);
                 _pathId = 0;
 
                 SafeRelease(_collision);
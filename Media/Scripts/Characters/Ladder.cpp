@@ -1,6 +1,7 @@
 #include "Characters/Ladder.hpp"
 
 #include "ContentUtility.hpp"
+#include "Levels/PathGraphPatcher.hpp"
 
 namespace Dwarf
 {
@@ -20,6 +21,7 @@ namespace Dwarf
             , _endA(nullptr)
             , _segments()
             , _endB(nullptr)
+            , _posed(false)
             , _pathId(Pathfinding::PathItemID_Invalid)
         {
             SetAttachToGroundOnSpawn(false);
@@ -44,14 +46,12 @@ namespace Dwarf
             chain.AddPoint(_top);
             chain.AddPoint(_bottom);
 
-            Pathfinding::PathSystem* pathSystem = GetLevelLayer()->GetPathSystem();
-            _pathId = pathSystem->AddChain(chain, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Wood);
+            _pathId = Level::AddPathChain(GetLevelLayer(), chain, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Wood);
         }
 
         void Ladder::OnDeath()
         {
-            Pathfinding::PathSystem* pathSystem = GetLevelLayer()->GetPathSystem();
-            pathSystem->RemoveObject(_pathId);
+            Level::RemovePathObject(GetLevelLayer(), _pathId);
             Terminate();
         }
 
@@ -90,6 +90,8 @@ namespace Dwarf
             _endB->SetPosition(curSegmentPos);
             _endB->SetRotation(ladderDir);
             _endB->SetInvertedX(invert);
+
+            _posed = false;
         }
 
         void Ladder::OnUnloadContent()
@@ -101,12 +103,18 @@ namespace Dwarf
 
         void Ladder::OnUpdate(double totalTime, float dt)
         {
+            if (_posed)
+            {
+                return;
+            }
+
             _endA->Update(totalTime, dt);
             for (Animation::SkeletonInstance* segment : _segments)
             {
                 segment->Update(totalTime, dt);
             }
             _endB->Update(totalTime, dt);
+            _posed = true;
         }
 
         void Ladder::OnDraw(Graphics::LevelRenderer* levelRenderer) const
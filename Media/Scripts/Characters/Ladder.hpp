@@ -33,6 +33,9 @@ namespace Dwarf
             std::vector<Animation::SkeletonInstance*> _segments;
             Animation::SkeletonInstance* _endB;
 
+            // The segments have nothing to animate, they only need updating once to be posed
+            bool _posed;
+
             Pathfinding::PathItemID _pathId;
         };
     }
@@ -29,6 +29,7 @@ namespace Dwarf
 
             DisablePhysics();
             SetInvulnerable(true);
+            SetCanSleep(true);
 
             _moveSounds.AddSounds(LeverMoveSounds);
         }
@@ -76,6 +77,10 @@ namespace Dwarf
         void Lever::OnUpdate(double totalTime, float dt)
         {
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
             if (_interactionTimer >= 0.0f)
             {
@@ -91,6 +96,11 @@ namespace Dwarf
                 }
             }
         }
+
+        bool Lever::IsIdle() const
+        {
+            return SkeletonCharacter::IsIdle() && _interactionTimer < 0.0f;
+        }
     }
 
     template <>
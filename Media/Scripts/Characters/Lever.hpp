@@ -27,6 +27,7 @@ namespace Dwarf
             void OnSpawn() override;
 
             void OnUpdate(double totalTime, float dt) override;
+            bool IsIdle() const override;
 
         private:
             CharacterID _interactor = 0;
@@ -24,43 +24,46 @@ namespace Dwarf
             SetSkeletonScale(1.0f);
             SetSkeletonColor(Color::White);
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle2", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle3", 0.1f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle4", 0.1f);
-
-            AddWeaponAttachment("handa", "weapona1", "weapona2", { { Item::WeaponType_Melee_1H, "handa" }, });
-            AddWeaponAttachment("handb", "weaponb1", "weaponb2", { { Item::WeaponType_Melee_1H, "handb" },
-                                                                   { Item::WeaponType_Ranged_Bow, "handb"} });
-
-            AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
-            AddAttackAnimation("attack2", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
-            AddAttackAnimation("attack4", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
-            
-            AddAttackAnimation("attack3", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } },
-                                                  { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
-
-            AddAttackAnimation("range_attack0", 1.0f, { { "handb", { Item::WeaponType_Ranged_Bow, { { "fire_arrow", "fire_arrow" } }, {} } } });
-
-            AddFootJoint("foota", "foota");
-            AddFootJoint("footb", "footb");
-            SetRunParticleSystem(MrBonesRunParticlesPath);
-            AddRunParticleTag("dust_0");
-            AddRunParticleTag("dust_1");
+            BuildArchetype("MrBones", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle2", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle3", 0.1f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle4", 0.1f);
 
-            SetAggroRange(1000.0f);
+                AddWeaponAttachment("handa", "weapona1", "weapona2", { { Item::WeaponType_Melee_1H, "handa" }, });
+                AddWeaponAttachment("handb", "weaponb1", "weaponb2", { { Item::WeaponType_Melee_1H, "handb" },
+                                                                       { Item::WeaponType_Ranged_Bow, "handb"} });
+
+                AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
+                AddAttackAnimation("attack2", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
+                AddAttackAnimation("attack4", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
+
+                AddAttackAnimation("attack3", 0.5f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } },
+                                                      { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, {} } } });
+
+                AddAttackAnimation("range_attack0", 1.0f, { { "handb", { Item::WeaponType_Ranged_Bow, { { "fire_arrow", "fire_arrow" } }, {} } } });
 
-            SetHeadName("sight_line");
+                AddFootJoint("foota", "foota");
+                AddFootJoint("footb", "footb");
+                SetRunParticleSystem(MrBonesRunParticlesPath);
+                AddRunParticleTag("dust_0");
+                AddRunParticleTag("dust_1");
+
+                SetHeadName("sight_line");
+
+                AddDamagedParticleSystem(DamageType_Element_Physical, "Particles/bone_splat.partsys");
+                AddDamageSounds(Audio::GetStandardOnBoneDamageSoundPaths());
+            });
+
+            SetAggroRange(1000.0f);
 
             AddMaterial("legs", "Skeletons/Characters/MrBones/skellegs_0.polymatset", 1.0f);
             AddMaterial("legs", "Skeletons/Characters/MrBones/skellegs_1.polymatset", 1.0f);
             AddMaterial("legs", "Skeletons/Characters/MrBones/skellegs_2.polymatset", 1.0f);
             AddMaterial("legs", "Skeletons/Characters/MrBones/skellegs_3.polymatset", 1.0f);
 
-            AddDamagedParticleSystem(DamageType_Element_Physical, "Particles/bone_splat.partsys");
-
             SetBodyMaterial(MaterialType_Type_Bone);
-            AddDamageSounds(Audio::GetStandardOnBoneDamageSoundPaths());
         }
 
         void MrBones::OnStateChange(CharacterState newState)
@@ -25,11 +25,14 @@ namespace Dwarf
             SetSkeletonScale(1.0f);
             SetSkeletonColor(Color::White);
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 1.0f);
+            BuildArchetype("NecroKnight", [this]()
+            {
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 1.0f);
 
-            SetAggroRange(1000.0f);
+                SetHeadName("joint_22");
+            });
 
-            SetHeadName("joint_22");
+            SetAggroRange(1000.0f);
         }
 
         void NecroKnight::OnUpdate(double totalTime, float dt)
@@ -150,33 +150,36 @@ namespace Dwarf
             SetMoveType(MoveType_Walk);
             SetPathableEdges(Pathfinding::EdgeType_Walk);
 
-            SetRunParticleSystem(OrkRunParticlesPath);
+            BuildArchetype("Ork", [this]()
+            {
+                SetRunParticleSystem(OrkRunParticlesPath);
 
-            SetAggroRange(1000.0f);
+                AddDamagedParticleSystem(DamageType_Element_Physical, OrkDamageParticlePath);
+                AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
 
-            AddDamagedParticleSystem(DamageType_Element_Physical, OrkDamageParticlePath);
+                AddAttackWooshSounds(OrkAttackWooshSounds);
+                AddAttackSounds(OrkAttackSounds);
 
-            SetBodyMaterial(MaterialType_Type_Flesh);
-            AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
+                AddDeathSounds(OrkDeathSounds);
 
-            SetPositionalSpeechParameters(OrkSpeechPositionalVolume, OrkSpeechRange.first, OrkSpeechRange.second);
+                AddIdleSounds(OrkIdleSounds);
 
-            AddAttackWooshSounds(OrkAttackWooshSounds);
-            AddAttackSounds(OrkAttackSounds);
-            SetAttackSoundPlayChance(1.0f);
+                AddAggroSounds(OrkAggroSounds);
 
-            AddDeathSounds(OrkDeathSounds);
+                AddBaseFootstepSounds(Audio::GetHeavyBasicFootstepSoundPaths());
+                for (const auto& terrainFootsteps : Audio::GetStandardTerrainFootstepSoundPaths())
+                {
+                    AddTerrainFootstepSounds(terrainFootsteps.first, terrainFootsteps.second);
+                }
+            });
 
-            AddIdleSounds(OrkIdleSounds);
-            SetIdleSoundInterval(5.0f, 15.0f);
+            SetAggroRange(1000.0f);
 
-            AddAggroSounds(OrkAggroSounds);
+            SetBodyMaterial(MaterialType_Type_Flesh);
 
-            AddBaseFootstepSounds(Audio::GetHeavyBasicFootstepSoundPaths());
-            for (const auto& terrainFootsteps : Audio::GetStandardTerrainFootstepSoundPaths())
-            {
-                AddTerrainFootstepSounds(terrainFootsteps.first, terrainFootsteps.second);
-            }
+            SetPositionalSpeechParameters(OrkSpeechPositionalVolume, OrkSpeechRange.first, OrkSpeechRange.second);
+            SetAttackSoundPlayChance(1.0f);
+            SetIdleSoundInterval(5.0f, 15.0f);
             EnableFootstepCameraShake(OrkFootstepShakeMagnitude, OrkFootstepShakeFrequency);
         }
 
@@ -205,10 +208,28 @@ namespace Dwarf
             SetSkeletonScale(size);
             SetSkeletonColor(Color::White);
 
-            SetHeadName("head");
+            BuildArchetype("OrkWarrior", [this]()
+            {
+                SetHeadName("head");
+
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle0", 1.0f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run0", 1.0f);
+
+                AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa" }, });
+                AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_1H, "handb" }, });
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle0", 1.0f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run0", 1.0f);
+                AddAttackAnimation("attack0", 1.0f, { { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, { "woosh0", } } } });
+                AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, { "woosh0", } } } });
+                AddAttackAnimation("attack2", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, { "woosh0", } } },
+                                                      { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
+
+                AddFootJoint("foota_front", "foota_back");
+                AddFootJoint("footb_front", "footb_back");
+                AddRunParticleTag("dust_0");
+                AddRunParticleTag("dust_1");
+
+                SetJawJoint("jaw");
+            });
 
             _leapAnimations.AddAnimation("fall0", 1.0f);
             _groundSlamAnimations.AddAnimation("jump0", 1.0f);
@@ -223,19 +244,6 @@ namespace Dwarf
             }
             _leapLandAlwaysSounds.AddSounds(OrkLeapLandAlwaysSounds);
 
-            AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa" }, });
-            AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_1H, "handb" }, });
-
-            AddAttackAnimation("attack0", 1.0f, { { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, { "woosh0", } } } });
-            AddAttackAnimation("attack1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, { "woosh0", } } } });
-            AddAttackAnimation("attack2", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, { "woosh0", } } },
-                                                  { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" } }, {}, { "attack_sound0", }, {} } } });
-
-            AddFootJoint("foota_front", "foota_back");
-            AddFootJoint("footb_front", "footb_back");
-            AddRunParticleTag("dust_0");
-            AddRunParticleTag("dust_1");
-
             for (auto interchangeMat : OrkWarriorInterchangeMatsetPaths)
             {
                 for (auto mat : interchangeMat.second)
@@ -243,8 +251,6 @@ namespace Dwarf
                     AddMaterial(interchangeMat.first, mat.first, mat.second);
                 }
             }
-
-            SetJawJoint("jaw");
         }
 
         float OrkWarrior::OnPreLeap(Pathfinding::TerrainType terrainType)
@@ -407,20 +413,23 @@ namespace Dwarf
             SetSkeletonScale(1.0f);
             SetSkeletonColor(Color::White);
 
-            SetHeadName("head");
-            SetJawJoint("jaw");
+            BuildArchetype("ShieldOrk", [this]()
+            {
+                SetHeadName("head");
+                SetJawJoint("jaw");
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_0", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 0.5f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 0.5f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_0", 1.0f);
 
-            AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa" }, });
-            AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_Shield, "handb" }, });
+                AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa" }, });
+                AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_Shield, "handb" }, });
 
-            AddFootJoint("foota_front", "foota_back");
-            AddFootJoint("footb_front", "footb_back");
-            AddRunParticleTag("particle_1");
-            AddRunParticleTag("particle_0");
+                AddFootJoint("foota_front", "foota_back");
+                AddFootJoint("footb_front", "footb_back");
+                AddRunParticleTag("particle_1");
+                AddRunParticleTag("particle_0");
+            });
 
             SetAggroRange(1000.0f);
 
@@ -561,7 +570,7 @@ namespace Dwarf
                         const Animation::SkeletonInstance* skeleton = GetSkeleton();
                         if (skeleton->IsBetweenAnimationTags("knockback_start", "knockback_end"))
                         {
-                            const Item::OrkTowerShield* shield = GetWeapons<Item::OrkTowerShield>().front();
+                            const Item::OrkTowerShield* shield = GetIndexedWeapons<Item::OrkTowerShield>().front();
                             Level::LevelLayerInstance* layer = GetLevelLayer();
 
                             Vector2f knockbarDir = Vector2f::Normalize(skeleton->GetJointPosition("knockback_dir") - skeleton->GetJointPosition("handb"));
@@ -607,9 +616,11 @@ namespace Dwarf
 
         void ShieldOrk::setShieldState(ShieldState state)
         {
-            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
-            ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
-            ClearAttackAnimations();
+            // Every shield state has a variant of the archetype shared by all shield orks in it
+            UseArchetypeVariant("ShieldOrkSwitching", [this]()
+            {
+                clearShieldAnimations();
+            });
 
             switch (state)
             {
@@ -651,6 +662,13 @@ namespace Dwarf
             _shieldState = state;
         }
 
+        void ShieldOrk::clearShieldAnimations()
+        {
+            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
+            ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+            ClearAttackAnimations();
+        }
+
         void ShieldOrk::onPostShieldSwitch(ShieldState state)
         {
             FinishSpecialActions();
@@ -662,29 +680,41 @@ namespace Dwarf
             case Hiding:
                 SetMoveSpeed(0.0f);
                 SetAggroRange(ShieldOrkUnhideRange);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_waiting", 1.0f);
+                UseArchetypeVariant("ShieldOrkHiding", [this]()
+                {
+                    clearShieldAnimations();
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_waiting", 1.0f);
+                });
                 break;
 
             case ShieldDown:
                 SetMoveSpeed(200.0f);
                 SetAggroRange(ShieldOrkAggroRadius);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_0", 1.0f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 0.5f);
-                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_0", 1.0f);
-
-                AddAttackAnimation("attack_1", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{},{ "woosh0", } } } });
-                AddAttackAnimation("attack_2", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start0", "dmg_end0" },{ "dmg_start1", "dmg_end1" },{ "dmg_start2", "dmg_end2" },{ "dmg_start3", "dmg_end3" }, },{ "dmg_reset0", "dmg_reset1", "dmg_reset2", },{},{ "woosh0", "woosh1", "woosh2", "woosh3", } } } });
-                AddAttackAnimation("attack_0", 1.0f, { { "handb",{ Item::WeaponType_Melee_Shield,{ { "dmg_start", "dmg_end" } },{},{},{ "woosh0", } } } });
-                AddAttackAnimation("attack_3", 1.0f, { { "handb",{ Item::WeaponType_Melee_Shield,{ { "dmg_start", "dmg_end" } },{},{},{ "woosh0", } } } });
+                UseArchetypeVariant("ShieldOrkShieldDown", [this]()
+                {
+                    clearShieldAnimations();
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_0", 1.0f);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 0.5f);
+                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_0", 1.0f);
+
+                    AddAttackAnimation("attack_1", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{},{ "woosh0", } } } });
+                    AddAttackAnimation("attack_2", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start0", "dmg_end0" },{ "dmg_start1", "dmg_end1" },{ "dmg_start2", "dmg_end2" },{ "dmg_start3", "dmg_end3" }, },{ "dmg_reset0", "dmg_reset1", "dmg_reset2", },{},{ "woosh0", "woosh1", "woosh2", "woosh3", } } } });
+                    AddAttackAnimation("attack_0", 1.0f, { { "handb",{ Item::WeaponType_Melee_Shield,{ { "dmg_start", "dmg_end" } },{},{},{ "woosh0", } } } });
+                    AddAttackAnimation("attack_3", 1.0f, { { "handb",{ Item::WeaponType_Melee_Shield,{ { "dmg_start", "dmg_end" } },{},{},{ "woosh0", } } } });
+                });
                 break;
 
             case ShieldUp:
                 SetMoveSpeed(200.0f);
                 SetAggroRange(ShieldOrkAggroRadius);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "shieldup_idle", 1.0f);
-                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "shieldup_walk", 1.0f);
-                AddAttackAnimation("shieldup_poke", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{ "woosh0", } } } });
-                AddAttackAnimation("shieldup_smash", 1.0f, { { "handb",{ Item::WeaponType_Melee_Shield,{ { "dmg_start", "dmg_end" } },{},{ "woosh0", } } } });
+                UseArchetypeVariant("ShieldOrkShieldUp", [this]()
+                {
+                    clearShieldAnimations();
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "shieldup_idle", 1.0f);
+                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "shieldup_walk", 1.0f);
+                    AddAttackAnimation("shieldup_poke", 1.0f, { { "handa",{ Item::WeaponType_Melee_1H,{ { "dmg_start", "dmg_end" } },{},{ "woosh0", } } } });
+                    AddAttackAnimation("shieldup_smash", 1.0f, { { "handb",{ Item::WeaponType_Melee_Shield,{ { "dmg_start", "dmg_end" } },{},{ "woosh0", } } } });
+                });
                 break;
 
             default:
@@ -883,26 +913,29 @@ namespace Dwarf
             SetSkeletonScale(size);
             SetSkeletonColor(Color::White);
 
-            SetHeadName("head");
-            SetJawJoint("jaw");
+            BuildArchetype("OrkCannoneer", [this]()
+            {
+                SetHeadName("head");
+                SetJawJoint("jaw");
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle0", 1.0f);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 0.1f);
-            AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle0", 1.0f);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle1", 0.1f);
+                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "run0", 1.0f);
 
-            //AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { });
-            //AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { });
+                //AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { });
+                //AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { });
 
-            AddWeaponAttachment("muzzle", "muzzle_pos", "muzzle_dir", { { Item::WeaponType_Ranged_Gun_2H, "muzzle_pos" } });
+                AddWeaponAttachment("muzzle", "muzzle_pos", "muzzle_dir", { { Item::WeaponType_Ranged_Gun_2H, "muzzle_pos" } });
 
-            AddAttackAnimation("attack0", 1.0f, { { "muzzle", { Item::WeaponType_Ranged_Gun_2H, { { "fire", "fire" } }, {}, {} } } }, { 1000.0f, std::numeric_limits<float>::max() });
-            AddAttackAnimation("attack1", 1.0f, { { "muzzle", { Item::WeaponType_Ranged_Gun_2H,{ { "fire", "fire" } },{},{} } } }, { 0.0f, 1000.0f });
-            AddAttackAnimation("attack2", 1.0f, { { "muzzle", { Item::WeaponType_Ranged_Gun_2H,{ { "fire", "fire" } },{},{} } } }, { 0.0f, 1000.0f });
+                AddAttackAnimation("attack0", 1.0f, { { "muzzle", { Item::WeaponType_Ranged_Gun_2H, { { "fire", "fire" } }, {}, {} } } }, { 1000.0f, std::numeric_limits<float>::max() });
+                AddAttackAnimation("attack1", 1.0f, { { "muzzle", { Item::WeaponType_Ranged_Gun_2H,{ { "fire", "fire" } },{},{} } } }, { 0.0f, 1000.0f });
+                AddAttackAnimation("attack2", 1.0f, { { "muzzle", { Item::WeaponType_Ranged_Gun_2H,{ { "fire", "fire" } },{},{} } } }, { 0.0f, 1000.0f });
 
-            AddFootJoint("foota_front", "foota_back");
-            AddFootJoint("footb_front", "footb_back");
-            AddRunParticleTag("dust_0");
-            AddRunParticleTag("dust_1");
+                AddFootJoint("foota_front", "foota_back");
+                AddFootJoint("footb_front", "footb_back");
+                AddRunParticleTag("dust_0");
+                AddRunParticleTag("dust_1");
+            });
 
             SetAggroRange(2000.0f);
 
@@ -1150,41 +1183,44 @@ namespace Dwarf
 
             SetMaxHealth(1500.0f);
 
-            SetHeadName("head");
+            BuildArchetype("OrkLord", [this]()
+            {
+                SetHeadName("head");
+
+                AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa" }, });
+                AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_1H, "handb" },
+                                                                           { Item::WeaponType_Ranged_Thrown, "handb" }, });
+
+                AddAttackAnimation("gob_toss_0", 1.0f, { { "handb", { Item::WeaponType_Ranged_Thrown,{ { "throw_0", "throw_0" } },{},{ "attack_sound0", },{} } } });
+                AddAttackAnimation("gob_toss_1", 1.0f, { { "handb",{ Item::WeaponType_Ranged_Thrown,{ { "throw_0", "throw_0" } },{},{ "attack_sound0", },{} } } });
+
+                AddAttackAnimation("attack_0", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
+                AddAttackAnimation("attack_1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
+                AddAttackAnimation("attack_2", 1.0f, { { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
+                AddAttackAnimation("attack_3", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" }, },{},{},{ "woosh0" } } },
+                                                       { "handb", { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" }, },{},{},{ "woosh1" } } } });
+                AddAttackAnimation("attack_4", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" }, { "dmg_startb", "dmg_endb" }, },{ "reset_0", },{},{ "woosh0", "woosh1" } } },
+                                                       { "handb", { Item::WeaponType_Melee_1H, { { "dmg_startc", "dmg_endc" }, },{},{},{ "woosh2" } } } });
+                AddAttackAnimation("attack_5", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" },{ "dmg_startb", "dmg_endb" }, },{ "reset_0", },{},{ "woosh0", "woosh1" } } } });
+                AddAttackAnimation("attack_6", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" }, { "dmg_startb", "dmg_endb" }, },{ "reset_0", },{},{ "woosh0", "woosh1" } } },
+                                                       { "handb", { Item::WeaponType_Melee_1H, { { "dmg_startc", "dmg_endc" }, },{},{},{ "woosh2" } } } });
+                AddAttackAnimation("attack_7", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
+                AddAttackAnimation("attack_8", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{} } } });
+                AddAttackAnimation("attack_9", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
+
+                AddFootJoint("foota_front", "foota_back");
+                AddFootJoint("footb_front", "footb_back");
+                AddRunParticleTag("dust_0");
+                AddRunParticleTag("dust_1");
+                AddRunParticleTag("dust_2");
+                AddRunParticleTag("dust_3");
+                AddRunParticleTag("dust_4");
+
+                SetJawJoint("jaw");
+            });
 
             setPhaseAnimations(_phase);
 
-            AddWeaponAttachment("handa", "weapon_a_0", "weapon_a_1", { { Item::WeaponType_Melee_1H, "handa" }, });
-            AddWeaponAttachment("handb", "weapon_b_0", "weapon_b_1", { { Item::WeaponType_Melee_1H, "handb" },
-                                                                       { Item::WeaponType_Ranged_Thrown, "handb" }, });
-
-            AddAttackAnimation("gob_toss_0", 1.0f, { { "handb", { Item::WeaponType_Ranged_Thrown,{ { "throw_0", "throw_0" } },{},{ "attack_sound0", },{} } } });
-            AddAttackAnimation("gob_toss_1", 1.0f, { { "handb",{ Item::WeaponType_Ranged_Thrown,{ { "throw_0", "throw_0" } },{},{ "attack_sound0", },{} } } });
-
-            AddAttackAnimation("attack_0", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
-            AddAttackAnimation("attack_1", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
-            AddAttackAnimation("attack_2", 1.0f, { { "handb", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
-            AddAttackAnimation("attack_3", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" }, },{},{},{ "woosh0" } } },
-                                                   { "handb", { Item::WeaponType_Melee_1H, { { "dmg_startb", "dmg_endb" }, },{},{},{ "woosh1" } } } });
-            AddAttackAnimation("attack_4", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" }, { "dmg_startb", "dmg_endb" }, },{ "reset_0", },{},{ "woosh0", "woosh1" } } },
-                                                   { "handb", { Item::WeaponType_Melee_1H, { { "dmg_startc", "dmg_endc" }, },{},{},{ "woosh2" } } } });
-            AddAttackAnimation("attack_5", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" },{ "dmg_startb", "dmg_endb" }, },{ "reset_0", },{},{ "woosh0", "woosh1" } } } });
-            AddAttackAnimation("attack_6", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_starta", "dmg_enda" }, { "dmg_startb", "dmg_endb" }, },{ "reset_0", },{},{ "woosh0", "woosh1" } } },
-                                                   { "handb", { Item::WeaponType_Melee_1H, { { "dmg_startc", "dmg_endc" }, },{},{},{ "woosh2" } } } });
-            AddAttackAnimation("attack_7", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
-            AddAttackAnimation("attack_8", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{} } } });
-            AddAttackAnimation("attack_9", 1.0f, { { "handa", { Item::WeaponType_Melee_1H, { { "dmg_start",   "dmg_end" }, },{},{},{ "woosh0" } } } });
-
-            AddFootJoint("foota_front", "foota_back");
-            AddFootJoint("footb_front", "footb_back");
-            AddRunParticleTag("dust_0");
-            AddRunParticleTag("dust_1");
-            AddRunParticleTag("dust_2");
-            AddRunParticleTag("dust_3");
-            AddRunParticleTag("dust_4");
-
-            SetJawJoint("jaw");
-
             _leapWindUpAnimations.AddAnimation("crouch_0", 1.0f);
             _leapAnimations.AddAnimation("leap_0", 1.0f);
             _leapLandAnimations.AddAnimation("land_0", 1.0f);
@@ -1330,7 +1366,7 @@ namespace Dwarf
             {
                 if (IsPlayingAnimation(throwAnim) && HasAnimationTagJustPassed(OrkLordThrowAnimationShowGobboTag))
                 {
-                    auto weapons = GetWeapons<Item::OrkThrowingGobbo>();
+                    const auto& weapons = GetIndexedWeapons<Item::OrkThrowingGobbo>();
                     for (auto weapon : weapons)
                     {
                         weapon->ShowGobbo();
@@ -1394,22 +1430,29 @@ namespace Dwarf
 
         void OrkLord::setPhaseAnimations(OrkLordPhase phase)
         {
-            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
-            ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
-
             switch (phase)
             {
             case OrkLordPhase::ThrowingGoblins:
             case OrkLordPhase::TransitionToBoxing:
                 SetMoveSpeed(300.0f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_0", 1.0f);
-                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_0", 1.0f);
+                UseArchetypeVariant("OrkLordWalking", [this]()
+                {
+                    ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
+                    ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_0", 1.0f);
+                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_0", 1.0f);
+                });
                 break;
 
             case OrkLordPhase::Boxing:
                 SetMoveSpeed(600.0f);
-                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 1.0f);
-                AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_1", 1.0f);
+                UseArchetypeVariant("OrkLordBoxing", [this]()
+                {
+                    ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
+                    ClearTerrainAnimations(AnimationType_Move, Pathfinding::EdgeType_Walk);
+                    AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "idle_1", 1.0f);
+                    AddTerrainAnimation(AnimationType_Move, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, "walk_1", 1.0f);
+                });
                 break;
             }
         }
@@ -81,6 +81,7 @@ namespace Dwarf
 
             void setShieldState(ShieldState state);
             void onPostShieldSwitch(ShieldState state);
+            void clearShieldAnimations();
 
             float _transitionTimer = 0.0f;
 
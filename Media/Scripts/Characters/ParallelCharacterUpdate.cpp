@@ -0,0 +1,73 @@
+#include "Characters/ParallelCharacterUpdate.hpp"
+#include "Characters/SkeletonCharacter.hpp"
+#include "Level/LevelInstance.hpp"
+#include "Level/LevelLayerInstance.hpp"
+#include "Profiler.hpp"
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        ParallelCharacterUpdate::ParallelCharacterUpdate(Threading::JobSystem& jobs)
+            : _jobs(jobs)
+            , _commandBuffers()
+            , _characters()
+            , _enabled(true)
+        {
+            for (uint32_t i = 0; i < _jobs.GetThreadCount(); i++)
+            {
+                _commandBuffers.push_back(std::unique_ptr<CharacterCommandBuffer>(new CharacterCommandBuffer()));
+            }
+        }
+
+        void ParallelCharacterUpdate::SetEnabled(bool enabled)
+        {
+            _enabled = enabled;
+        }
+
+        bool ParallelCharacterUpdate::IsEnabled() const
+        {
+            return _enabled;
+        }
+
+        void ParallelCharacterUpdate::Update(Level::LevelInstance* level, double totalTime, float dt)
+        {
+            // Characters that are skipped here run their parallel update inline from OnUpdate
+            if (!_enabled)
+            {
+                return;
+            }
+
+            PROFILE_ZONE("ParallelCharacterUpdate::Update");
+
+            _characters.clear();
+            for (uint32_t i = 0; i < level->GetLayerCount(); i++)
+            {
+                for (auto character : level->GetLayer(i)->GetCharacters<SkeletonCharacter>())
+                {
+                    if (!character->IsDormant())
+                    {
+                        _characters.push_back(character);
+                    }
+                }
+            }
+
+            _jobs.ParallelFor(static_cast<uint32_t>(_characters.size()), [&](uint32_t index, uint32_t worker)
+            {
+                PROFILE_ZONE("SkeletonCharacter::ParallelUpdate");
+
+                SkeletonCharacter* character = _characters[index];
+                CharacterCommandBuffer& commands = *_commandBuffers[worker];
+                commands.SetSource(character->GetLevelLayer(), character->GetID());
+                character->ParallelUpdate(totalTime, dt, commands);
+            });
+
+            std::vector<CharacterCommandBuffer*> buffers;
+            for (auto& buffer : _commandBuffers)
+            {
+                buffers.push_back(buffer.get());
+            }
+            CharacterCommandBuffer::Execute(level, buffers);
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Characters/CharacterCommandBuffer.hpp"
+#include "JobSystem.hpp"
+#include "NonCopyable.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        class SkeletonCharacter;
+
+        // Runs the self contained part of every skeleton character's update (pose evaluation and animation tag
+        // scanning) across the process' job system before the characters are updated one after another. Side effects
+        // on the rest of the level are recorded to a command buffer per thread and applied once all characters are done.
+        class ParallelCharacterUpdate : public NonCopyable
+        {
+        public:
+            ParallelCharacterUpdate(Threading::JobSystem& jobs = Threading::JobSystem::GetShared());
+
+            void SetEnabled(bool enabled);
+            bool IsEnabled() const;
+
+            void Update(Level::LevelInstance* level, double totalTime, float dt);
+
+        private:
+            Threading::JobSystem& _jobs;
+            std::vector<std::unique_ptr<CharacterCommandBuffer>> _commandBuffers;
+            std::vector<SkeletonCharacter*> _characters;
+            bool _enabled;
+        };
+    }
+}
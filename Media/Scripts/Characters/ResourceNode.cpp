@@ -15,6 +15,7 @@ namespace Dwarf
             : SkeletonCharacter(parameters, skeletonPath, materialSetPath)
             , _resources(resources)
             , _mineCursor(nullptr)
+            , _depleted(resources == Item::Resources())
         {
             SetEntityMask(resources.Gold > 0 ? CharacterMask_Usable : 0);
 
@@ -23,6 +24,8 @@ namespace Dwarf
             DisablePhysics();
             SetInvulnerable(true);
             SetSkeletonJointStrength(0.0f);
+
+            SetCanSleep(true);
         }
 
         const App::Cursor* ResourceNode::GetInteractCursor() const
@@ -42,6 +45,8 @@ namespace Dwarf
                 Item::Resources ammount = _resources;
                 _resources = Item::Resources();
                 SetEntityMask(GetEntityMask() & ~CharacterMask_Usable);
+                _depleted = true;
+                Wake();
                 return ammount;
             }
         }
@@ -72,15 +77,23 @@ namespace Dwarf
         void ResourceNode::OnUpdate(double totalTime, float dt)
         {
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
 
-            // Check if empty
-            if (_resources == Item::Resources())
+            if (_depleted)
             {
                 EnablePhysics(true);
                 PushAction(CreateDeathAction(), false);
             }
         }
 
+        bool ResourceNode::IsIdle() const
+        {
+            return SkeletonCharacter::IsIdle() && !_depleted;
+        }
+
         static const std::string GoldNodeSkeletonPath = "Skeletons/Characters/skellynode/skellynode.skel";
         static const std::string GoldNodeMatsetPath = "Skeletons/Characters/skellynode/minesnode.polymatset";
 
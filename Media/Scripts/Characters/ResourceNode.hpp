@@ -27,9 +27,12 @@ namespace Dwarf
 
             virtual void OnUpdate(double totalTime, float dt) override;
 
+            virtual bool IsIdle() const override;
+
         private:
             const App::Cursor* _mineCursor;
             Item::Resources _resources;
+            bool _depleted;
         };
 
         class GoldNode : public ResourceNode
@@ -1,4 +1,6 @@
 #include "Characters/SkeletonCharacter.hpp"
+#include "Audio/SoundEventScheduler.hpp"
+#include "Characters/DormancyManager.hpp"
 
 #include "Physics/SkeletonCollision.hpp"
 #include "HUD/Tooltip.hpp"
@@ -29,6 +31,8 @@ namespace Dwarf
 
             , _materialOptions()
 
+            , _parallelUpdated(false)
+
             , _hasPendingAnimation(false)
             , _pendingAnimation()
 
@@ -234,6 +238,9 @@ namespace Dwarf
 
         void SkeletonCharacter::OnUnloadContent()
         {
+            // Terminated while asleep, leave the dormancy cells while the bounds still come from the skeleton
+            Wake();
+
             SafeRelease(_skeleton);
             _brokenPieces.clear();
 
@@ -254,25 +261,27 @@ namespace Dwarf
 
         void SkeletonCharacter::OnUpdate(double totalTime, float dt)
         {
-            if (_hasPendingAnimation)
+            if (_dormant)
             {
-                _hasPendingAnimation = false;
-                if (!_pendingAnimation.loop ||
-                    (_pendingAnimation.loop && (!_skeleton->IsLooping() || _skeleton->GetCurrentAnimationSet() != _pendingAnimation.animationSet)))
-                {
-                    _skeleton->PlayAnimationSet(_pendingAnimation.animationSet, _pendingAnimation.loop,
-                                                _pendingAnimation.transitionTime, _pendingAnimation.startOffset);
-                }
+                return;
             }
 
-            float animationDT = dt;
-            if (_playFastAnimationsForMoving && IsMoving())
+            // Characters spawned after the level's parallel update, or updated while it is disabled, run it here
+            if (!_parallelUpdated)
             {
-                animationDT *= GetMoveSpeedMultiplier();
+                CharacterCommandBuffer commands;
+                commands.SetSource(GetLevelLayer(), GetID());
+                OnParallelUpdate(totalTime, dt, commands);
+                commands.Execute(GetLevel());
             }
-            else if (_playFastAnimationsForAttacking && IsAttacking())
+            _parallelUpdated = false;
+
+            // Checked after the pending animation has been consumed, a prop whose animation has just finished can sleep
+            if (_canSleep && _dormancy && IsIdle() && !_dormancy->IsInView(GetLevelLayer(), GetBounds()))
             {
-                animationDT *= GetAttackSpeedMultiplier();
+                _dormant = true;
+                _dormancy->Sleep(this);
+                return;
             }
 
             _physicsSoundResetTimer -= dt;
@@ -294,10 +303,9 @@ namespace Dwarf
                         static const float MaxVolumeVelocity = 3000.0f;
                         float volume = Saturate((velocity - VelocityThreshold) / MaxVolumeVelocity);
 
-                        auto soundManager = GetLevel()->GetSoundManager();
-                        soundManager->PlaySinglePositionalSound(_physicsMaterialSounds.GetNextSound(), Audio::SoundPriority::High,
-                                                                contact.Position, PhysicsCollisionSoundRadius.first, PhysicsCollisionSoundRadius.second,
-                                                                PhysicsCollisionSoundVolume * volume);
+                        Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Impact, _physicsMaterialSounds.GetNextSound(), Audio::SoundPriority::High,
+                                              contact.Position, PhysicsCollisionSoundRadius.first, PhysicsCollisionSoundRadius.second,
+                                              PhysicsCollisionSoundVolume * volume);
 
                         static const float ResetTime = 0.1f;
                         _physicsSoundResetTimer = ResetTime;
@@ -306,18 +314,52 @@ namespace Dwarf
                 }
             };
 
-            _skeleton->Update(totalTime, animationDT);
             _collision->Update(totalTime, dt);
             checkForPhysicsMaterialSounds(_collision);
 
             for (auto& brokenMat : _brokenPieces)
             {
-                brokenMat.skeleton->Update(totalTime, dt);
                 brokenMat.collision->Update(totalTime, dt);
                 checkForPhysicsMaterialSounds(brokenMat.collision);
             }
         }
 
+        void SkeletonCharacter::ParallelUpdate(double totalTime, float dt, CharacterCommandBuffer& commands)
+        {
+            OnParallelUpdate(totalTime, dt, commands);
+            _parallelUpdated = true;
+        }
+
+        void SkeletonCharacter::OnParallelUpdate(double totalTime, float dt, CharacterCommandBuffer& commands)
+        {
+            if (_hasPendingAnimation)
+            {
+                _hasPendingAnimation = false;
+                if (!_pendingAnimation.loop ||
+                    (_pendingAnimation.loop && (!_skeleton->IsLooping() || _skeleton->GetCurrentAnimationSet() != _pendingAnimation.animationSet)))
+                {
+                    _skeleton->PlayAnimationSet(_pendingAnimation.animationSet, _pendingAnimation.loop,
+                                                _pendingAnimation.transitionTime, _pendingAnimation.startOffset);
+                }
+            }
+
+            float animationDT = dt;
+            if (_playFastAnimationsForMoving && IsMoving())
+            {
+                animationDT *= GetMoveSpeedMultiplier();
+            }
+            else if (_playFastAnimationsForAttacking && IsAttacking())
+            {
+                animationDT *= GetAttackSpeedMultiplier();
+            }
+
+            _skeleton->Update(totalTime, animationDT);
+            for (auto& brokenMat : _brokenPieces)
+            {
+                brokenMat.skeleton->Update(totalTime, dt);
+            }
+        }
+
         void SkeletonCharacter::OnDraw(Graphics::LevelRenderer* levelRenderer) const
         {
             if (_drawSkeleton)
@@ -331,6 +373,22 @@ namespace Dwarf
             return _skeleton;
         }
 
+        bool SkeletonCharacter::IsDormant() const
+        {
+            return _dormant;
+        }
+
+        void SkeletonCharacter::Wake()
+        {
+            if (!_dormant)
+            {
+                return;
+            }
+
+            _dormant = false;
+            _dormancy->Wake(this);
+        }
+
         void SkeletonCharacter::SetIcon(const std::string& iconMatsetPath, const std::string& iconMaterialName)
         {
             _aliveIconMatsetPath = iconMatsetPath;
@@ -428,6 +486,24 @@ namespace Dwarf
             _physicsMaterialSounds.AddSounds(sounds);
         }
 
+        void SkeletonCharacter::SetCanSleep(bool canSleep)
+        {
+            _canSleep = canSleep;
+            if (!_canSleep)
+            {
+                Wake();
+            }
+        }
+
+        bool SkeletonCharacter::IsIdle() const
+        {
+            // Looping animations are let go, their phase is not noticeable once the prop comes back into view
+            return !_hasPendingAnimation &&
+                   (_skeleton->IsAnimationFinished() || _skeleton->IsLooping()) &&
+                   _brokenPieces.empty() &&
+                   _collision->GetBehavior() != Physics::CollisionBehavior_Dynamic;
+        }
+
         void SkeletonCharacter::InsertBrokenMaterial(const Animation::BrokenMaterial material)
         {
             _brokenPieces.push_back(material);
@@ -480,6 +556,8 @@ namespace Dwarf
 
         float SkeletonCharacter::PlayAnimation(const std::string& anim, bool loop, float transitionTime, float startOffset)
         {
+            Wake();
+
             _hasPendingAnimation = true;
             _pendingAnimation.animationSet.Clear();
             _pendingAnimation.animationSet.AddAnimation(anim, 1.0f);
@@ -491,6 +569,8 @@ namespace Dwarf
 
         float SkeletonCharacter::PlayAnimationSet(const Animation::AnimationSet& animSet, bool loop, float transitionTime, float startOffset)
         {
+            Wake();
+
             _hasPendingAnimation = true;
             _pendingAnimation.animationSet = animSet;
             _pendingAnimation.loop = loop;
@@ -583,6 +663,8 @@ namespace Dwarf
                 _collision->SetPosition(GetPosition());
             }
 
+            _dormancy = GetDormancyManager(this);
+
             Character::OnSpawn();
         }
 
@@ -7,6 +7,7 @@
 
 #include "MaterialSelector.hpp"
 #include "SkeletonUtility.hpp"
+#include "Characters/CharacterCommandBuffer.hpp"
 
 #include "SoundSet.hpp"
 
@@ -14,6 +15,8 @@ namespace Dwarf
 {
     namespace Character
     {
+        class DormancyManager;
+
         class SkeletonCharacter : public Character
         {
         public:
@@ -56,10 +59,18 @@ namespace Dwarf
 
             virtual void OnUpdate(double totalTime, float dt) override;
 
+            // Runs OnParallelUpdate from a worker thread ahead of OnUpdate, which then skips it for this frame
+            void ParallelUpdate(double totalTime, float dt, CharacterCommandBuffer& commands);
+
             virtual void OnDraw(Graphics::LevelRenderer* levelRenderer) const override;
 
             Animation::SkeletonInstance* GetSkeleton() const;
 
+            // Props that can sleep stop updating once they are idle and out of view, until the level's camera moves
+            // over them or they are woken here. Playing an animation wakes the character.
+            bool IsDormant() const;
+            void Wake();
+
         protected:
             void SetIcon(const std::string& iconMatsetPath, const std::string& iconMaterialName);
             void SetDeadIcon(const std::string& iconMatsetPath, const std::string& iconMaterialName);
@@ -85,12 +96,24 @@ namespace Dwarf
 
             void SetMaterialCollisionSound(const Audio::SoundPathVector& sounds);
 
+            void SetCanSleep(bool canSleep);
+
+            // Whether skipping the character's update would change nothing, props extend this with their own state
+            virtual bool IsIdle() const;
+
             void InsertBrokenMaterial(const Animation::BrokenMaterial material);
 
             void AddCustomAttachPoint(const std::string& name, const std::string& jointA, const std::string&jointB);
 
             virtual Physics::Collision* CreateCollision();
 
+            // The part of the update that only touches this character and may run on any thread, effects on anything
+            // else have to be recorded to the command buffer. Of the engine it relies on SkeletonInstance's animation
+            // playback, update, tag and joint queries being safe to call on different instances from different threads:
+            // they only write the instance's own pose and read the skeleton and animations it shares with other
+            // instances. The character's path is read but the path graph is only changed outside of the parallel phase.
+            virtual void OnParallelUpdate(double totalTime, float dt, CharacterCommandBuffer& commands);
+
             virtual void OnSpawn() override;
 
             virtual void OnPositionChange(const Vector2f& oldPos, const Vector2f& newPos) override;
@@ -126,6 +149,12 @@ namespace Dwarf
             typedef std::map<std::string, const Graphics::PolygonMaterialSet*> ChosenMaterialMap;
             ChosenMaterialMap _chosenMaterials;
 
+            bool _parallelUpdated;
+
+            bool _canSleep = false;
+            bool _dormant = false;
+            DormancyManager* _dormancy = nullptr;
+
             bool _hasPendingAnimation;
             struct pendingAnimation
             {
@@ -0,0 +1,90 @@
+#include "Characters/TargetIndex.hpp"
+#include "Levels/BasicLevel.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace Dwarf
+{
+    namespace Character
+    {
+        TargetIndex::TargetIndex(float cellSize)
+            : _layers()
+            , _cellSize(cellSize)
+        {
+            assert(_cellSize > 0.0f);
+        }
+
+        void TargetIndex::Rebuild(Level::LevelInstance* level)
+        {
+            // Entry vectors are kept between rebuilds so that their storage is reused
+            _layers.resize(level->GetLayerCount());
+            for (uint32_t i = 0; i < level->GetLayerCount(); i++)
+            {
+                layerEntries& layerEntry = _layers[i];
+                layerEntry.layer = level->GetLayer(i);
+                layerEntry.entries.clear();
+                layerEntry.minX = std::numeric_limits<int32_t>::max();
+                layerEntry.maxX = std::numeric_limits<int32_t>::min();
+                layerEntry.minY = std::numeric_limits<int32_t>::max();
+                layerEntry.maxY = std::numeric_limits<int32_t>::min();
+
+                // The filter records each character and keeps none of them, so the layer hands back an empty vector instead
+                // of a copy of its character list every frame
+                layerEntry.layer->GetCharacters<Character>([this, &layerEntry](const Character* character)
+                {
+                    const Vector2f& position = character->GetPosition();
+                    const int32_t x = getCellCoordinate(position.X);
+                    const int32_t y = getCellCoordinate(position.Y);
+
+                    layerEntry.minX = Min(layerEntry.minX, x);
+                    layerEntry.maxX = Max(layerEntry.maxX, x);
+                    layerEntry.minY = Min(layerEntry.minY, y);
+                    layerEntry.maxY = Max(layerEntry.maxY, y);
+
+                    entry newEntry;
+                    newEntry.key = getCellKey(x, y);
+                    newEntry.position = position;
+                    newEntry.id = character->GetID();
+                    layerEntry.entries.push_back(newEntry);
+
+                    return false;
+                });
+
+                std::sort(layerEntry.entries.begin(), layerEntry.entries.end(), [](const entry& a, const entry& b)
+                {
+                    return a.key < b.key;
+                });
+            }
+        }
+
+        uint32_t TargetIndex::GetCharacterCount() const
+        {
+            uint32_t count = 0;
+            for (const auto& layerEntry : _layers)
+            {
+                count += static_cast<uint32_t>(layerEntry.entries.size());
+            }
+            return count;
+        }
+
+        TargetIndex::cellKey TargetIndex::getCellKey(int32_t x, int32_t y) const
+        {
+            // Flip the sign bits so that unsigned ordering of the key matches signed ordering of the coordinates
+            const uint64_t row = static_cast<uint32_t>(y) ^ 0x80000000u;
+            const uint64_t column = static_cast<uint32_t>(x) ^ 0x80000000u;
+            return (row << 32) | column;
+        }
+
+        int32_t TargetIndex::getCellCoordinate(float value) const
+        {
+            return static_cast<int32_t>(std::floor(value / _cellSize));
+        }
+
+        const TargetIndex* GetTargetIndex(const Character* character)
+        {
+            const Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(character->GetLevel());
+            return basicLevel ? &basicLevel->GetTargetIndex() : nullptr;
+        }
+    }
+}
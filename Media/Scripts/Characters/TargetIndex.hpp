@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Character/Character.hpp"
+#include "Geometry/Vector2.hpp"
+#include "Level/LevelLayerInstance.hpp"
+#include "NonCopyable.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        class LevelInstance;
+    }
+
+    namespace Character
+    {
+        // Keeps the best (lowest scoring) targets offered to it, up to the limit, in a heap. The storage is kept when the
+        // selection is reset so that a selection reused every frame does not allocate.
+        template <typename scoreT = float>
+        class TargetSelection
+        {
+        public:
+            static const uint32_t Unlimited = std::numeric_limits<uint32_t>::max();
+
+            TargetSelection(uint32_t limit = Unlimited);
+
+            // Drops the kept targets and starts a new selection
+            void Reset(uint32_t limit = Unlimited);
+
+            void Offer(Character* character, const scoreT& score);
+
+            // Sorts the kept targets best first, no more targets can be offered afterwards
+            void Finish();
+
+            uint32_t GetCount() const;
+            Character* GetTarget(uint32_t idx) const;
+            const scoreT& GetScore(uint32_t idx) const;
+
+        private:
+            using entry = std::pair<scoreT, Character*>;
+
+            static bool compareEntries(const entry& a, const entry& b);
+
+            std::vector<entry> _entries;
+            uint32_t _limit;
+            bool _finished;
+        };
+
+        // Spatial hash of character positions, rebuilt once per frame by the level, for range queries that would
+        // otherwise filter every character in the layer. Positions are those at the last rebuild and characters spawned
+        // since then are not found until the next one.
+        class TargetIndex : public NonCopyable
+        {
+        public:
+            TargetIndex(float cellSize);
+
+            void Rebuild(Level::LevelInstance* level);
+
+            // Offers every character within radius of center that passes filter to the selection, scored by score
+            template <typename scoreT, typename filterFunc, typename scoreFunc>
+            void FindTargets(Level::LevelLayerInstance* layer, const Vector2f& center, float radius, filterFunc filter,
+                             scoreFunc score, TargetSelection<scoreT>& selection) const;
+
+            uint32_t GetCharacterCount() const;
+
+        private:
+            using cellKey = uint64_t;
+            cellKey getCellKey(int32_t x, int32_t y) const;
+            int32_t getCellCoordinate(float value) const;
+
+            struct entry
+            {
+                cellKey key;
+                Vector2f position;
+                CharacterID id;
+            };
+
+            struct layerEntries
+            {
+                Level::LevelLayerInstance* layer;
+                std::vector<entry> entries;
+
+                // Occupied cell bounds, queries with very large radii only walk these
+                int32_t minX;
+                int32_t maxX;
+                int32_t minY;
+                int32_t maxY;
+            };
+            std::vector<layerEntries> _layers;
+
+            const float _cellSize;
+        };
+
+        // Level wide index when the character's level provides one, nullptr otherwise
+        const TargetIndex* GetTargetIndex(const Character* character);
+    }
+}
+
+#include "TargetIndex.inl"
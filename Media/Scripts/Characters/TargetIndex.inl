@@ -0,0 +1,138 @@
+namespace Dwarf
+{
+    namespace Character
+    {
+        template <typename scoreT>
+        TargetSelection<scoreT>::TargetSelection(uint32_t limit)
+            : _entries()
+            , _limit(limit)
+            , _finished(false)
+        {
+            if (_limit != Unlimited)
+            {
+                _entries.reserve(_limit);
+            }
+        }
+
+        template <typename scoreT>
+        void TargetSelection<scoreT>::Reset(uint32_t limit)
+        {
+            _entries.clear();
+            _limit = limit;
+            _finished = false;
+        }
+
+        template <typename scoreT>
+        void TargetSelection<scoreT>::Offer(Character* character, const scoreT& score)
+        {
+            assert(!_finished);
+            if (_limit == 0)
+            {
+                return;
+            }
+
+            // Max heap on score so the worst kept target is always at the front
+            if (_entries.size() < _limit)
+            {
+                _entries.push_back(entry(score, character));
+                std::push_heap(_entries.begin(), _entries.end(), compareEntries);
+            }
+            else if (score < _entries.front().first)
+            {
+                std::pop_heap(_entries.begin(), _entries.end(), compareEntries);
+                _entries.back() = entry(score, character);
+                std::push_heap(_entries.begin(), _entries.end(), compareEntries);
+            }
+        }
+
+        template <typename scoreT>
+        void TargetSelection<scoreT>::Finish()
+        {
+            if (!_finished)
+            {
+                std::sort_heap(_entries.begin(), _entries.end(), compareEntries);
+                _finished = true;
+            }
+        }
+
+        template <typename scoreT>
+        uint32_t TargetSelection<scoreT>::GetCount() const
+        {
+            return static_cast<uint32_t>(_entries.size());
+        }
+
+        template <typename scoreT>
+        Character* TargetSelection<scoreT>::GetTarget(uint32_t idx) const
+        {
+            assert(_finished && idx < _entries.size());
+            return _entries[idx].second;
+        }
+
+        template <typename scoreT>
+        const scoreT& TargetSelection<scoreT>::GetScore(uint32_t idx) const
+        {
+            assert(_finished && idx < _entries.size());
+            return _entries[idx].first;
+        }
+
+        template <typename scoreT>
+        bool TargetSelection<scoreT>::compareEntries(const entry& a, const entry& b)
+        {
+            return a.first < b.first;
+        }
+
+        template <typename scoreT, typename filterFunc, typename scoreFunc>
+        void TargetIndex::FindTargets(Level::LevelLayerInstance* layer, const Vector2f& center, float radius, filterFunc filter,
+                                      scoreFunc score, TargetSelection<scoreT>& selection) const
+        {
+            const layerEntries* layerIndex = nullptr;
+            for (const auto& layerEntry : _layers)
+            {
+                if (layerEntry.layer == layer)
+                {
+                    layerIndex = &layerEntry;
+                    break;
+                }
+            }
+
+            if (!layerIndex)
+            {
+                return;
+            }
+
+            const std::vector<entry>& entries = layerIndex->entries;
+            const float radiusSquared = radius * radius;
+
+            const int32_t minX = Max(getCellCoordinate(center.X - radius), layerIndex->minX);
+            const int32_t maxX = Min(getCellCoordinate(center.X + radius), layerIndex->maxX);
+            const int32_t minY = Max(getCellCoordinate(center.Y - radius), layerIndex->minY);
+            const int32_t maxY = Min(getCellCoordinate(center.Y + radius), layerIndex->maxY);
+
+            // Entries are sorted by row then column so each row of cells in range is one contiguous run
+            for (int32_t y = minY; y <= maxY; y++)
+            {
+                const cellKey firstKey = getCellKey(minX, y);
+                const cellKey lastKey = getCellKey(maxX, y);
+
+                auto iter = std::lower_bound(entries.begin(), entries.end(), firstKey, [](const entry& e, cellKey key)
+                {
+                    return e.key < key;
+                });
+
+                for (; iter != entries.end() && iter->key <= lastKey; iter++)
+                {
+                    if (Vector2f::DistanceSquared(center, iter->position) > radiusSquared)
+                    {
+                        continue;
+                    }
+
+                    Character* character = layer->GetCharacter(iter->id);
+                    if (character && filter(character))
+                    {
+                        selection.Offer(character, score(character));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -1,6 +1,9 @@
 #include "Characters/Torch.hpp"
 
 #include "Drawables/Flame.hpp"
+#include "Drawables/FlameManager.hpp"
+#include "Drawables/LightCuller.hpp"
+#include "Levels/BasicLevel.hpp"
 
 #include "ContentUtility.hpp"
 
@@ -16,6 +19,8 @@ namespace Dwarf
                                  bool castsShadows, bool startOn, bool playSounds)
             : SkeletonCharacter(parameters, skeleton, materialSet)
             , _flame(nullptr)
+            , _flameManager(nullptr)
+            , _lightCuller(nullptr)
             , _lightJoint(lightJoint)
             , _particleJoint(particleJoint)
         {
@@ -24,6 +29,7 @@ namespace Dwarf
 
             DisablePhysics();
             SetInvulnerable(true);
+            SetCanSleep(true);
 
             SetSkeletonCastsShadows(false);
             SetSkeletonScale(1.0f);
@@ -58,6 +64,7 @@ namespace Dwarf
             if (on != _flame->IsOn())
             {
                 _flame->SetState(on);
+                Wake();
             }
         }
 
@@ -71,10 +78,32 @@ namespace Dwarf
             SkeletonCharacter::OnLoadContent(contentManager);
             _flame->LoadContent(contentManager);
             AttachDrawable(_particleJoint, _flame.get());
+
+            Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(GetLevel());
+            if (basicLevel)
+            {
+                _flameManager = &basicLevel->GetFlameManager();
+                _flameManager->AddFlame(_flame.get());
+
+                // Flame holders never move, their lights are submitted by the level when they reach the view
+                _lightCuller = &basicLevel->GetLightCuller();
+                _lightCuller->AddStaticFlame(GetLevelLayer(), _flame.get());
+            }
         }
 
         void FlameHolder::OnUnloadContent()
         {
+            if (_flameManager)
+            {
+                _flameManager->RemoveFlame(_flame.get());
+                _flameManager = nullptr;
+            }
+            if (_lightCuller)
+            {
+                _lightCuller->RemoveStaticFlame(_flame.get());
+                _lightCuller = nullptr;
+            }
+
             DetachDrawable(_particleJoint, _flame.get());
             _flame->UnloadContent();
             SkeletonCharacter::OnUnloadContent();
@@ -83,16 +112,26 @@ namespace Dwarf
         void FlameHolder::OnUpdate(double totalTime, float dt)
         {
             SkeletonCharacter::OnUpdate(totalTime, dt);
+            if (IsDormant())
+            {
+                return;
+            }
+
             _flame->SetScale(GetScale());
             _flame->SetPosition(GetSkeleton()->GetJointPosition(_lightJoint));
-            _flame->Update(totalTime, dt);
+
+            // Registered flames are updated in a batch by the level's flame manager
+            if (!_flameManager)
+            {
+                _flame->Update(totalTime, dt);
+            }
         }
 
         void FlameHolder::OnDraw(Graphics::LevelRenderer* levelRenderer) const
         {
             SkeletonCharacter::OnDraw(levelRenderer);
 
-            if (_flame->ShouldDrawLights())
+            if (!_lightCuller && _flame->ShouldDrawLights())
             {
                 levelRenderer->AddLight(_flame->GetCenterLight());
                 levelRenderer->AddLight(_flame->GetMainLight());
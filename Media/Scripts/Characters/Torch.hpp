@@ -9,6 +9,8 @@ namespace Dwarf
     namespace Graphics
     {
         class Flame;
+        class FlameManager;
+        class LightCuller;
     }
 
     namespace Character
@@ -48,6 +50,8 @@ namespace Dwarf
             void forceSetOn(bool on, bool firstUpdate);
 
             std::shared_ptr<Graphics::Flame> _flame;
+            Graphics::FlameManager* _flameManager;
+            Graphics::LightCuller* _lightCuller;
             std::string _lightJoint;
             std::string _particleJoint;
         };
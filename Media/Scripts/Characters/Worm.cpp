@@ -85,17 +85,22 @@ namespace Dwarf
             SetMoveType(MoveType_None);
             SetAttachToGroundOnSpawn(true);
             SetMaxHealth(70.0f);
-            SetHeadName("los");
 
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, WormIdleHiddenAnimation, 1.0f);
+            BuildArchetype("Worm", [this]()
+            {
+                SetHeadName("los");
 
-            SetItemSlotCount(Item::ItemSlot::Weapon, 1);
-            AddWeaponAttachment(WormRangeBaseJoint, WormRangeBaseJoint, WormRangeExtentJoint, { { Item::WeaponType_Melee_1H, WormRangeBaseJoint } });
-            AddAttackAnimation("attack1", 1.0f, { { WormRangeBaseJoint, { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" }, }, {}, { "attack_sound0", } } } });
-            AddAttackAnimation("attack2", 1.0f, { { WormRangeBaseJoint, { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" }, }, {}, { "attack_sound0", } } } });
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, WormIdleHiddenAnimation, 1.0f);
+                AddWeaponAttachment(WormRangeBaseJoint, WormRangeBaseJoint, WormRangeExtentJoint, { { Item::WeaponType_Melee_1H, WormRangeBaseJoint } });
+                AddAttackAnimation("attack1", 1.0f, { { WormRangeBaseJoint, { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" }, }, {}, { "attack_sound0", } } } });
+                AddAttackAnimation("attack2", 1.0f, { { WormRangeBaseJoint, { Item::WeaponType_Melee_1H, { { "dmg_start", "dmg_end" }, }, {}, { "attack_sound0", } } } });
+
+                AddIdleSounds(WormIdleSoundPaths);
+                AddAttackSounds(WormAttackSoundPaths);
+                AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
+            });
 
-            AddIdleSounds(WormIdleSoundPaths);
-            AddAttackSounds(WormAttackSoundPaths);
+            SetItemSlotCount(Item::ItemSlot::Weapon, 1);
             SetAttackSoundPlayChance(0.3f);
             _wormEmergedSounds.AddSounds(WormIdleSoundPaths);
 
@@ -104,7 +109,6 @@ namespace Dwarf
             SetAggroRange(1000.0f);
 
             SetBodyMaterial(MaterialType_Type_Flesh);
-            AddDamageSounds(Audio::GetStandardOnFleshDamageSoundPaths());
         }
 
         float Worm::GetAttackRange() const
@@ -195,8 +199,11 @@ namespace Dwarf
 
         void Worm::emerge()
         {
-            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, WormIdleExposedAnimation, 1.0f);
+            UseArchetypeVariant("WormExposed", [this]()
+            {
+                ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, WormIdleExposedAnimation, 1.0f);
+            });
 
             PlayAnimation(WormEmergeAnimation, false, 0.0f, 0.0f);
             _emerging = true;
@@ -208,8 +215,11 @@ namespace Dwarf
 
         void Worm::hide()
         {
-            ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
-            AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, WormIdleHiddenAnimation, 1.0f);
+            UseArchetypeVariant("WormHidden", [this]()
+            {
+                ClearTerrainAnimations(AnimationType_Idle, Pathfinding::EdgeType_Walk);
+                AddTerrainAnimation(AnimationType_Idle, Pathfinding::EdgeType_Walk, Pathfinding::TerrainType::All, -PiOver2, AnimationVariant_Standard, WormIdleHiddenAnimation, 1.0f);
+            });
 
             PlayAnimation(WormHideAnimation, false, 0.0f, 0.0f);
             SetEntityMask(CharacterMask_None);
@@ -12,6 +12,7 @@
 #include "Characters/Dwarves/NavigatorDwarf.hpp"
 
 #include "NavigationUtility.hpp"
+#include "Profiler.hpp"
 
 #include "HUD/Minimap.hpp"
 #include "HUD/SelectionArea.hpp"
@@ -520,6 +521,13 @@ namespace Dwarf
                     _debugger->AddElement("Physics", "Draw active percent", debugElement);
                 }
 
+#ifdef DWARF_PROFILER_ENABLED
+                {
+                    auto profilerElement = std::make_shared<HUD::ProfilerDebuggerElement>();
+                    _debugger->AddElement("Performance", "Profiler", profilerElement);
+                }
+#endif
+
                 {
                     auto spawnCharacterElement = HUD::CreateStandardCharacterSpawnerElement(contentManager, lvl->GetPrimaryLayer(), [this]() { return _mousePosWorld; });
                     _debugger->AddBindableElement("Spawn Character", spawnCharacterElement);
@@ -565,6 +573,35 @@ namespace Dwarf
         }
 
         void Player::OnUpdate(const Input::FrameInput& input, double totalTime, float dt)
+        {
+            PROFILE_ZONE("Player::OnUpdate");
+            Level::ScopedSimulationTimer updateTimer(Level::GetSimulationBenchmark(GetLevel()), Level::SimulationStage_ControllerUpdate);
+
+            Level::BasicLevel* basicLevel = AsA<Level::BasicLevel>(GetLevel());
+            Input::InputSession* inputSession = basicLevel ? &basicLevel->GetInputSession() : nullptr;
+
+            const Input::GameInputFrame* replayFrame = inputSession ? inputSession->NextReplayFrame() : nullptr;
+            if (replayFrame)
+            {
+                // The rest of the level is stepped with the engine's dt, a replay only matches when it runs at a fixed step
+                static const float ReplayDtTolerance = 0.0001f;
+                if (!_replayDtMismatchLogged && Abs(replayFrame->Dt - dt) > ReplayDtTolerance)
+                {
+                    LogWarning("Player", Format("Replayed frame %u was recorded with dt %f but is updated with dt %f, the simulation may diverge.",
+                                                inputSession->GetFrameIndex() - 1, replayFrame->Dt, dt));
+                    _replayDtMismatchLogged = true;
+                }
+
+                update(Input::GameInput(*replayFrame), input, totalTime, replayFrame->Dt);
+            }
+            else
+            {
+                Input::GameInputFrame* recordFrame = inputSession ? inputSession->BeginRecordedFrame(dt) : nullptr;
+                update(Input::GameInput(input, recordFrame), input, totalTime, dt);
+            }
+        }
+
+        void Player::update(const Input::GameInput& input, const Input::FrameInput& liveInput, double totalTime, float dt)
         {
             if (_firstUpdate)
             {
@@ -645,12 +682,13 @@ namespace Dwarf
 
             bool mouseOverUI = false;
 
-            if (input.IsBindJustPressed(_showDebugUIBind))
+            if (liveInput.IsBindJustPressed(_showDebugUIBind))
             {
                 _debugger->SetVisible(!_debugger->IsVisible());
             }
 
-            _debugger->Update(totalTime, dt, input);
+            // The debugger is not part of the simulation and always reads the live input
+            _debugger->Update(totalTime, dt, liveInput);
             mouseOverUI = mouseOverUI || _debugger->IsMouseOver();
 
             _hudPauseButton->Update(totalTime, dt, input, hudCamera);
@@ -1443,7 +1481,7 @@ namespace Dwarf
             _curContext = newContext;
         }
 
-        void Player::panCamera(const Vector2f& mousePos, const Rectanglef& viewport, const Input::FrameInput& input, float dt)
+        void Player::panCamera(const Vector2f& mousePos, const Rectanglef& viewport, const Input::GameInput& input, float dt)
         {
             Level::LevelInstance* lvl = GetLevel();
 
@@ -11,6 +11,7 @@
 #include "CharacterSet.hpp"
 #include "Characters/Dwarves/Dwarf.hpp"
 #include "DwarfNameGenerator.hpp"
+#include "GameInput.hpp"
 
 namespace Dwarf
 {
@@ -78,7 +79,9 @@ namespace Dwarf
 
             void setContext(PlayerContext newContext);
 
-            void panCamera(const Vector2f& mousePos, const Rectanglef& viewport, const Input::FrameInput& input, float dt);
+            void update(const Input::GameInput& input, const Input::FrameInput& liveInput, double totalTime, float dt);
+
+            void panCamera(const Vector2f& mousePos, const Rectanglef& viewport, const Input::GameInput& input, float dt);
 
             void SelectedCharactersMove(const Vector2f& destination, bool queue);
             void SelectedCharactersAttack(const Vector2f& destination, bool forced, bool queue);
@@ -195,6 +198,7 @@ namespace Dwarf
             bool _onDefeatScreen;
 
             bool _firstUpdate;
+            bool _replayDtMismatchLogged = false;
 
             float _affirmativeSoundResetTimer = 0.0f;
             float _negatorySoundResetTimer = 0.0f;
@@ -17,6 +17,7 @@ namespace Dwarf
             , _leftEnd()
             , _rightEnd()
             , _rope(NULL)
+            , _skeletonsDirty(true)
             , _bounds()
         {
         }
@@ -52,12 +53,22 @@ namespace Dwarf
 
         void BridgeDrawable::SetColor(const Color& color)
         {
+            if (_color == color)
+            {
+                return;
+            }
+
             _color = color;
             UpdateLinkColors();
         }
 
         void BridgeDrawable::SetBuildPercent(float buildPerc)
         {
+            if (_buildPerc == buildPerc)
+            {
+                return;
+            }
+
             _buildPerc = buildPerc;
             UpdateLinkColors();
         }
@@ -101,6 +112,12 @@ namespace Dwarf
 
         void BridgeDrawable::Update(double totalTime, float dt)
         {
+            if (!_skeletonsDirty)
+            {
+                return;
+            }
+            _skeletonsDirty = false;
+
             _leftEnd->Update(totalTime, dt);
             _rightEnd->Update(totalTime, dt);
             for (uint32_t i = 0; i < _links.size(); i++)
@@ -227,6 +244,7 @@ namespace Dwarf
             _rope->SetChain(ropeChain);
 
             UpdateLinkColors();
+            _skeletonsDirty = true;
         }
 
         void BridgeDrawable::UpdateLinkColors()
@@ -255,6 +273,7 @@ namespace Dwarf
                     _links[linkIdx]->SetColor(color);
                 }
             }
+            _skeletonsDirty = true;
         }
     }
 
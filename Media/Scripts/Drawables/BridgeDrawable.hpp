@@ -58,6 +58,9 @@ namespace Dwarf
 
             RopeDrawable* _rope;
 
+            // The bridge pieces do not animate, they only need updating after they were moved or recolored
+            bool _skeletonsDirty;
+
             Rectanglef _bounds;
         };
     }
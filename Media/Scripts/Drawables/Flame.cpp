@@ -31,8 +31,13 @@ namespace Dwarf
         static const float LoopingSoundFalloffMinDistanceMultiplier = 0.5f;
         static const float LoopingSoundFalloffMaxDistanceMultiplier = 3.0f;
 
+        static const float HiddenLightUpdateInterval = 0.2f;
+        static const float MaxParticleCatchUpTime = 2.0f;
+
         Flame::Flame(const Color& color, bool castsShadows, bool startOn, bool showParticles, bool playSounds, Audio::SoundManager* soundManager, const std::string& particlesPath)
             : _lightTimer(Random::RandomBetween(0.0f, 1.0f))
+            , _pendingLightTime(0.0f)
+            , _pendingParticleTime(0.0f)
 
             , _lightOn(startOn)
             , _transitionTimer(0.0f)
@@ -222,24 +227,31 @@ namespace Dwarf
         }
 
         void Flame::Update(double totalTime, float dt)
+        {
+            Update(totalTime, dt, true, true);
+        }
+
+        void Flame::Update(double totalTime, float dt, bool particlesVisible, bool lightVisible)
         {
             _transitionTimer -= dt;
-            updateLight(dt);
-            updateSounds();
+
+            _pendingLightTime += dt;
+            if (lightVisible || _pendingLightTime >= HiddenLightUpdateInterval)
+            {
+                updateLight(_pendingLightTime);
+                updateSounds();
+                _pendingLightTime = 0.0f;
+            }
 
             if (_partsys)
             {
-                if (!_customParticleSpawner && _particlesPosition != _torchLight.Position)
+                _pendingParticleTime += dt;
+                if (particlesVisible)
                 {
-                    _particlesPosition = _torchLight.Position;
-                    _partsys->SetPointSpawner(_particlesPosition);
+                    // Catch up on everything that was skipped while hidden in one step
+                    updateParticles(totalTime, Min(_pendingParticleTime, MaxParticleCatchUpTime));
+                    _pendingParticleTime = 0.0f;
                 }
-
-                _partsys->SetScale(_scale);
-                _partsys->SetRotation(0.0f);
-                _partsys->Update(totalTime, dt);
-
-                _bounds = _partsys->GetDrawBounds();
             }
             else
             {
@@ -307,6 +319,21 @@ namespace Dwarf
             _centerLight.LightColor.A = 255;
         }
 
+        void Flame::updateParticles(double totalTime, float dt)
+        {
+            if (!_customParticleSpawner && _particlesPosition != _torchLight.Position)
+            {
+                _particlesPosition = _torchLight.Position;
+                _partsys->SetPointSpawner(_particlesPosition);
+            }
+
+            _partsys->SetScale(_scale);
+            _partsys->SetRotation(0.0f);
+            _partsys->Update(totalTime, dt);
+
+            _bounds = _partsys->GetDrawBounds();
+        }
+
         void Flame::updateSounds()
         {
             const Vector2f& flamePosition = _centerLight.Position;
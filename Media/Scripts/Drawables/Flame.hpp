@@ -45,6 +45,7 @@ namespace Dwarf
             bool ShouldDrawLights() const;
 
             void Update(double totalTime, float dt) override;
+            void Update(double totalTime, float dt, bool particlesVisible, bool lightVisible);
 
             // IDrawable
             const Rectanglef& GetDrawBounds() const override;
@@ -58,8 +59,11 @@ namespace Dwarf
         private:
             void updateSounds();
             void updateLight(float dt);
+            void updateParticles(double totalTime, float dt);
 
             float _lightTimer;
+            float _pendingLightTime;
+            float _pendingParticleTime;
 
             bool _lightOn;
             float _transitionTimer;
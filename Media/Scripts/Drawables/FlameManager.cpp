@@ -0,0 +1,77 @@
+#include "Drawables/FlameManager.hpp"
+
+#include "Drawables/Flame.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Dwarf
+{
+    namespace Graphics
+    {
+        static const float DefaultParticleCullMargin = 500.0f;
+
+        FlameManager::FlameManager()
+            : _enabled(true)
+            , _particleCullMargin(DefaultParticleCullMargin)
+            , _flames()
+        {
+        }
+
+        void FlameManager::AddFlame(Flame* flame)
+        {
+            assert(flame);
+            assert(std::find(_flames.begin(), _flames.end(), flame) == _flames.end());
+            _flames.push_back(flame);
+        }
+
+        void FlameManager::RemoveFlame(Flame* flame)
+        {
+            auto iter = std::find(_flames.begin(), _flames.end(), flame);
+            if (iter != _flames.end())
+            {
+                *iter = _flames.back();
+                _flames.pop_back();
+            }
+        }
+
+        void FlameManager::SetParticleCullMargin(float margin)
+        {
+            _particleCullMargin = margin;
+        }
+
+        void FlameManager::SetEnabled(bool enabled)
+        {
+            _enabled = enabled;
+        }
+
+        uint32_t FlameManager::GetFlameCount() const
+        {
+            return static_cast<uint32_t>(_flames.size());
+        }
+
+        void FlameManager::Update(double totalTime, float dt, const Camera& camera)
+        {
+            const Rectanglef viewBounds = camera.GetViewBounds().ToRectangle();
+            const Rectanglef particleBounds(viewBounds.Position - _particleCullMargin, viewBounds.Size + (_particleCullMargin * 2.0f));
+
+            for (Flame* flame : _flames)
+            {
+                if (!_enabled)
+                {
+                    flame->Update(totalTime, dt);
+                    continue;
+                }
+
+                const Vector2f& position = flame->GetCenterLight().Position;
+                const float radius = flame->GetRadius();
+                const Rectanglef lightBounds(position - radius, Vector2f(radius * 2.0f));
+
+                const bool particlesVisible = Rectanglef::Contains(particleBounds, position);
+                const bool lightVisible = Rectanglef::Intersects(viewBounds, lightBounds);
+
+                flame->Update(totalTime, dt, particlesVisible, lightVisible);
+            }
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Geometry/Rectangle.hpp"
+#include "NonCopyable.hpp"
+#include "Camera.hpp"
+
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Graphics
+    {
+        class Flame;
+
+        // Updates every registered flame in a single pass. Flames whose particles are outside of the view (plus a margin)
+        // skip particle simulation and catch up with one large step when they come back into view, flames whose light
+        // cannot reach the view only flicker at a reduced rate.
+        class FlameManager : public NonCopyable
+        {
+        public:
+            FlameManager();
+
+            void AddFlame(Flame* flame);
+            void RemoveFlame(Flame* flame);
+
+            void SetParticleCullMargin(float margin);
+            void SetEnabled(bool enabled);
+
+            uint32_t GetFlameCount() const;
+
+            void Update(double totalTime, float dt, const Camera& camera);
+
+        private:
+            bool _enabled;
+            float _particleCullMargin;
+            std::vector<Flame*> _flames;
+        };
+    }
+}
@@ -0,0 +1,207 @@
+#include "Drawables/LightCuller.hpp"
+
+#include "Drawables/Flame.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Dwarf
+{
+    namespace Graphics
+    {
+        static Rectanglef getFlameBounds(const Flame* flame)
+        {
+            const Vector2f& position = flame->GetCenterLight().Position;
+            const float radius = flame->GetRadius();
+            return Rectanglef(position - radius, Vector2f(radius * 2.0f));
+        }
+
+        static bool circleIntersectsRectangle(const Vector2f& center, float radius, const Rectanglef& rect)
+        {
+            const float dx = Max(Max(rect.Left() - center.X, center.X - rect.Right()), 0.0f);
+            const float dy = Max(Max(rect.Top() - center.Y, center.Y - rect.Bottom()), 0.0f);
+            return (dx * dx) + (dy * dy) <= radius * radius;
+        }
+
+        LightCuller::LightCuller(float tileSize)
+            : _flames()
+            , _tiles()
+            , _candidates()
+            , _drawnCount(0)
+            , _tileSize(tileSize)
+        {
+            assert(_tileSize > 0.0f);
+        }
+
+        void LightCuller::AddStaticFlame(Level::LevelLayerInstance* layer, const Flame* flame)
+        {
+            assert(flame);
+            assert(std::find_if(_flames.begin(), _flames.end(), [flame](const staticFlame& entry) { return entry.flame == flame; }) == _flames.end());
+
+            // Binned on the next update, flames are often placed after they are added
+            staticFlame entry;
+            entry.layer = layer;
+            entry.flame = flame;
+            entry.binnedBounds = Rectanglef();
+            entry.binned = false;
+            _flames.push_back(entry);
+        }
+
+        void LightCuller::RemoveStaticFlame(const Flame* flame)
+        {
+            auto iter = std::find_if(_flames.begin(), _flames.end(), [flame](const staticFlame& entry) { return entry.flame == flame; });
+            if (iter != _flames.end())
+            {
+                unbin(*iter);
+                *iter = _flames.back();
+                _flames.pop_back();
+            }
+        }
+
+        void LightCuller::Update()
+        {
+            for (staticFlame& entry : _flames)
+            {
+                const Rectanglef bounds = getFlameBounds(entry.flame);
+                if (!entry.binned || bounds.Position != entry.binnedBounds.Position || bounds.Size != entry.binnedBounds.Size)
+                {
+                    unbin(entry);
+                    entry.binnedBounds = bounds;
+                    bin(entry);
+                }
+            }
+        }
+
+        void LightCuller::Draw(const Level::LevelLayerInstance* layer, LevelRenderer* levelRenderer) const
+        {
+            PROFILE_ZONE("LightCuller::Draw");
+
+            _drawnCount = 0;
+
+            auto layerIter = _tiles.find(layer);
+            if (layerIter == _tiles.end())
+            {
+                return;
+            }
+
+            const Rectanglef viewBounds = layer->GetCamera().GetViewBounds().ToRectangle();
+
+            // Flames reaching several tiles under the view are gathered once
+            _candidates.clear();
+            forEachTile(viewBounds, [&](tileKey key)
+            {
+                auto tileIter = layerIter->second.find(key);
+                if (tileIter != layerIter->second.end())
+                {
+                    _candidates.insert(_candidates.end(), tileIter->second.begin(), tileIter->second.end());
+                }
+            });
+            std::sort(_candidates.begin(), _candidates.end());
+            _candidates.erase(std::unique(_candidates.begin(), _candidates.end()), _candidates.end());
+
+            for (const Flame* flame : _candidates)
+            {
+                if (!flame->ShouldDrawLights())
+                {
+                    continue;
+                }
+
+                const Lights::PointLight& mainLight = flame->GetMainLight();
+                if (!circleIntersectsRectangle(mainLight.Position, mainLight.Radius, viewBounds))
+                {
+                    continue;
+                }
+
+                levelRenderer->AddLight(flame->GetCenterLight());
+                levelRenderer->AddLight(mainLight);
+                _drawnCount++;
+            }
+        }
+
+        uint32_t LightCuller::GetStaticFlameCount() const
+        {
+            return static_cast<uint32_t>(_flames.size());
+        }
+
+        uint32_t LightCuller::GetDrawnFlameCount() const
+        {
+            return _drawnCount;
+        }
+
+        LightCuller::tileKey LightCuller::getTileKey(int32_t x, int32_t y) const
+        {
+            const uint64_t row = static_cast<uint32_t>(y) ^ 0x80000000u;
+            const uint64_t column = static_cast<uint32_t>(x) ^ 0x80000000u;
+            return (row << 32) | column;
+        }
+
+        int32_t LightCuller::getTileCoordinate(float value) const
+        {
+            return static_cast<int32_t>(std::floor(value / _tileSize));
+        }
+
+        template <typename func>
+        void LightCuller::forEachTile(const Rectanglef& bounds, func function) const
+        {
+            const int32_t minX = getTileCoordinate(bounds.Left());
+            const int32_t maxX = getTileCoordinate(bounds.Right());
+            const int32_t minY = getTileCoordinate(bounds.Top());
+            const int32_t maxY = getTileCoordinate(bounds.Bottom());
+            for (int32_t y = minY; y <= maxY; y++)
+            {
+                for (int32_t x = minX; x <= maxX; x++)
+                {
+                    function(getTileKey(x, y));
+                }
+            }
+        }
+
+        void LightCuller::bin(staticFlame& entry)
+        {
+            auto& tiles = _tiles[entry.layer];
+            forEachTile(entry.binnedBounds, [&](tileKey key)
+            {
+                tiles[key].push_back(entry.flame);
+            });
+            entry.binned = true;
+        }
+
+        void LightCuller::unbin(const staticFlame& entry)
+        {
+            if (!entry.binned)
+            {
+                return;
+            }
+
+            auto layerIter = _tiles.find(entry.layer);
+            if (layerIter == _tiles.end())
+            {
+                return;
+            }
+
+            auto& tiles = layerIter->second;
+            forEachTile(entry.binnedBounds, [&](tileKey key)
+            {
+                auto tileIter = tiles.find(key);
+                if (tileIter == tiles.end())
+                {
+                    return;
+                }
+
+                std::vector<const Flame*>& flames = tileIter->second;
+                flames.erase(std::remove(flames.begin(), flames.end(), entry.flame), flames.end());
+                if (flames.empty())
+                {
+                    tiles.erase(tileIter);
+                }
+            });
+        }
+
+        bool IsLightInView(const Level::LevelLayerInstance* layer, const Lights::PointLight& light)
+        {
+            const Rectanglef viewBounds = layer->GetCamera().GetViewBounds().ToRectangle();
+            return circleIntersectsRectangle(light.Position, light.Radius, viewBounds);
+        }
+    }
+}
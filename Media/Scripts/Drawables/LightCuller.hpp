@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Geometry/Rectangle.hpp"
+#include "Level/LevelLayerInstance.hpp"
+#include "Lights/PointLight.hpp"
+#include "Graphics/LevelRenderer.hpp"
+#include "NonCopyable.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Graphics
+    {
+        class Flame;
+
+        // Submits the lights of flames that never move (torches, braziers, lava and forge fires) to the renderer. Each
+        // static flame is binned once into the world tiles its light can reach and is only re-binned when its position or
+        // radius changes, drawing a layer then only looks at the flames in the tiles under the view. Moving point lights
+        // (flares, fuses, explosion flashes) are submitted by their owners every frame after an IsLightInView test.
+        class LightCuller : public NonCopyable
+        {
+        public:
+            LightCuller(float tileSize);
+
+            void AddStaticFlame(Level::LevelLayerInstance* layer, const Flame* flame);
+            void RemoveStaticFlame(const Flame* flame);
+
+            // Re-bins the static flames that have moved or changed radius since they were binned
+            void Update();
+
+            // Submits the lights of the layer's static flames that reach its view
+            void Draw(const Level::LevelLayerInstance* layer, LevelRenderer* levelRenderer) const;
+
+            uint32_t GetStaticFlameCount() const;
+            uint32_t GetDrawnFlameCount() const;
+
+        private:
+            using tileKey = uint64_t;
+            tileKey getTileKey(int32_t x, int32_t y) const;
+            int32_t getTileCoordinate(float value) const;
+
+            template <typename func>
+            void forEachTile(const Rectanglef& bounds, func function) const;
+
+            struct staticFlame
+            {
+                const Level::LevelLayerInstance* layer;
+                const Flame* flame;
+                Rectanglef binnedBounds;
+                bool binned;
+            };
+
+            void bin(staticFlame& entry);
+            void unbin(const staticFlame& entry);
+
+            std::vector<staticFlame> _flames;
+            std::unordered_map<const Level::LevelLayerInstance*, std::unordered_map<tileKey, std::vector<const Flame*>>> _tiles;
+
+            mutable std::vector<const Flame*> _candidates;
+            mutable uint32_t _drawnCount;
+
+            const float _tileSize;
+        };
+
+        // Whether the light can reach the view of the layer's camera
+        bool IsLightInView(const Level::LevelLayerInstance* layer, const Lights::PointLight& light);
+    }
+}
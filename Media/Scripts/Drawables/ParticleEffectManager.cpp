@@ -0,0 +1,248 @@
+#include "Drawables/ParticleEffectManager.hpp"
+
+#include "ContentUtility.hpp"
+#include "ParticlesUtility.hpp"
+
+#include "Particles/ParticleSystemInstance.hpp"
+
+#include <cmath>
+
+namespace Dwarf
+{
+    namespace Graphics
+    {
+        // Steps a full turn of burst rotation is snapped to, fine enough that dust and splats look unchanged
+        static const uint32_t BurstRotationSteps = 64;
+
+        // Steps each doubling of burst scale is snapped to, about two percent apart so that the sizes characters scale
+        // their effects by share emitters
+        static const float BurstScaleStepsPerDoubling = 32.0f;
+
+        static ParticleBurst snapBurst(const ParticleBurst& burst)
+        {
+            const float step = Rotatorf::TwoPi.Angle / BurstRotationSteps;
+
+            ParticleBurst snapped = burst;
+            snapped.Rotation = Rotatorf(std::round(burst.Rotation.Angle / step) * step);
+            if (burst.Scale > 0.0f)
+            {
+                snapped.Scale = std::exp2(std::round(std::log2(burst.Scale) * BurstScaleStepsPerDoubling) / BurstScaleStepsPerDoubling);
+            }
+            return snapped;
+        }
+
+        static bool isSameTransform(const ParticleBurst& a, const ParticleBurst& b)
+        {
+            return a.Scale == b.Scale && a.Rotation.Angle == b.Rotation.Angle && a.InvertedX == b.InvertedX && a.InvertedY == b.InvertedY;
+        }
+
+        static void applyTransform(Particles::ParticleSystemInstance* particles, const ParticleBurst& transform)
+        {
+            particles->SetScale(transform.Scale);
+            particles->SetRotation(transform.Rotation);
+            particles->SetInvertedX(transform.InvertedX);
+            particles->SetInvertedY(transform.InvertedY);
+        }
+
+        ParticleEffectManager::ParticleEffectManager()
+            : _effects()
+        {
+        }
+
+        ParticleEffectManager::~ParticleEffectManager()
+        {
+            for (auto& effect : _effects)
+            {
+                for (auto& emitter : effect.second.emitters)
+                {
+                    SafeRelease(emitter.particles);
+                }
+            }
+            _effects.clear();
+        }
+
+        void ParticleEffectManager::LoadEffect(Content::ContentManager* contentManager, const std::string& path)
+        {
+            if (path.empty())
+            {
+                return;
+            }
+
+            effect& effect = _effects[path];
+            if (effect.refCount++ == 0)
+            {
+                // One emitter up front holds the asset loaded, more are created by bursts when they are needed
+                assert(effect.emitters.empty());
+                effect.contentManager = contentManager;
+
+                emitter firstEmitter;
+                firstEmitter.layer = nullptr;
+                firstEmitter.transform = ParticleBurst();
+                firstEmitter.particles = Content::CreateParticleSystemInstance(contentManager, path);
+                firstEmitter.active = false;
+                applyTransform(firstEmitter.particles, firstEmitter.transform);
+                effect.emitters.push_back(firstEmitter);
+            }
+        }
+
+        void ParticleEffectManager::UnloadEffect(const std::string& path)
+        {
+            auto iter = _effects.find(path);
+            if (iter == _effects.end())
+            {
+                return;
+            }
+
+            assert(iter->second.refCount > 0);
+            if (--iter->second.refCount == 0)
+            {
+                for (auto& emitter : iter->second.emitters)
+                {
+                    SafeRelease(emitter.particles);
+                }
+                _effects.erase(iter);
+            }
+        }
+
+        void ParticleEffectManager::Burst(Level::LevelLayerInstance* layer, const std::string& path, const Vector2f& position, const ParticleBurst& burst)
+        {
+            Particles::ParticleSystemInstance* particles = prepareBurst(layer, path, burst);
+            if (particles)
+            {
+                particles->SetPointSpawner(position);
+                particles->Burst();
+            }
+        }
+
+        void ParticleEffectManager::Burst(Level::LevelLayerInstance* layer, const std::string& path, const Vector2f& lineStart, const Vector2f& lineEnd,
+                                          const ParticleBurst& burst)
+        {
+            Particles::ParticleSystemInstance* particles = prepareBurst(layer, path, burst);
+            if (particles)
+            {
+                particles->SetLineSpawner(lineStart, lineEnd);
+                particles->Burst();
+            }
+        }
+
+        void ParticleEffectManager::Burst(Level::LevelLayerInstance* layer, const std::string& path, const Animation::SkeletonInstance* skeleton,
+                                          const ParticleBurst& burst)
+        {
+            Particles::ParticleSystemInstance* particles = prepareBurst(layer, path, burst);
+            if (particles)
+            {
+                Particles::FitParticlesToSkeleton(particles, skeleton);
+                particles->Burst();
+            }
+        }
+
+        uint32_t ParticleEffectManager::GetEffectCount() const
+        {
+            return static_cast<uint32_t>(_effects.size());
+        }
+
+        uint32_t ParticleEffectManager::GetEmitterCount() const
+        {
+            uint32_t count = 0;
+            for (const auto& effect : _effects)
+            {
+                count += static_cast<uint32_t>(effect.second.emitters.size());
+            }
+            return count;
+        }
+
+        uint32_t ParticleEffectManager::GetActiveEmitterCount() const
+        {
+            uint32_t count = 0;
+            for (const auto& effect : _effects)
+            {
+                for (const auto& emitter : effect.second.emitters)
+                {
+                    if (emitter.active)
+                    {
+                        count++;
+                    }
+                }
+            }
+            return count;
+        }
+
+        void ParticleEffectManager::Update(double totalTime, float dt)
+        {
+            for (auto& effect : _effects)
+            {
+                for (auto& emitter : effect.second.emitters)
+                {
+                    if (emitter.active)
+                    {
+                        emitter.particles->Update(totalTime, dt);
+                        emitter.active = emitter.particles->GetParticleCount() > 0;
+                    }
+                }
+            }
+        }
+
+        void ParticleEffectManager::Draw(const Level::LevelLayerInstance* layer, LevelRenderer* levelRenderer) const
+        {
+            for (const auto& effect : _effects)
+            {
+                for (const auto& emitter : effect.second.emitters)
+                {
+                    if (emitter.active && emitter.layer == layer)
+                    {
+                        levelRenderer->AddDrawable(emitter.particles, false);
+                    }
+                }
+            }
+        }
+
+        Particles::ParticleSystemInstance* ParticleEffectManager::prepareBurst(Level::LevelLayerInstance* layer, const std::string& path, const ParticleBurst& burst)
+        {
+            auto iter = _effects.find(path);
+            if (iter == _effects.end())
+            {
+                return nullptr;
+            }
+
+            const ParticleBurst transform = snapBurst(burst);
+            std::vector<emitter>& emitters = iter->second.emitters;
+
+            // An emitter already on the layer with the transform, or else one whose particles have all died
+            emitter* target = nullptr;
+            for (auto& curEmitter : emitters)
+            {
+                if (curEmitter.layer == layer && isSameTransform(curEmitter.transform, transform))
+                {
+                    target = &curEmitter;
+                    break;
+                }
+                if (!curEmitter.active && target == nullptr)
+                {
+                    target = &curEmitter;
+                }
+            }
+
+            if (target == nullptr)
+            {
+                emitter newEmitter;
+                newEmitter.layer = layer;
+                newEmitter.transform = transform;
+                newEmitter.particles = Content::CreateParticleSystemInstance(iter->second.contentManager, path);
+                newEmitter.active = false;
+                applyTransform(newEmitter.particles, transform);
+                emitters.push_back(newEmitter);
+                target = &emitters.back();
+            }
+            else if (target->layer != layer || !isSameTransform(target->transform, transform))
+            {
+                assert(!target->active);
+                target->layer = layer;
+                target->transform = transform;
+                applyTransform(target->particles, transform);
+            }
+
+            target->active = true;
+            return target->particles;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Geometry/Vector2.hpp"
+#include "Geometry/Rotator.hpp"
+#include "Graphics/LevelRenderer.hpp"
+#include "NonCopyable.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Content
+    {
+        class ContentManager;
+    }
+
+    namespace Animation
+    {
+        class SkeletonInstance;
+    }
+
+    namespace Level
+    {
+        class LevelLayerInstance;
+    }
+
+    namespace Particles
+    {
+        class ParticleSystemInstance;
+    }
+
+    namespace Graphics
+    {
+        struct ParticleBurst
+        {
+            float Scale = 1.0f;
+            Rotatorf Rotation = Rotatorf(0.0f);
+            bool InvertedX = false;
+            bool InvertedY = false;
+        };
+
+        // Pools the emitters of one-off effects such as blood splats and footstep dust per particle system asset, so that
+        // characters don't each keep an emitter for every effect they might play. Bursts of an asset share an emitter
+        // when they are on the same layer and have the same transform; an emitter only takes a new transform once its
+        // particles have all died, so a burst never changes the particles of an earlier one. Rotations and scales are
+        // snapped to a fixed number of steps to keep the number of emitters down. Emitters without live particles are skipped entirely.
+        class ParticleEffectManager : public NonCopyable
+        {
+        public:
+            ParticleEffectManager();
+            ~ParticleEffectManager();
+
+            void LoadEffect(Content::ContentManager* contentManager, const std::string& path);
+            void UnloadEffect(const std::string& path);
+
+            void Burst(Level::LevelLayerInstance* layer, const std::string& path, const Vector2f& position, const ParticleBurst& burst = ParticleBurst());
+            void Burst(Level::LevelLayerInstance* layer, const std::string& path, const Vector2f& lineStart, const Vector2f& lineEnd,
+                       const ParticleBurst& burst = ParticleBurst());
+            void Burst(Level::LevelLayerInstance* layer, const std::string& path, const Animation::SkeletonInstance* skeleton,
+                       const ParticleBurst& burst = ParticleBurst());
+
+            uint32_t GetEffectCount() const;
+            uint32_t GetEmitterCount() const;
+            uint32_t GetActiveEmitterCount() const;
+
+            void Update(double totalTime, float dt);
+            void Draw(const Level::LevelLayerInstance* layer, LevelRenderer* levelRenderer) const;
+
+        private:
+            Particles::ParticleSystemInstance* prepareBurst(Level::LevelLayerInstance* layer, const std::string& path, const ParticleBurst& burst);
+
+            struct emitter
+            {
+                const Level::LevelLayerInstance* layer;
+                ParticleBurst transform;
+                Particles::ParticleSystemInstance* particles;
+                bool active;
+            };
+
+            struct effect
+            {
+                Content::ContentManager* contentManager = nullptr;
+                uint32_t refCount = 0;
+                std::vector<emitter> emitters;
+            };
+            std::unordered_map<std::string, effect> _effects;
+        };
+    }
+}
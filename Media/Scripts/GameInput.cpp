@@ -0,0 +1,113 @@
+#include "GameInput.hpp"
+
+namespace Dwarf
+{
+    namespace Input
+    {
+        GameInput::GameInput(const FrameInput& input)
+            : GameInput(input, nullptr)
+        {
+        }
+
+        GameInput::GameInput(const FrameInput& input, GameInputFrame* recordFrame)
+            : _live(&input)
+            , _record(recordFrame)
+            , _replay(nullptr)
+        {
+        }
+
+        GameInput::GameInput(const GameInputFrame& replayFrame)
+            : _live(nullptr)
+            , _record(nullptr)
+            , _replay(&replayFrame)
+        {
+        }
+
+        bool GameInput::IsBindPressed(InputBindCode bind) const
+        {
+            return (getBindState(bind) & BindState_Pressed) != 0;
+        }
+
+        bool GameInput::IsBindReleased(InputBindCode bind) const
+        {
+            return (getBindState(bind) & BindState_Released) != 0;
+        }
+
+        bool GameInput::IsBindJustPressed(InputBindCode bind) const
+        {
+            return (getBindState(bind) & BindState_JustPressed) != 0;
+        }
+
+        bool GameInput::IsBindJustReleased(InputBindCode bind) const
+        {
+            return (getBindState(bind) & BindState_JustReleased) != 0;
+        }
+
+        bool GameInput::IsBindJustDoublePressed(InputBindCode bind) const
+        {
+            return (getBindState(bind) & BindState_JustDoublePressed) != 0;
+        }
+
+        Vector2f GameInput::UnProjectMousePosition(const Camera& camera) const
+        {
+            if (_replay)
+            {
+                return _replay->HasMousePosition ? camera.UnProject(_replay->MouseScreenPosition) : Vector2f::Zero;
+            }
+
+            Vector2f position = _live->UnProjectMousePosition(camera);
+            if (_record && !_record->HasMousePosition)
+            {
+                // Stored in screen space so that it can be unprojected by whichever camera asks for it on replay
+                _record->MouseScreenPosition = camera.Project(position);
+                _record->HasMousePosition = true;
+            }
+            return position;
+        }
+
+        Vector2f GameInput::GetMouseScrollDelta() const
+        {
+            if (_replay)
+            {
+                return _replay->ScrollDelta;
+            }
+
+            Vector2f delta = _live->GetMouseScrollDelta();
+            if (_record)
+            {
+                _record->ScrollDelta = delta;
+                _record->HasScrollDelta = true;
+            }
+            return delta;
+        }
+
+        bool GameInput::IsReplaying() const
+        {
+            return _replay != nullptr;
+        }
+
+        uint8_t GameInput::getBindState(InputBindCode bind) const
+        {
+            uint32_t key = static_cast<uint32_t>(bind);
+            if (_replay)
+            {
+                // Binds that were neither held nor changing are not saved
+                auto iter = _replay->BindStates.find(key);
+                return iter != _replay->BindStates.end() ? iter->second : static_cast<uint8_t>(BindState_Released);
+            }
+
+            uint8_t state = 0;
+            state |= _live->IsBindPressed(bind) ? BindState_Pressed : 0;
+            state |= _live->IsBindReleased(bind) ? BindState_Released : 0;
+            state |= _live->IsBindJustPressed(bind) ? BindState_JustPressed : 0;
+            state |= _live->IsBindJustReleased(bind) ? BindState_JustReleased : 0;
+            state |= _live->IsBindJustDoublePressed(bind) ? BindState_JustDoublePressed : 0;
+
+            if (_record)
+            {
+                _record->BindStates[key] = state;
+            }
+            return state;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Input/InputBinding.hpp"
+#include "Input/FrameInput.hpp"
+#include "Geometry/Vector2.hpp"
+#include "Camera.hpp"
+
+#include <map>
+#include <stdint.h>
+
+namespace Dwarf
+{
+    namespace Input
+    {
+        enum BindStateFlags : uint8_t
+        {
+            BindState_Pressed = 1 << 0,
+            BindState_Released = 1 << 1,
+            BindState_JustPressed = 1 << 2,
+            BindState_JustReleased = 1 << 3,
+            BindState_JustDoublePressed = 1 << 4,
+        };
+
+        // Everything the game scripts read from the input in one frame. Binds are only stored once they have been
+        // queried, a replay makes the same queries in the same order so every answer it needs has been recorded.
+        struct GameInputFrame
+        {
+            float Dt = 0.0f;
+
+            bool HasMousePosition = false;
+            Vector2f MouseScreenPosition = Vector2f::Zero;
+
+            bool HasScrollDelta = false;
+            Vector2f ScrollDelta = Vector2f::Zero;
+
+            std::map<uint32_t, uint8_t> BindStates;
+        };
+
+        // The input queries the player and HUD make, answered either by the live frame input (recording the answers
+        // when given a frame to record to) or by a recorded frame. Implicitly constructible from a FrameInput so that
+        // widgets shared with the menus can take either.
+        class GameInput
+        {
+        public:
+            GameInput(const FrameInput& input);
+            GameInput(const FrameInput& input, GameInputFrame* recordFrame);
+            GameInput(const GameInputFrame& replayFrame);
+
+            bool IsBindPressed(InputBindCode bind) const;
+            bool IsBindReleased(InputBindCode bind) const;
+            bool IsBindJustPressed(InputBindCode bind) const;
+            bool IsBindJustReleased(InputBindCode bind) const;
+            bool IsBindJustDoublePressed(InputBindCode bind) const;
+
+            Vector2f UnProjectMousePosition(const Camera& camera) const;
+            Vector2f GetMouseScrollDelta() const;
+
+            bool IsReplaying() const;
+
+        private:
+            uint8_t getBindState(InputBindCode bind) const;
+
+            const FrameInput* _live;
+            GameInputFrame* _record;
+            const GameInputFrame* _replay;
+        };
+    }
+}
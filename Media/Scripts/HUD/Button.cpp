@@ -29,6 +29,8 @@ namespace Dwarf
             , _hidden(false)
             , _enabled(true)
 
+            , _panelsDirty(true)
+
             , _icon(nullptr)
             , _border(nullptr)
             , _cornerBorder(nullptr)
@@ -38,7 +40,11 @@ namespace Dwarf
 
         void Button::SetBackgroundColor(const Color& color)
         {
-            _backgroundColor = color;
+            if (_backgroundColor != color)
+            {
+                _backgroundColor = color;
+                _panelsDirty = true;
+            }
         }
 
         void Button::SetBackground(const PanelDrawable* background)
@@ -52,7 +58,11 @@ namespace Dwarf
 
         void Button::SetIconColor(const Color& color)
         {
-            _iconColor = color;
+            if (_iconColor != color)
+            {
+                _iconColor = color;
+                _panelsDirty = true;
+            }
         }
 
         void Button::SetClickBind(Input::InputBindCode clickBind)
@@ -148,11 +158,13 @@ namespace Dwarf
 
         void Button::Enable()
         {
+            _panelsDirty |= !_enabled;
             _enabled = true;
         }
 
         void Button::Disable()
         {
+            _panelsDirty |= _enabled;
             _enabled = false;
         }
 
@@ -168,11 +180,13 @@ namespace Dwarf
 
         void Button::Show()
         {
+            _panelsDirty |= _hidden;
             _hidden = false;
         }
 
         void Button::Hide()
         {
+            _panelsDirty |= !_hidden;
             _hidden = true;
         }
 
@@ -203,17 +217,20 @@ namespace Dwarf
 
         void Button::ForceHighlightOn(bool force)
         {
+            _panelsDirty |= _forceHighlightOn != force;
             _forceHighlightOn = force;
         }
 
         void Button::ForceHighlightOff(bool force)
         {
+            _panelsDirty |= _forceHighlightOff != force;
             _forceHighlightOff = force;
         }
 
-        void Button::Update(const Input::FrameInput& input, const Camera& camera)
+        void Button::Update(const Input::GameInput& input, const Camera& camera)
         {
             Vector2f mousePos = input.UnProjectMousePosition(camera);
+            const bool wasMouseOver = _mouseOver;
 
             if (!_hidden)
             {
@@ -245,7 +262,11 @@ namespace Dwarf
                 _mouseClicking = true;
             }
 
-            updatePanels();
+            // The panels are left alone while nothing they show has changed
+            if (_panelsDirty || _mouseOver != wasMouseOver)
+            {
+                updatePanels();
+            }
         }
 
         void Button::Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color) const
@@ -313,6 +334,7 @@ namespace Dwarf
 
         void Button::updatePanels()
         {
+            _panelsDirty = false;
             if (_panel)
             {
                 _panel->SetBackgroundColor(_backgroundColor);
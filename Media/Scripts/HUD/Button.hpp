@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Input/InputBinding.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Graphics/HUDMaterial.hpp"
 #include "Geometry/Rectangle.hpp"
 #include "Camera.hpp"
@@ -53,7 +53,7 @@ namespace Dwarf
             void ForceHighlightOn(bool force);
             void ForceHighlightOff(bool force);
 
-            void Update(const Input::FrameInput& input, const Camera& camera);
+            void Update(const Input::GameInput& input, const Camera& camera);
 
             void Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color) const;
 
@@ -89,6 +89,8 @@ namespace Dwarf
             bool _hidden;
             bool _enabled;
 
+            bool _panelsDirty;
+
             struct cornerText
             {
                 std::string text = "";
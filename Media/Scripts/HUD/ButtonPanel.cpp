@@ -161,7 +161,7 @@ namespace Dwarf
 
         void ButtonPanel::SetButtonVisible(uint32_t index, bool visible)
         {
-            _buttons[index]->SetVisible(visible);
+            _buttons[index]->SetVisible(visible && RotatedRectanglef::Intersects(_buttons[index]->GetBounds(), _bounds));
             _buttonVisibility[index] = visible;
         }
 
@@ -226,7 +226,7 @@ namespace Dwarf
             return false;
         }
 
-        void ButtonPanel::Update(const Input::FrameInput& input, const Camera& camera)
+        void ButtonPanel::Update(const Input::GameInput& input, const Camera& camera)
         {
             if (usingScrollBar())
             {
@@ -242,6 +242,7 @@ namespace Dwarf
 
             Vector2f mousePos = input.UnProjectMousePosition(camera);
             Vector2f mouseDelta = mousePos - _prevMousePosition;
+            const float prevScrollPosition = _scrollPosition;
 
             const float _buttonScrollStep = 0.25f;
             if (_dragButton->IsClicked())
@@ -260,17 +261,14 @@ namespace Dwarf
 
                 float deltaDragPerc = curDragPerc - prevDragPerc;
                 _scrollPosition = Clamp(_scrollPosition + deltaDragPerc, 0.0f, 1.0f);
-                updatePlacement();
             }
             else if (_upButton->IsJustClicked())
             {
                 _scrollPosition = Clamp(_scrollPosition - _buttonScrollStep, 0.0f, 1.0f);
-                updatePlacement();
             }
             else if (_downButton->IsJustClicked())
             {
                 _scrollPosition = Clamp(_scrollPosition + _buttonScrollStep, 0.0f, 1.0f);
-                updatePlacement();
             }
 
             if (usingScrollBar() && RotatedRectanglef::Contains(_bounds, mousePos) && _buttons.size() > 0)
@@ -296,7 +294,12 @@ namespace Dwarf
 
             _prevMousePosition = mousePos;
 
-            updatePlacement();
+            // The buttons only have to be placed again when they have been scrolled, the other changes to their
+            // placement are made by the setters
+            if (_scrollPosition != prevScrollPosition)
+            {
+                updatePlacement();
+            }
         }
 
         void ButtonPanel::Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color) const
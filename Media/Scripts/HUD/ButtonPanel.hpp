@@ -46,7 +46,7 @@ namespace Dwarf
             bool IsButtonJustClicked(uint32_t& outButton);
             bool IsButtonMouseOver(uint32_t& outButton);
 
-            void Update(const Input::FrameInput& input, const Camera& camera);
+            void Update(const Input::GameInput& input, const Camera& camera);
 
             void Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color) const;
 
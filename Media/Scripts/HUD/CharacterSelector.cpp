@@ -332,7 +332,7 @@ namespace Dwarf
                 return _currentTooltip;
             }
 
-            void updateButtons(const Input::FrameInput& input, const Camera& cam, const CharacterSet& selectedCharacters, float scale)
+            void updateButtons(const Input::GameInput& input, const Camera& cam, const CharacterSet& selectedCharacters, float scale)
             {
                 assert(_healthDrawables.size() == _characters.size());
 
@@ -530,7 +530,7 @@ namespace Dwarf
             return _currentTooltip;
         }
 
-        void CharacterSelector::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera, const CharacterSet& selectedCharacters)
+        void CharacterSelector::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera, const CharacterSet& selectedCharacters)
         {
             _clickedCharacter = nullptr;
             _mouseOver = false;
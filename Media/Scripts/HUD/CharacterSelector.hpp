@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Input/InputBinding.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Graphics/HUDMaterial.hpp"
 #include "Geometry/Rectangle.hpp"
 #include "HUD/Icon.hpp"
@@ -41,7 +41,7 @@ namespace Dwarf
             Character::Character* GetClickedCharacter();
             const Panel* GetTooltip() const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera, const CharacterSet& selectedCharacters);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera, const CharacterSet& selectedCharacters);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
           private:
@@ -126,7 +126,7 @@ namespace Dwarf
             return _mouseOver && _enabled && _highlight != nullptr;
         }
 
-        void Checkbox::Update(const Input::FrameInput& input, const Camera& camera)
+        void Checkbox::Update(const Input::GameInput& input, const Camera& camera)
         {
             Vector2f mousePos = input.UnProjectMousePosition(camera);
             _justChanged = false;
@@ -194,7 +194,7 @@ namespace Dwarf
             return _expanded;
         }
 
-        void Combobox::Update(const Input::FrameInput& input, const Camera& camera)
+        void Combobox::Update(const Input::GameInput& input, const Camera& camera)
         {
             Vector2f mousePos = input.UnProjectMousePosition(camera);
             _justChanged = false;
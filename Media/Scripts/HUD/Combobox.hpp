@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Input/InputBinding.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Geometry/Rectangle.hpp"
 #include "Camera.hpp"
 #include "HUD/Panel.hpp"
@@ -48,7 +48,7 @@ namespace Dwarf
             bool IsHighlighted();
             bool IsExpaneded();
 
-            void Update(const Input::FrameInput& input, const Camera& camera);
+            void Update(const Input::GameInput& input, const Camera& camera);
 
             void Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color) const;
 
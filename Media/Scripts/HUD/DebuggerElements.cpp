@@ -75,6 +75,9 @@
 
 #include "Characters/ResourceNode.hpp"
 
+#include "Profiler.hpp"
+#include "FileSystem/FileSystem.hpp"
+
 #include <imgui.h>
 
 namespace Dwarf
@@ -456,6 +459,245 @@ namespace Dwarf
             return changed;
         }
 
+        InputSessionDebuggerElement::InputSessionDebuggerElement(Input::InputSession* session)
+            : _session(session)
+        {
+        }
+
+        bool InputSessionDebuggerElement::Update(double totalTime, float dt)
+        {
+            switch (_session->GetMode())
+            {
+            case Input::InputSessionMode_Record:
+                ImGui::Text("Recording frame %u, seed %u", _session->GetFrameIndex(), _session->GetSeed());
+                if (ImGui::Button("Stop and Save"))
+                {
+                    _session->End();
+                }
+                break;
+
+            case Input::InputSessionMode_Replay:
+                ImGui::Text("Replaying frame %u / %u, seed %u", _session->GetFrameIndex(), _session->GetFrameCount(), _session->GetSeed());
+                if (ImGui::Button("Stop Replay"))
+                {
+                    _session->End();
+                }
+                break;
+
+            default:
+                ImGui::Text("Not recording");
+                break;
+            }
+
+            if (ImGui::Button("Record Next Level"))
+            {
+                Input::SetPendingInputSession(Input::InputSessionMode_Record, Input::GetDefaultInputRecordingPath());
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Replay Next Level"))
+            {
+                Input::SetPendingInputSession(Input::InputSessionMode_Replay, Input::GetDefaultInputRecordingPath());
+            }
+
+            return false;
+        }
+
+        static const uint32_t ProfilerFrameTimeHistoryLength = 240;
+        static const float ProfilerFlameRowHeight = 18.0f;
+
+        ProfilerDebuggerElement::ProfilerDebuggerElement()
+            : _frameTimes(ProfilerFrameTimeHistoryLength, 0.0f)
+            , _frameTimeOffset(0)
+            , _lastFrame(Profiling::GetCurrentFrame())
+            , _averagedFrames(0)
+            , _zoneAverages()
+        {
+        }
+
+        bool ProfilerDebuggerElement::Update(double totalTime, float dt)
+        {
+            updateFrameTimes();
+
+            bool paused = Profiling::IsPaused();
+            if (ImGui::Checkbox("Paused", &paused))
+            {
+                Profiling::SetPaused(paused);
+            }
+
+            if (ImGui::Button("Export Chrome Trace"))
+            {
+                Profiling::ExportChromeTrace(Format("%s/%s/%s", FileSystem::GetHomePath().c_str(), "Dwarf", "profile_trace.json"));
+            }
+
+            float maxFrameTime = 0.0f;
+            for (float frameTime : _frameTimes)
+            {
+                maxFrameTime = Max(maxFrameTime, frameTime);
+            }
+            std::string frameTimeLabel = Format("%.2f ms", _frameTimes[(_frameTimeOffset + ProfilerFrameTimeHistoryLength - 1) % ProfilerFrameTimeHistoryLength]);
+            ImGui::PlotLines("Frame Time", _frameTimes.data(), static_cast<int>(_frameTimes.size()), static_cast<int>(_frameTimeOffset),
+                             frameTimeLabel.c_str(), 0.0f, Max(maxFrameTime, 1.0f), ImVec2(0.0f, 60.0f));
+
+            if (ImGui::TreeNode("Flame Graph"))
+            {
+                drawFlameGraph();
+                ImGui::TreePop();
+            }
+
+            if (ImGui::TreeNode("Zone Averages"))
+            {
+                drawZoneAverages();
+                ImGui::TreePop();
+            }
+
+            return false;
+        }
+
+        void ProfilerDebuggerElement::updateFrameTimes()
+        {
+            uint32_t currentFrame = Profiling::GetCurrentFrame();
+            if (currentFrame <= _lastFrame)
+            {
+                return;
+            }
+
+            // Frames between the last update and the current frame have completed
+            for (uint32_t frame = _lastFrame; frame < currentFrame; frame++)
+            {
+                uint64_t begin, end;
+                if (Profiling::GetFrameBegin(frame, begin) && Profiling::GetFrameBegin(frame + 1, end) && end > begin)
+                {
+                    _frameTimes[_frameTimeOffset] = (end - begin) / 1000.0f;
+                    _frameTimeOffset = (_frameTimeOffset + 1) % ProfilerFrameTimeHistoryLength;
+                }
+            }
+
+            for (const auto& zone : Profiling::CollectZones(_lastFrame, currentFrame - 1))
+            {
+                zoneAverage& average = _zoneAverages[zone.Name];
+                average.totalTime += (zone.End - zone.Begin) / 1000.0;
+                average.count++;
+            }
+            _averagedFrames += currentFrame - _lastFrame;
+
+            _lastFrame = currentFrame;
+        }
+
+        void ProfilerDebuggerElement::drawFlameGraph()
+        {
+            uint32_t currentFrame = Profiling::GetCurrentFrame();
+            uint64_t frameBegin, frameEnd;
+            if (currentFrame == 0 ||
+                !Profiling::GetFrameBegin(currentFrame - 1, frameBegin) ||
+                !Profiling::GetFrameBegin(currentFrame, frameEnd) ||
+                frameEnd <= frameBegin)
+            {
+                ImGui::Text("No frames recorded.");
+                return;
+            }
+
+            std::vector<Profiling::ZoneEvent> zones = Profiling::CollectZones(currentFrame - 1, currentFrame - 1);
+
+            // Zones that began before the frame was marked extend the graph to the left
+            for (const auto& zone : zones)
+            {
+                frameBegin = Min(frameBegin, zone.Begin);
+            }
+
+            // Each thread gets a band of rows, one for every zone depth it reached
+            std::map<uint32_t, uint32_t> threadDepths;
+            for (const auto& zone : zones)
+            {
+                threadDepths[zone.Thread] = Max(threadDepths[zone.Thread], zone.Depth + 1);
+            }
+            std::map<uint32_t, uint32_t> threadFirstRows;
+            uint32_t rowCount = 0;
+            for (const auto& threadDepth : threadDepths)
+            {
+                threadFirstRows[threadDepth.first] = rowCount;
+                rowCount += threadDepth.second;
+            }
+
+            ImGui::Text("Frame %u: %.2f ms", currentFrame - 1, (frameEnd - frameBegin) / 1000.0f);
+
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+            ImVec2 origin = ImGui::GetCursorScreenPos();
+            float width = Max(ImGui::GetContentRegionAvailWidth(), 1.0f);
+            float height = Max(rowCount, 1U) * ProfilerFlameRowHeight;
+            float scale = width / (frameEnd - frameBegin);
+
+            const Profiling::ZoneEvent* hoveredZone = nullptr;
+            for (const auto& zone : zones)
+            {
+                float x0 = origin.x + (zone.Begin - frameBegin) * scale;
+                float x1 = origin.x + (Min(zone.End, frameEnd) - frameBegin) * scale;
+                float y0 = origin.y + (threadFirstRows[zone.Thread] + zone.Depth) * ProfilerFlameRowHeight;
+                float y1 = y0 + ProfilerFlameRowHeight - 1.0f;
+                x1 = Max(x1, x0 + 1.0f);
+
+                // Colour by name so that a zone keeps its colour between frames
+                float hue = (std::hash<std::string>()(zone.Name) % 360) / 360.0f;
+                drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), ImColor::HSV(hue, 0.5f, 0.7f));
+
+                ImVec2 textSize = ImGui::CalcTextSize(zone.Name);
+                if (textSize.x < x1 - x0 - 4.0f)
+                {
+                    drawList->AddText(ImVec2(x0 + 2.0f, y0 + (ProfilerFlameRowHeight - textSize.y) * 0.5f), ImColor(255, 255, 255), zone.Name);
+                }
+
+                if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y1)))
+                {
+                    hoveredZone = &zone;
+                }
+            }
+
+            ImGui::Dummy(ImVec2(width, height));
+
+            if (hoveredZone)
+            {
+                ImGui::SetTooltip("%s: %.3f ms", hoveredZone->Name, (hoveredZone->End - hoveredZone->Begin) / 1000.0f);
+            }
+        }
+
+        void ProfilerDebuggerElement::drawZoneAverages()
+        {
+            if (ImGui::Button("Reset"))
+            {
+                _zoneAverages.clear();
+                _averagedFrames = 0;
+            }
+
+            if (_averagedFrames == 0)
+            {
+                return;
+            }
+
+            ImGui::Columns(4, "ProfilerZoneAverages");
+            ImGui::Text("Zone");
+            ImGui::NextColumn();
+            ImGui::Text("ms / frame");
+            ImGui::NextColumn();
+            ImGui::Text("ms / call");
+            ImGui::NextColumn();
+            ImGui::Text("calls / frame");
+            ImGui::NextColumn();
+            ImGui::Separator();
+
+            for (const auto& average : _zoneAverages)
+            {
+                ImGui::Text("%s", average.first.c_str());
+                ImGui::NextColumn();
+                ImGui::Text("%.3f", average.second.totalTime / _averagedFrames);
+                ImGui::NextColumn();
+                ImGui::Text("%.3f", average.second.totalTime / average.second.count);
+                ImGui::NextColumn();
+                ImGui::Text("%.1f", static_cast<float>(average.second.count) / _averagedFrames);
+                ImGui::NextColumn();
+            }
+
+            ImGui::Columns(1);
+        }
+
         class SpawnCharacterBindableDebugElement : public BindableDebuggerElemement
         {
         public:
@@ -11,8 +11,11 @@
 #include "Audio/ReverbEffect.hpp"
 
 #include "RainEffect.hpp"
+#include "InputRecording.hpp"
 
 #include <functional>
+#include <map>
+#include <vector>
 
 namespace Dwarf
 {
@@ -114,6 +117,46 @@ namespace Dwarf
             RainEffect* _effect = nullptr;
         };
 
+        // Shows the state of the level's input recording or replay, and queues a recording or replay for the next level
+        class InputSessionDebuggerElement : public DebuggerElemement
+        {
+        public:
+            InputSessionDebuggerElement(Input::InputSession* session);
+
+            bool Update(double totalTime, float dt) override;
+
+        private:
+            Input::InputSession* _session = nullptr;
+        };
+
+        // Shows the frame time history, a flame graph of the zones recorded by the profiler over the last frame and the
+        // average time spent in each zone
+        class ProfilerDebuggerElement : public DebuggerElemement
+        {
+        public:
+            ProfilerDebuggerElement();
+
+            bool Update(double totalTime, float dt) override;
+
+        private:
+            struct zoneAverage
+            {
+                double totalTime;
+                uint32_t count;
+            };
+
+            void updateFrameTimes();
+            void drawFlameGraph();
+            void drawZoneAverages();
+
+            std::vector<float> _frameTimes;
+            uint32_t _frameTimeOffset;
+            uint32_t _lastFrame;
+
+            uint32_t _averagedFrames;
+            std::map<std::string, zoneAverage> _zoneAverages;
+        };
+
         using GetSpawnPointFunction = std::function<Vector2f()>;
 
         struct SpawnCharacterOption
@@ -243,7 +243,7 @@ namespace Dwarf
             return RotatedRectanglef(origin, extents, rotation);
         }
 
-        void MenuDisplay::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera)
+        void MenuDisplay::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera)
         {
             _selectedTooltip.Reset();
 
@@ -5,7 +5,7 @@
 #include "Content/Preload.hpp"
 #include "Content/ContentManager.hpp"
 #include "Input/InputBinding.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Settings/Profile.hpp"
 #include "Animation/SkeletonInstance.hpp"
 #include "Audio/SoundManager.hpp"
@@ -46,7 +46,7 @@ namespace Dwarf
 
             const Panel* GetTooltip() const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
         private:
@@ -90,7 +90,7 @@ namespace Dwarf
             return _clicked;
         }
 
-        void Minimap::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera)
+        void Minimap::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera)
         {
             _panel->Update(totalTime, dt);
             updateMinimapSize();
@@ -2,7 +2,7 @@
 
 #include "NonCopyable.hpp"
 #include "Input/InputBinding.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Graphics/HUDMaterial.hpp"
 #include "Graphics/Minimap.hpp"
 #include "Geometry/Rectangle.hpp"
@@ -30,7 +30,7 @@ namespace Dwarf
             bool IsMouseOver() const;
             bool IsClicked(Vector2f& worldPosition) const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
         private:
@@ -4,23 +4,27 @@ namespace Dwarf
 {
     namespace HUD
     {
-        TilingBorderPanelDrawable::TilingBorderPanelDrawable(const Graphics::HUDMaterialSet* matset, const std::string& cornerTopLeft, const std::string& cornerTopRight, const std::string& cornerBottomLeft, const std::string& cornerBottomRight, const std::string& edgeleft, const std::string& edgeRight, const std::string& edgeTop, const std::string& edgeBottom) : _cornerTopLeft(nullptr)
-            , _cornerTopRight(nullptr)
-            , _cornerBottomLeft(nullptr)
-            , _cornerBottomRight(nullptr)
-            , _edgeLeft(nullptr)
-            , _edgeRight(nullptr)
-            , _edgeTop(nullptr)
-            , _edgeBottom(nullptr)
-        {
-            _cornerTopLeft = matset->GetMaterial(cornerTopLeft);
-            _cornerTopRight = matset->GetMaterial(cornerTopRight);
-            _cornerBottomLeft = matset->GetMaterial(cornerBottomLeft);
-            _cornerBottomRight = matset->GetMaterial(cornerBottomRight);
-            _edgeLeft = matset->GetMaterial(edgeleft);
-            _edgeRight = matset->GetMaterial(edgeRight);
-            _edgeTop = matset->GetMaterial(edgeTop);
-            _edgeBottom = matset->GetMaterial(edgeBottom);
+        TilingBorderPanelDrawable::TilingBorderPanelDrawable(const Graphics::HUDMaterialSet* matset, const std::string& cornerTopLeft, const std::string& cornerTopRight, const std::string& cornerBottomLeft, const std::string& cornerBottomRight, const std::string& edgeleft, const std::string& edgeRight, const std::string& edgeTop, const std::string& edgeBottom)
+            : TilingBorderPanelDrawable(matset->GetMaterial(cornerTopLeft), matset->GetMaterial(cornerTopRight), matset->GetMaterial(cornerBottomLeft),
+                                        matset->GetMaterial(cornerBottomRight), matset->GetMaterial(edgeleft), matset->GetMaterial(edgeRight),
+                                        matset->GetMaterial(edgeTop), matset->GetMaterial(edgeBottom))
+        {
+        }
+
+        TilingBorderPanelDrawable::TilingBorderPanelDrawable(const Graphics::HUDMaterial* cornerTopLeft, const Graphics::HUDMaterial* cornerTopRight,
+                                                             const Graphics::HUDMaterial* cornerBottomLeft, const Graphics::HUDMaterial* cornerBottomRight,
+                                                             const Graphics::HUDMaterial* edgeLeft, const Graphics::HUDMaterial* edgeRight,
+                                                             const Graphics::HUDMaterial* edgeTop, const Graphics::HUDMaterial* edgeBottom)
+            : _cornerTopLeft(cornerTopLeft)
+            , _cornerTopRight(cornerTopRight)
+            , _cornerBottomLeft(cornerBottomLeft)
+            , _cornerBottomRight(cornerBottomRight)
+            , _edgeLeft(edgeLeft)
+            , _edgeRight(edgeRight)
+            , _edgeTop(edgeTop)
+            , _edgeBottom(edgeBottom)
+            , _geometry()
+        {
         }
 
         PaddingFunction TilingBorderPanelDrawable::GetPaddingFunction() const
@@ -38,6 +42,16 @@ namespace Dwarf
         }
 
         void TilingBorderPanelDrawable::Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color, const RotatedRectanglef& bounds, float scale) const
+        {
+            DrawTo(spriteRenderer, color, bounds, scale);
+        }
+
+        uint32_t TilingBorderPanelDrawable::GetLayoutCount() const
+        {
+            return _geometry.GetLayoutCount();
+        }
+
+        void TilingBorderPanelDrawable::layout(PanelGeometry& geometry, const RotatedRectanglef& bounds, float scale) const
         {
             Vector2f downDir = Vector2f::Normalize(bounds.BottomLeft() - bounds.TopLeft());
             Vector2f rightDir = Vector2f::Normalize(bounds.TopRight() - bounds.TopLeft());
@@ -48,7 +62,7 @@ namespace Dwarf
                 Vector2f bottomSideCenter = bounds.Middle() + (downDir * (bounds.ExtentY - (_edgeBottom->GetSize().Y * 0.5f * scale))) - (rightDir * bottomCornerSizeDif * 0.5f);
                 float bottomEdgeLength = (bounds.ExtentX * 2.0f) - ((_cornerBottomRight->GetSize().X + _cornerBottomLeft->GetSize().X) * scale);
                 Rectanglef bottomSideRect(bottomSideCenter - Vector2f(bottomEdgeLength * 0.5f, _edgeBottom->GetSize().Y * 0.5f * scale), Vector2f(bottomEdgeLength, _edgeBottom->GetSize().Y * scale));
-                spriteRenderer->DrawSprite(_edgeBottom->GetTexture(), bottomSideRect, _edgeBottom->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_edgeBottom, bottomSideRect);
             }
 
             {
@@ -57,7 +71,7 @@ namespace Dwarf
                 Vector2f topSideCenter = bounds.Middle() - (downDir * (bounds.ExtentY - (_edgeTop->GetSize().Y * 0.5f * scale))) - (rightDir * topCornerSizeDif * 0.5f);
                 float topEdgeLength = (bounds.ExtentX * 2.0f) - ((_cornerTopRight->GetSize().X + _cornerTopLeft->GetSize().X) * scale);
                 Rectanglef topSideRect(topSideCenter - Vector2f(topEdgeLength * 0.5f, _edgeTop->GetSize().Y * 0.5f * scale), Vector2f(topEdgeLength, _edgeTop->GetSize().Y * scale));
-                spriteRenderer->DrawSprite(_edgeTop->GetTexture(), topSideRect, _edgeTop->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_edgeTop, topSideRect);
             }
 
             {
@@ -66,7 +80,7 @@ namespace Dwarf
                 Vector2f leftSideCenter = bounds.Middle() - (rightDir * (bounds.ExtentX - (_edgeLeft->GetSize().X * 0.5f * scale))) - (downDir * leftCornerSizeDif * 0.5f);
                 float leftEdgeLength = (bounds.ExtentY * 2.0f) - ((_cornerBottomLeft->GetSize().Y - _cornerTopLeft->GetSize().Y) * scale);
                 Rectanglef leftSideRect(leftSideCenter - Vector2f(_edgeLeft->GetSize().X * 0.5f * scale, leftEdgeLength * 0.5f), Vector2f(_edgeLeft->GetSize().X * scale, leftEdgeLength));
-                spriteRenderer->DrawSprite(_edgeLeft->GetTexture(), leftSideRect, _edgeLeft->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_edgeLeft, leftSideRect);
             }
 
             {
@@ -75,35 +89,35 @@ namespace Dwarf
                 Vector2f rightSideCenter = bounds.Middle() + (rightDir * (bounds.ExtentX - (_edgeRight->GetSize().X * 0.5f * scale))) - (downDir * rightCornerSizeDif * 0.5f);
                 float rightEdgeLength = (bounds.ExtentY * 2.0f) - ((_cornerBottomRight->GetSize().Y - _cornerTopRight->GetSize().Y) * scale);
                 Rectanglef rightSideRect(rightSideCenter - Vector2f(_edgeRight->GetSize().X * 0.5f * scale, rightEdgeLength * 0.5f), Vector2f(_edgeRight->GetSize().X * scale, rightEdgeLength));
-                spriteRenderer->DrawSprite(_edgeRight->GetTexture(), rightSideRect, _edgeRight->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_edgeRight, rightSideRect);
             }
 
             {
                 // Top Left
                 Vector2f topLeftCornerCenter = bounds.TopLeft() + (downDir * (_cornerTopLeft->GetSize().Y * 0.5f * scale)) + (rightDir * (_cornerTopLeft->GetSize().X * 0.5f * scale));
                 Rectanglef topLeftCornerRect(topLeftCornerCenter - Vector2f(_cornerTopLeft->GetSize()) * 0.5f * scale, Vector2f(_cornerTopLeft->GetSize() * scale));
-                spriteRenderer->DrawSprite(_cornerTopLeft->GetTexture(), topLeftCornerRect, _cornerTopLeft->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_cornerTopLeft, topLeftCornerRect);
             }
 
             {
                 // Bottom Left
                 Vector2f bottomLeftCornerCenter = bounds.BottomLeft() - (downDir * (_cornerBottomLeft->GetSize().Y * 0.5f * scale)) + (rightDir * (_cornerBottomLeft->GetSize().X * 0.5f * scale));
                 Rectanglef bottomLeftCornerRect(bottomLeftCornerCenter - Vector2f(_cornerBottomLeft->GetSize()) * 0.5f * scale, Vector2f(_cornerBottomLeft->GetSize() * scale));
-                spriteRenderer->DrawSprite(_cornerBottomLeft->GetTexture(), bottomLeftCornerRect, _cornerBottomLeft->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_cornerBottomLeft, bottomLeftCornerRect);
             }
 
             {
                 // Top Right
                 Vector2f topRightCornerCenter = bounds.TopRight() + (downDir * (_cornerTopRight->GetSize().Y * 0.5f * scale)) - (rightDir * (_cornerTopRight->GetSize().X * 0.5f * scale));
                 Rectanglef topRightCornerRect(topRightCornerCenter - Vector2f(_cornerTopRight->GetSize()) * 0.5f * scale, Vector2f(_cornerTopRight->GetSize() * scale));
-                spriteRenderer->DrawSprite(_cornerTopRight->GetTexture(), topRightCornerRect, _cornerTopRight->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_cornerTopRight, topRightCornerRect);
             }
 
             {
                 // Bottom Right
                 Vector2f bottomRightCornerCenter = bounds.BottomRight() - (downDir * (_cornerBottomRight->GetSize().Y * 0.5f * scale)) - (rightDir * (_cornerBottomRight->GetSize().X * 0.5f * scale));
                 Rectanglef bottomRightCornerRect(bottomRightCornerCenter - Vector2f(_cornerBottomRight->GetSize()) * 0.5f * scale, Vector2f(_cornerBottomRight->GetSize() * scale));
-                spriteRenderer->DrawSprite(_cornerBottomRight->GetTexture(), bottomRightCornerRect, _cornerBottomRight->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_cornerBottomRight, bottomRightCornerRect);
             }
         }
 
@@ -158,6 +172,7 @@ namespace Dwarf
             , _bottomEdge(matset->GetMaterial(bottomMaterial))
             , _padding(padding)
             , _scale(scale)
+            , _geometry()
         {
         }
 
@@ -175,6 +190,19 @@ namespace Dwarf
         }
 
         void VerticalStretchingBorderPanelDrawable::Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color, const RotatedRectanglef& bounds, float scale) const
+        {
+            const PanelGeometry* geometry = _geometry.Find(bounds, scale);
+            if (geometry == nullptr)
+            {
+                PanelGeometry& newGeometry = _geometry.Reset(bounds, scale);
+                layout(newGeometry, bounds, scale);
+                geometry = &newGeometry;
+            }
+
+            geometry->Draw(spriteRenderer, color, bounds.R);
+        }
+
+        void VerticalStretchingBorderPanelDrawable::layout(PanelGeometry& geometry, const RotatedRectanglef& bounds, float scale) const
         {
             Vector2f downDir = Vector2f::Normalize(bounds.BottomLeft() - bounds.TopLeft());
             Vector2f rightDir = Vector2f::Normalize(bounds.TopRight() - bounds.TopLeft());
@@ -191,19 +219,19 @@ namespace Dwarf
                 Vector2f middle = bounds.Center - (downDir * bounds.ExtentY) + (downDir * topSize.Y);
                 Vector2f middleSize(bounds.Width(), middleHeight);
                 Rectanglef middleRect(middle - Vector2f(middleSize.X * 0.5f, 0.0f), middleSize);
-                spriteRenderer->DrawSprite(_middle->GetTexture(), middleRect, _middle->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_middle, middleRect);
             }
 
             {
                 Vector2f topDrawPos = bounds.Center - (downDir * bounds.ExtentY);
                 Rectanglef topRect(topDrawPos - Vector2f(topSize.X * 0.5f, 0.0f), topSize);
-                spriteRenderer->DrawSprite(_topEdge->GetTexture(), topRect, _topEdge->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_topEdge, topRect);
             }
 
             {
                 Vector2f botDrawPos = bounds.Center + (downDir * bounds.ExtentY) - (downDir * botSize.Y);
                 Rectanglef botRect(botDrawPos - Vector2f(botSize.X * 0.5f, 0.0f), botSize);
-                spriteRenderer->DrawSprite(_bottomEdge->GetTexture(), botRect, _bottomEdge->GetSubRect(), color, bounds.R, Vector2f(0.5f));
+                geometry.AddSprite(_bottomEdge, botRect);
             }
         }
 
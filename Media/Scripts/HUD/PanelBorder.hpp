@@ -1,6 +1,7 @@
 #pragma once
 
 #include "HUD/Panel.hpp"
+#include "HUD/PanelGeometry.hpp"
 #include "Graphics/MaterialSet.hpp"
 
 namespace Dwarf
@@ -19,6 +20,10 @@ namespace Dwarf
             TilingBorderPanelDrawable(const Graphics::HUDMaterialSet* matset, const std::string& cornerTopLeft, const std::string& cornerTopRight,
                                        const std::string& cornerBottomLeft, const std::string& cornerBottomRight, const std::string& edgeleft,
                                        const std::string& edgeRight, const std::string& edgeTop, const std::string& edgeBottom);
+            TilingBorderPanelDrawable(const Graphics::HUDMaterial* cornerTopLeft, const Graphics::HUDMaterial* cornerTopRight,
+                                      const Graphics::HUDMaterial* cornerBottomLeft, const Graphics::HUDMaterial* cornerBottomRight,
+                                      const Graphics::HUDMaterial* edgeLeft, const Graphics::HUDMaterial* edgeRight,
+                                      const Graphics::HUDMaterial* edgeTop, const Graphics::HUDMaterial* edgeBottom);
 
             virtual PaddingFunction GetPaddingFunction() const override;
 
@@ -26,10 +31,19 @@ namespace Dwarf
 
             virtual void Draw(Graphics::SpriteRenderer* spriteRenderer, const Color& color, const RotatedRectanglef& bounds, float scale) const override;
 
+            // Draw for any renderer with SpriteRenderer's DrawSprite, the tests record the sprites with it
+            template <typename rendererT>
+            void DrawTo(rendererT* renderer, const Color& color, const RotatedRectanglef& bounds, float scale) const;
+
+            // How many times the border was laid out
+            uint32_t GetLayoutCount() const;
+
         protected:
             virtual ~TilingBorderPanelDrawable();
 
         private:
+            void layout(PanelGeometry& geometry, const RotatedRectanglef& bounds, float scale) const;
+
             ResourcePointer<const Graphics::HUDMaterial> _cornerTopLeft;
             ResourcePointer<const Graphics::HUDMaterial> _cornerTopRight;
             ResourcePointer<const Graphics::HUDMaterial> _cornerBottomLeft;
@@ -38,6 +52,8 @@ namespace Dwarf
             ResourcePointer<const Graphics::HUDMaterial> _edgeRight;
             ResourcePointer<const Graphics::HUDMaterial> _edgeTop;
             ResourcePointer<const Graphics::HUDMaterial> _edgeBottom;
+
+            mutable PanelGeometryCache _geometry;
         };
 
         class StretchingBorderPanelDrawable : public BorderPanelDrawable
@@ -73,12 +89,17 @@ namespace Dwarf
 
         private:
             float getDrawScale(float width) const;
+            void layout(PanelGeometry& geometry, const RotatedRectanglef& bounds, float scale) const;
 
             ResourcePointer<const Graphics::HUDMaterial> _topEdge;
             ResourcePointer<const Graphics::HUDMaterial> _middle;
             ResourcePointer<const Graphics::HUDMaterial> _bottomEdge;
             Vector2f _padding;
             float _scale;
+
+            mutable PanelGeometryCache _geometry;
         };
     }
 }
+
+#include "PanelBorder.inl"
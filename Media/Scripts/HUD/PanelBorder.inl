@@ -0,0 +1,19 @@
+namespace Dwarf
+{
+    namespace HUD
+    {
+        template <typename rendererT>
+        void TilingBorderPanelDrawable::DrawTo(rendererT* renderer, const Color& color, const RotatedRectanglef& bounds, float scale) const
+        {
+            const PanelGeometry* geometry = _geometry.Find(bounds, scale);
+            if (geometry == nullptr)
+            {
+                PanelGeometry& newGeometry = _geometry.Reset(bounds, scale);
+                layout(newGeometry, bounds, scale);
+                geometry = &newGeometry;
+            }
+
+            geometry->Draw(renderer, color, bounds.R);
+        }
+    }
+}
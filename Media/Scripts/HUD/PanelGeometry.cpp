@@ -0,0 +1,61 @@
+#include "HUD/PanelGeometry.hpp"
+
+namespace Dwarf
+{
+    namespace HUD
+    {
+        PanelGeometry::PanelGeometry()
+            : _sprites()
+        {
+        }
+
+        void PanelGeometry::AddSprite(const Graphics::HUDMaterial* material, const Rectanglef& destination)
+        {
+            sprite newSprite;
+            newSprite.texture = material->GetTexture();
+            newSprite.destination = destination;
+            newSprite.subRect = material->GetSubRect();
+            _sprites.push_back(newSprite);
+        }
+
+        void PanelGeometry::Clear()
+        {
+            _sprites.clear();
+        }
+
+        PanelGeometryCache::PanelGeometryCache()
+            : _valid(false)
+            , _bounds()
+            , _scale(0.0f)
+            , _geometry()
+            , _layoutCount(0)
+        {
+        }
+
+        const PanelGeometry* PanelGeometryCache::Find(const RotatedRectanglef& bounds, float scale) const
+        {
+            return (_valid && _bounds == bounds && _scale == scale) ? &_geometry : nullptr;
+        }
+
+        PanelGeometry& PanelGeometryCache::Reset(const RotatedRectanglef& bounds, float scale)
+        {
+            _valid = true;
+            _bounds = bounds;
+            _scale = scale;
+            _geometry.Clear();
+            _layoutCount++;
+            return _geometry;
+        }
+
+        void PanelGeometryCache::Clear()
+        {
+            _valid = false;
+            _geometry.Clear();
+        }
+
+        uint32_t PanelGeometryCache::GetLayoutCount() const
+        {
+            return _layoutCount;
+        }
+    }
+}
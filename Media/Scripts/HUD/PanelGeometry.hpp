@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Graphics/HUDMaterial.hpp"
+#include "Geometry/Rectangle.hpp"
+#include "Color.hpp"
+#include "NonCopyable.hpp"
+
+#include <vector>
+
+namespace Dwarf
+{
+    namespace HUD
+    {
+        // The sprites of a panel drawable laid out for one set of bounds and scale, submitted in the order they were added
+        class PanelGeometry
+        {
+        public:
+            PanelGeometry();
+
+            void AddSprite(const Graphics::HUDMaterial* material, const Rectanglef& destination);
+            void Clear();
+
+            // Submits the sprites to a sprite renderer, or to anything else with its DrawSprite
+            template <typename rendererT>
+            void Draw(rendererT* renderer, const Color& color, const Rotatorf& rotation) const;
+
+        private:
+            struct sprite
+            {
+                const Graphics::Texture* texture;
+                Rectanglef destination;
+                Rectanglef subRect;
+            };
+
+            std::vector<sprite> _sprites;
+        };
+
+        // Keeps the geometry that the drawable of a panel was last laid out with, panels that have not moved or resized
+        // submit their sprites without working them out again. The colour is applied when the sprites are submitted and
+        // does not need a new layout. Drawables with a cache belong to a single panel, a drawable shared between panels
+        // would lay out again every time a different panel draws it.
+        class PanelGeometryCache : public NonCopyable
+        {
+        public:
+            PanelGeometryCache();
+
+            // Geometry laid out for the bounds and scale, nullptr when there is none or the panel moved or resized since
+            const PanelGeometry* Find(const RotatedRectanglef& bounds, float scale) const;
+
+            // Empty geometry to lay out for the bounds and scale, replaces the previous layout
+            PanelGeometry& Reset(const RotatedRectanglef& bounds, float scale);
+
+            void Clear();
+
+            // How many times the geometry was laid out
+            uint32_t GetLayoutCount() const;
+
+        private:
+            bool _valid;
+            RotatedRectanglef _bounds;
+            float _scale;
+            PanelGeometry _geometry;
+            uint32_t _layoutCount;
+        };
+    }
+}
+
+#include "PanelGeometry.inl"
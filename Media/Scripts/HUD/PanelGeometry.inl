@@ -0,0 +1,14 @@
+namespace Dwarf
+{
+    namespace HUD
+    {
+        template <typename rendererT>
+        void PanelGeometry::Draw(rendererT* renderer, const Color& color, const Rotatorf& rotation) const
+        {
+            for (const sprite& curSprite : _sprites)
+            {
+                renderer->DrawSprite(curSprite.texture, curSprite.destination, curSprite.subRect, color, rotation, Vector2f(0.5f));
+            }
+        }
+    }
+}
@@ -68,7 +68,7 @@ namespace Dwarf
             return _tooltip;
         }
 
-        void PauseButton::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera)
+        void PauseButton::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera)
         {
             Vector2f mousePos = input.UnProjectMousePosition(camera);
             _skeleton->Update(totalTime, dt);
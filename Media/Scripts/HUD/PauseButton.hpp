@@ -3,7 +3,7 @@
 #include "Content/ContentManager.hpp"
 #include "Content/Preload.hpp"
 #include "Localization/StringTable.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Graphics/SpriteRenderer.hpp"
 #include "HUD/Panel.hpp"
 #include "Animation/SkeletonInstance.hpp"
@@ -28,7 +28,7 @@ namespace Dwarf
             bool IsJustClicked() const;
             const Panel* GetTooltip() const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
         private:
@@ -28,7 +28,11 @@ namespace Dwarf
 
         static const std::string FontPath = "Fonts/hud_font.ttf";
 
+        // Enough for the values passed while the display counts towards a change in gold
+        static const uint32_t GoldTextLayoutCapacity = 16;
+
         ResourceDisplay::ResourceDisplay(Content::ContentManager* contentManager, const Localization::StringTable* strings, Input::InputBindCode clickBind)
+            : _goldTextLayouts(GoldTextLayoutCapacity)
         {
             _panelSkeleton = EmplaceResource(Content::CreateSkeletonInstance(contentManager, ResourceDisplaySkeletonPath, ResourceDisplayMatsetPath));
             _panelSkeleton->PlayAnimation(MoveOutAnimation, false, 0.0f, _panelSkeleton->GetAnimationLength(MoveOutAnimation));
@@ -91,7 +95,7 @@ namespace Dwarf
             return _tooltip;
         }
 
-        void ResourceDisplay::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera)
+        void ResourceDisplay::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera)
         {
             Vector2f mousePos = input.UnProjectMousePosition(camera);
             _panelSkeleton->Update(totalTime, dt);
@@ -113,6 +117,12 @@ namespace Dwarf
                 _displayGold = static_cast<float>(_currentResources.Gold);
             }
 
+            if (static_cast<int32_t>(_displayGold) != _goldTextValue)
+            {
+                _goldTextValue = static_cast<int32_t>(_displayGold);
+                _goldText = Format("%i", _goldTextValue);
+            }
+
             uint32_t targetGoldIcon = Min(_displayGold / GoldPerIcon, _goldSizeMaterials.size() - 1);
             if (targetGoldIcon != _currentGoldIcon)
             {
@@ -128,7 +138,7 @@ namespace Dwarf
 
             Vector2f goldDisplayPos = _panelSkeleton->GetJointPosition(GoldDisplayJoint.first);
             Rectanglef goldDisplayArea(goldDisplayPos, _panelSkeleton->GetJointPosition(GoldDisplayJoint.second) - goldDisplayPos);
-            Graphics::PreparedText preparedText(Format("%i", static_cast<int32_t>(_displayGold)), _font, goldDisplayArea.H, Color::Gold);
+            const Graphics::PreparedText& preparedText = _goldTextLayouts.GetText(_goldText, _font, static_cast<uint32_t>(goldDisplayArea.H), Color::Gold);
             spriteRenderer->DrawString(preparedText, goldDisplayArea.BottomRight() - Vector2f(preparedText.GetSize()), Color::White);
         }
     }
@@ -3,9 +3,10 @@
 #include "Content/ContentManager.hpp"
 #include "Content/Preload.hpp"
 #include "Localization/StringTable.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Graphics/SpriteRenderer.hpp"
 #include "HUD/Panel.hpp"
+#include "HUD/TextLayoutCache.hpp"
 #include "Animation/SkeletonInstance.hpp"
 #include "Item/Resources.hpp"
 
@@ -31,7 +32,7 @@ namespace Dwarf
             bool IsJustClicked() const;
             const Panel* GetTooltip() const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
         private:
@@ -44,6 +45,10 @@ namespace Dwarf
             float _displayGold = 0.0f;
             Item::Resources _currentResources;
 
+            int32_t _goldTextValue = 0;
+            std::string _goldText = "0";
+            mutable TextLayoutCache _goldTextLayouts;
+
             ResourcePointer<Animation::SkeletonInstance> _panelSkeleton;
 
             ResourcePointer<Animation::SkeletonInstance> _goldSkeleton;
@@ -56,6 +56,8 @@ namespace Dwarf
         static const std::pair<std::string, std::string> PanelBackgroundArea{ "background_pos", "background_size" };
         static const std::string PanelTooltipPos = "tooltip_pos";
 
+        static const uint32_t NameTextLayoutCapacity = 8;
+
         static const std::string MoveInAnimation = "move_in";
         static const std::string MoveOutAnimation = "move_out";
 
@@ -123,6 +125,7 @@ namespace Dwarf
             , _selectedTooltip(nullptr)
 
             , _nameFont(nullptr)
+            , _nameTextLayouts(NameTextLayoutCapacity)
             , _tooltipFont(nullptr)
             , _panel(nullptr)
             , _buttons(nullptr)
@@ -198,6 +201,7 @@ namespace Dwarf
             SafeRelease(_selectedCharacter);
             SafeRelease(_selectedCharacterSkeleton);
 
+            _nameTextLayouts.Clear();
             SafeRelease(_nameFont);
             SafeRelease(_tooltipFont);
             SafeRelease(_panel);
@@ -297,7 +301,7 @@ namespace Dwarf
             return _buttons->GetButtonBounds(_actionButtons.size() + abilityIdx).ToRectangle();
         }
 
-        void SelectionArea::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera)
+        void SelectionArea::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera)
         {
             Vector2f mousePos = input.UnProjectMousePosition(camera);
 
@@ -399,7 +403,7 @@ namespace Dwarf
                 RotatedRectanglef nameArea = getRotatedRectangle(_panel, PanelRoot, PanelNameArea);
 
                 const std::string& nameText = _selectedCharacter->GetName();
-                Graphics::PreparedText characterNameText = Graphics::FitTextToSize(nameText, _nameFont, Color::White, false, false, 1.0f, (nameArea.Extents * 2.0f) - Vector2f(16.0f, 0.0f));
+                const Graphics::PreparedText& characterNameText = _nameTextLayouts.GetFittedText(nameText, _nameFont, Color::White, (nameArea.Extents * 2.0f) - Vector2f(16.0f, 0.0f));
                 Vector2u textSize = characterNameText.GetSize();
                 Vector2f textPosition = nameArea.Middle() - Vector2f(textSize.X * 0.5f, textSize.Y * 0.5f);
 
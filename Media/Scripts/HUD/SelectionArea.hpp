@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Input/InputBinding.hpp"
-#include "Input/FrameInput.hpp"
+#include "GameInput.hpp"
 #include "Graphics/Portrait.hpp"
 #include "Graphics/Text/Font.hpp"
 #include "Geometry/Rectangle.hpp"
@@ -12,6 +12,7 @@
 #include "Content/Preload.hpp"
 
 #include "HUD/ButtonPanel.hpp"
+#include "HUD/TextLayoutCache.hpp"
 
 #include <stdint.h>
 
@@ -45,7 +46,7 @@ namespace Dwarf
 
             Rectanglef GetAbilityButtonBounds(uint32_t abilityIdx) const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
         private:
@@ -81,6 +82,7 @@ namespace Dwarf
             const Panel* _selectedTooltip;
 
             const Graphics::Font* _nameFont;
+            mutable TextLayoutCache _nameTextLayouts;
             const Graphics::Font* _tooltipFont;
             Animation::SkeletonInstance* _panel;
             HUD::ButtonPanel* _buttons;
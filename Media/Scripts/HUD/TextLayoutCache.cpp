@@ -0,0 +1,67 @@
+#include "HUD/TextLayoutCache.hpp"
+
+#include <tuple>
+
+namespace Dwarf
+{
+    namespace HUD
+    {
+        TextLayoutCache::TextLayoutCache(uint32_t capacity)
+            : _layouts()
+            , _lookup()
+            , _capacity(capacity)
+        {
+            assert(_capacity > 0);
+        }
+
+        const Graphics::PreparedText& TextLayoutCache::GetText(const std::string& text, const Graphics::Font* font, uint32_t size, const Color& color)
+        {
+            return getLayout(layoutKey { text, font, size, color, Vector2f::Zero, false }, [&]()
+            {
+                return Graphics::PreparedText(text, font, size, color);
+            });
+        }
+
+        const Graphics::PreparedText& TextLayoutCache::GetFittedText(const std::string& text, const Graphics::Font* font, const Color& color, const Vector2f& fitSize)
+        {
+            return getLayout(layoutKey { text, font, 0, color, fitSize, true }, [&]()
+            {
+                return Graphics::FitTextToSize(text, font, color, false, false, 1.0f, fitSize);
+            });
+        }
+
+        void TextLayoutCache::Clear()
+        {
+            _lookup.clear();
+            _layouts.clear();
+        }
+
+        bool TextLayoutCache::compareKeys::operator()(const layoutKey& a, const layoutKey& b) const
+        {
+            return std::tie(a.fitted, a.font, a.size, a.color.R, a.color.G, a.color.B, a.color.A, a.fitSize.X, a.fitSize.Y, a.text) <
+                   std::tie(b.fitted, b.font, b.size, b.color.R, b.color.G, b.color.B, b.color.A, b.fitSize.X, b.fitSize.Y, b.text);
+        }
+
+        template <typename layoutFunc>
+        const Graphics::PreparedText& TextLayoutCache::getLayout(layoutKey&& key, layoutFunc createLayout)
+        {
+            auto iter = _lookup.find(key);
+            if (iter != _lookup.end())
+            {
+                // Most recently used layouts are kept at the front of the list
+                _layouts.splice(_layouts.begin(), _layouts, iter->second);
+                return iter->second->text;
+            }
+
+            if (_layouts.size() >= _capacity)
+            {
+                _lookup.erase(_layouts.back().key);
+                _layouts.pop_back();
+            }
+
+            _layouts.push_front(layout { _lookup.end(), createLayout() });
+            _layouts.front().key = _lookup.insert(std::make_pair(std::move(key), _layouts.begin())).first;
+            return _layouts.front().text;
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Graphics/Text/Font.hpp"
+#include "Graphics/Text/PreparedText.hpp"
+#include "Geometry/Vector2.hpp"
+#include "Color.hpp"
+#include "NonCopyable.hpp"
+
+#include <list>
+#include <map>
+#include <string>
+
+namespace Dwarf
+{
+    namespace HUD
+    {
+        // Keeps the most recently drawn text layouts of a widget so that text is only shaped again when the string,
+        // font, size, colour or fit box it is drawn with changes. The least recently used layout is dropped once the
+        // capacity is reached.
+        class TextLayoutCache : public NonCopyable
+        {
+        public:
+            TextLayoutCache(uint32_t capacity);
+
+            const Graphics::PreparedText& GetText(const std::string& text, const Graphics::Font* font, uint32_t size, const Color& color);
+            const Graphics::PreparedText& GetFittedText(const std::string& text, const Graphics::Font* font, const Color& color, const Vector2f& fitSize);
+
+            void Clear();
+
+        private:
+            struct layoutKey
+            {
+                std::string text;
+                const Graphics::Font* font;
+                uint32_t size;
+                Color color;
+                Vector2f fitSize;
+                bool fitted;
+            };
+
+            struct compareKeys
+            {
+                bool operator()(const layoutKey& a, const layoutKey& b) const;
+            };
+
+            struct layout;
+            using layoutList = std::list<layout>;
+            using layoutMap = std::map<layoutKey, layoutList::iterator, compareKeys>;
+
+            struct layout
+            {
+                layoutMap::iterator key;
+                Graphics::PreparedText text;
+            };
+
+            template <typename layoutFunc>
+            const Graphics::PreparedText& getLayout(layoutKey&& key, layoutFunc createLayout);
+
+            layoutList _layouts;
+            layoutMap _lookup;
+
+            const uint32_t _capacity;
+        };
+    }
+}
@@ -440,8 +440,10 @@ namespace Dwarf
                 centerPanel->AddAlignedText(Alignment_Fill, tooltipFont, extraDescriptionText);
             }
 
-            centerPanel->AddAlignedPanelDrawable(Alignment_BackgroundFill, mediumBorder);
-            centerPanel->SetVariablePadding(mediumBorder->GetPaddingFunction());
+            // Borders keep the layout of the panel they are drawn for, each panel gets its own
+            ResourcePointer<BorderPanelDrawable> centerBorder = EmplaceResource(CreateMediumBorder(contentManager));
+            centerPanel->AddAlignedPanelDrawable(Alignment_BackgroundFill, centerBorder);
+            centerPanel->SetVariablePadding(centerBorder->GetPaddingFunction());
             centerPanel->SetConstantPadding(5.0f);
 
             ResourcePointer<Panel> tooltipPanel = MakeResource<Panel>();
@@ -799,8 +801,10 @@ namespace Dwarf
             descriptionPanel->SetConstantPadding(Vector2f(3.0f, 0.0f));
             descriptionPanel->AddAlignedPanel(Alignment_Top, chalkmanPanel);
             descriptionPanel->AddAlignedText(Alignment_Fill, tooltipFont, descriptionText);
-            descriptionPanel->AddAlignedPanelDrawable(Alignment_BackgroundFill, mediumBorder);
-            descriptionPanel->SetVariablePadding(mediumBorder->GetPaddingFunction());
+            // Borders keep the layout of the panel they are drawn for, each panel gets its own
+            ResourcePointer<BorderPanelDrawable> descriptionBorder = EmplaceResource(CreateMediumBorder(contentManager));
+            descriptionPanel->AddAlignedPanelDrawable(Alignment_BackgroundFill, descriptionBorder);
+            descriptionPanel->SetVariablePadding(descriptionBorder->GetPaddingFunction());
 
             ResourcePointer<Panel> tooltipPanel = MakeResource<Panel>();
             tooltipPanel->SetConstantPadding(5.0f);
@@ -868,7 +872,7 @@ namespace Dwarf
                 tutorialText = strings->GetString("tutorial_primary_selection");
                 break;
 
-            default:
+            default:
                 break;
             }
 
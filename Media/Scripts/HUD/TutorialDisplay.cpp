@@ -133,7 +133,7 @@ namespace Dwarf
             }
         }
 
-        void TutorialDisplay::Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera)
+        void TutorialDisplay::Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera)
         {
             _mouseOver = false;
 
@@ -2,6 +2,7 @@
 
 #include "Content/Preload.hpp"
 #include "Content/ContentManager.hpp"
+#include "GameInput.hpp"
 
 #include "Settings/TheDeepDeepProfile.hpp"
 #include "Tutorials.hpp"
@@ -31,7 +32,7 @@ namespace Dwarf
 
             bool IsMouseOver() const;
 
-            void Update(double totalTime, float dt, const Input::FrameInput& input, const Camera& camera);
+            void Update(double totalTime, float dt, const Input::GameInput& input, const Camera& camera);
             void Draw(Graphics::SpriteRenderer* spriteRenderer) const;
 
         private:
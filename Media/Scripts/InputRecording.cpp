@@ -0,0 +1,285 @@
+#include "InputRecording.hpp"
+#include "FileSystem/FileSystem.hpp"
+#include "Random.hpp"
+
+#include <fstream>
+#include <random>
+
+namespace Dwarf
+{
+    namespace Input
+    {
+        static const uint32_t InputRecordingMagic = 0x52495744; // "DWIR"
+        static const uint32_t InputRecordingVersion = 1;
+
+        enum frameFlags : uint8_t
+        {
+            frameFlags_MousePosition = 1 << 0,
+            frameFlags_ScrollDelta = 1 << 1,
+        };
+
+        // Dt, flags and bind count are written for every frame, even one without any input
+        static const uint32_t MinRecordedFrameSize = sizeof(float) + sizeof(uint8_t) + sizeof(uint16_t);
+
+        static InputSessionMode PendingSessionMode = InputSessionMode_None;
+        static std::string PendingSessionPath;
+
+        void SetPendingInputSession(InputSessionMode mode, const std::string& path)
+        {
+            PendingSessionMode = mode;
+            PendingSessionPath = path;
+        }
+
+        std::string GetDefaultInputRecordingPath()
+        {
+            return Format("%s/%s/%s", FileSystem::GetHomePath().c_str(), "Dwarf", "input_recording.bin");
+        }
+
+        template <typename T>
+        static void writeValue(std::ofstream& stream, const T& value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        static bool readValue(std::ifstream& stream, T& value)
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        InputSession::InputSession()
+            : _mode(InputSessionMode_None)
+            , _path()
+            , _seed(0)
+            , _frames()
+            , _nextFrame(0)
+        {
+        }
+
+        InputSession::~InputSession()
+        {
+            End();
+        }
+
+        void InputSession::Begin()
+        {
+            _mode = PendingSessionMode;
+            _path = PendingSessionPath;
+            PendingSessionMode = InputSessionMode_None;
+            PendingSessionPath.clear();
+
+            _frames.clear();
+            _nextFrame = 0;
+
+            if (_mode == InputSessionMode_Record)
+            {
+                _seed = std::random_device()();
+                LogInfo("InputSession", Format("Recording input to %s with seed %u.", _path.c_str(), _seed));
+            }
+            else if (_mode == InputSessionMode_Replay)
+            {
+                if (!load())
+                {
+                    _mode = InputSessionMode_None;
+                    return;
+                }
+                LogInfo("InputSession", Format("Replaying %u frames of input from %s with seed %u.", GetFrameCount(), _path.c_str(), _seed));
+            }
+            else
+            {
+                return;
+            }
+
+            Random::SetSeed(_seed);
+        }
+
+        InputSessionMode InputSession::GetMode() const
+        {
+            return _mode;
+        }
+
+        uint32_t InputSession::GetSeed() const
+        {
+            return _seed;
+        }
+
+        uint32_t InputSession::GetFrameIndex() const
+        {
+            return _mode == InputSessionMode_Replay ? _nextFrame : GetFrameCount();
+        }
+
+        uint32_t InputSession::GetFrameCount() const
+        {
+            return static_cast<uint32_t>(_frames.size());
+        }
+
+        GameInputFrame* InputSession::BeginRecordedFrame(float dt)
+        {
+            if (_mode != InputSessionMode_Record)
+            {
+                return nullptr;
+            }
+
+            _frames.push_back(GameInputFrame());
+            _frames.back().Dt = dt;
+            return &_frames.back();
+        }
+
+        const GameInputFrame* InputSession::NextReplayFrame()
+        {
+            if (_mode != InputSessionMode_Replay)
+            {
+                return nullptr;
+            }
+
+            if (_nextFrame >= _frames.size())
+            {
+                LogInfo("InputSession", Format("Finished replaying %s.", _path.c_str()));
+                End();
+                return nullptr;
+            }
+
+            return &_frames[_nextFrame++];
+        }
+
+        void InputSession::End()
+        {
+            if (_mode == InputSessionMode_Record)
+            {
+                save();
+            }
+
+            _mode = InputSessionMode_None;
+            _frames.clear();
+            _nextFrame = 0;
+        }
+
+        bool InputSession::save() const
+        {
+            std::ofstream stream(_path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!stream)
+            {
+                LogError("InputSession", Format("Failed to open %s for writing the input recording.", _path.c_str()));
+                return false;
+            }
+
+            writeValue(stream, InputRecordingMagic);
+            writeValue(stream, InputRecordingVersion);
+            writeValue(stream, _seed);
+            writeValue(stream, GetFrameCount());
+
+            for (const GameInputFrame& frame : _frames)
+            {
+                uint8_t flags = 0;
+                flags |= frame.HasMousePosition ? frameFlags_MousePosition : 0;
+                flags |= frame.HasScrollDelta ? frameFlags_ScrollDelta : 0;
+
+                writeValue(stream, frame.Dt);
+                writeValue(stream, flags);
+                if (frame.HasMousePosition)
+                {
+                    writeValue(stream, frame.MouseScreenPosition.X);
+                    writeValue(stream, frame.MouseScreenPosition.Y);
+                }
+                if (frame.HasScrollDelta)
+                {
+                    writeValue(stream, frame.ScrollDelta.X);
+                    writeValue(stream, frame.ScrollDelta.Y);
+                }
+
+                // Binds that are not held or changing are left out, they read back as released
+                uint16_t bindCount = 0;
+                for (const auto& bindState : frame.BindStates)
+                {
+                    bindCount += bindState.second != BindState_Released ? 1 : 0;
+                }
+                writeValue(stream, bindCount);
+                for (const auto& bindState : frame.BindStates)
+                {
+                    if (bindState.second != BindState_Released)
+                    {
+                        writeValue(stream, bindState.first);
+                        writeValue(stream, bindState.second);
+                    }
+                }
+            }
+
+            if (!stream)
+            {
+                LogError("InputSession", Format("Failed to write the input recording to %s.", _path.c_str()));
+                return false;
+            }
+
+            LogInfo("InputSession", Format("Saved %u frames of input to %s.", GetFrameCount(), _path.c_str()));
+            return true;
+        }
+
+        bool InputSession::load()
+        {
+            std::ifstream stream(_path.c_str(), std::ios::in | std::ios::binary);
+            if (!stream)
+            {
+                LogError("InputSession", Format("Failed to open input recording %s.", _path.c_str()));
+                return false;
+            }
+
+            uint32_t magic = 0, version = 0, frameCount = 0;
+            if (!readValue(stream, magic) || magic != InputRecordingMagic ||
+                !readValue(stream, version) || version != InputRecordingVersion ||
+                !readValue(stream, _seed) || !readValue(stream, frameCount))
+            {
+                LogError("InputSession", Format("%s is not a supported input recording.", _path.c_str()));
+                return false;
+            }
+
+            // Check the frame count against what is left of the file before allocating anything for it
+            std::streampos headerEnd = stream.tellg();
+            stream.seekg(0, std::ios::end);
+            std::streamoff remainingSize = stream.tellg() - headerEnd;
+            stream.seekg(headerEnd);
+            if (!stream || remainingSize < 0 || static_cast<uint64_t>(frameCount) * MinRecordedFrameSize > static_cast<uint64_t>(remainingSize))
+            {
+                LogError("InputSession", Format("Input recording %s claims %u frames but is too short to hold them.", _path.c_str(), frameCount));
+                return false;
+            }
+
+            _frames.resize(frameCount);
+            for (GameInputFrame& frame : _frames)
+            {
+                uint8_t flags = 0;
+                uint16_t bindCount = 0;
+                bool valid = readValue(stream, frame.Dt) && readValue(stream, flags);
+
+                frame.HasMousePosition = (flags & frameFlags_MousePosition) != 0;
+                if (valid && frame.HasMousePosition)
+                {
+                    valid = readValue(stream, frame.MouseScreenPosition.X) && readValue(stream, frame.MouseScreenPosition.Y);
+                }
+
+                frame.HasScrollDelta = (flags & frameFlags_ScrollDelta) != 0;
+                if (valid && frame.HasScrollDelta)
+                {
+                    valid = readValue(stream, frame.ScrollDelta.X) && readValue(stream, frame.ScrollDelta.Y);
+                }
+
+                valid = valid && readValue(stream, bindCount);
+                for (uint16_t i = 0; valid && i < bindCount; i++)
+                {
+                    uint32_t bind = 0;
+                    uint8_t state = 0;
+                    valid = readValue(stream, bind) && readValue(stream, state);
+                    frame.BindStates[bind] = state;
+                }
+
+                if (!valid)
+                {
+                    LogError("InputSession", Format("Input recording %s is truncated.", _path.c_str()));
+                    _frames.clear();
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "GameInput.hpp"
+#include "NonCopyable.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Input
+    {
+        enum InputSessionMode
+        {
+            InputSessionMode_None,
+            InputSessionMode_Record,
+            InputSessionMode_Replay,
+        };
+
+        // Requests that the next level to be created records its input to, or replays its input from, the given file
+        void SetPendingInputSession(InputSessionMode mode, const std::string& path);
+        std::string GetDefaultInputRecordingPath();
+
+        // Records the per-frame input, dt and random seed of a level so that the level can be replayed with identical
+        // simulation state, or feeds a recording back in its place. The file is a compact binary stream of the frames,
+        // only the binds that were queried are stored.
+        class InputSession : public NonCopyable
+        {
+        public:
+            InputSession();
+            ~InputSession();
+
+            // Takes over the pending session request, if any, and seeds the random number generator. Has to be called
+            // before anything in the level draws a random number.
+            void Begin();
+
+            InputSessionMode GetMode() const;
+            uint32_t GetSeed() const;
+            uint32_t GetFrameIndex() const;
+            uint32_t GetFrameCount() const;
+
+            // Frame that this frame's input queries are recorded to, nullptr when not recording
+            GameInputFrame* BeginRecordedFrame(float dt);
+
+            // Next recorded frame, nullptr when not replaying or once the replay has finished
+            const GameInputFrame* NextReplayFrame();
+
+            // Saves the recording and stops recording or replaying
+            void End();
+
+        private:
+            bool save() const;
+            bool load();
+
+            InputSessionMode _mode;
+            std::string _path;
+            uint32_t _seed;
+
+            std::vector<GameInputFrame> _frames;
+            uint32_t _nextFrame;
+        };
+    }
+}
@@ -1,4 +1,5 @@
 #include "Items/Weapons/BasicWeapon.hpp"
+#include "Audio/SoundEventScheduler.hpp"
 #include "ContentUtility.hpp"
 #include "SkeletonUtility.hpp"
 
@@ -287,8 +288,7 @@ namespace Dwarf
                         static const float MaxVolumeVelocity = 3000.0f;
                         float volume = Saturate((velocityIntoSurface - VelocityThreshold) / MaxVolumeVelocity);
 
-                        auto soundManager = GetLevel()->GetSoundManager();
-                        soundManager->PlaySinglePositionalSound(_physicsMaterialSounds.GetNextSound(), Audio::SoundPriority::Low,
+                        Audio::PlaySoundEvent(GetLevel(), Audio::SoundCategory_Impact, _physicsMaterialSounds.GetNextSound(), Audio::SoundPriority::Low,
                             contact.Position, PhysicsCollisionSoundRadius.first, PhysicsCollisionSoundRadius.second,
                             PhysicsCollisionSoundVolume * volume);
 
@@ -0,0 +1,127 @@
+#include "JobSystem.hpp"
+
+namespace Dwarf
+{
+    namespace Threading
+    {
+        JobSystem::JobSystem(uint32_t threadCount)
+            : _workers()
+            , _mutex()
+            , _workAvailable()
+            , _workFinished()
+            , _job(nullptr)
+            , _jobCount(0)
+            , _nextJob(0)
+            , _busyWorkers(0)
+            , _generation(0)
+            , _stopping(false)
+        {
+            if (threadCount == 0)
+            {
+                threadCount = Max(std::thread::hardware_concurrency(), 1U);
+            }
+
+            // The calling thread takes part in every ParallelFor, only the remaining threads are spawned
+            for (uint32_t i = 1; i < threadCount; i++)
+            {
+                _workers.emplace_back(&JobSystem::workerMain, this, i);
+            }
+        }
+
+        JobSystem::~JobSystem()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _workAvailable.notify_all();
+
+            for (auto& worker : _workers)
+            {
+                worker.join();
+            }
+        }
+
+        uint32_t JobSystem::GetThreadCount() const
+        {
+            return static_cast<uint32_t>(_workers.size()) + 1;
+        }
+
+        JobSystem& JobSystem::GetShared()
+        {
+            static JobSystem sharedJobs;
+            return sharedJobs;
+        }
+
+        void JobSystem::ParallelFor(uint32_t count, const ParallelJob& job)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            if (_workers.empty() || count == 1)
+            {
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    job(i, 0);
+                }
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job = &job;
+                _jobCount = count;
+                _nextJob = 0;
+                _busyWorkers = static_cast<uint32_t>(_workers.size());
+                _generation++;
+            }
+            _workAvailable.notify_all();
+
+            runJobs(0);
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workFinished.wait(lock, [this]() { return _busyWorkers == 0; });
+            _job = nullptr;
+        }
+
+        void JobSystem::workerMain(uint32_t worker)
+        {
+            uint64_t lastGeneration = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _workAvailable.wait(lock, [&]() { return _stopping || _generation != lastGeneration; });
+                    if (_stopping)
+                    {
+                        return;
+                    }
+                    lastGeneration = _generation;
+                }
+
+                runJobs(worker);
+
+                bool lastWorker = false;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    lastWorker = --_busyWorkers == 0;
+                }
+                if (lastWorker)
+                {
+                    _workFinished.notify_one();
+                }
+            }
+        }
+
+        void JobSystem::runJobs(uint32_t worker)
+        {
+            uint32_t index;
+            while ((index = _nextJob.fetch_add(1)) < _jobCount)
+            {
+                (*_job)(index, worker);
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Threading
+    {
+        // Index of the job and of the worker running it, worker 0 is the thread that called ParallelFor
+        using ParallelJob = std::function<void(uint32_t index, uint32_t worker)>;
+
+        // A small pool of worker threads that split a range of jobs between them and the calling thread. ParallelFor
+        // blocks until every job has finished, so jobs may reference the caller's stack.
+        class JobSystem : public NonCopyable
+        {
+        public:
+            // A thread count of zero uses one thread per hardware thread
+            JobSystem(uint32_t threadCount = 0);
+            ~JobSystem();
+
+            // Number of threads jobs are spread over, including the calling thread
+            uint32_t GetThreadCount() const;
+
+            // Job system shared by every level of the process, its threads are started on first use and live until exit.
+            // Only the main thread may submit jobs to it.
+            static JobSystem& GetShared();
+
+            void ParallelFor(uint32_t count, const ParallelJob& job);
+
+        private:
+            void workerMain(uint32_t worker);
+            void runJobs(uint32_t worker);
+
+            std::vector<std::thread> _workers;
+
+            std::mutex _mutex;
+            std::condition_variable _workAvailable;
+            std::condition_variable _workFinished;
+
+            const ParallelJob* _job;
+            uint32_t _jobCount;
+            std::atomic<uint32_t> _nextJob;
+            uint32_t _busyWorkers;
+            uint64_t _generation;
+            bool _stopping;
+        };
+    }
+}
@@ -1,4 +1,7 @@
 #include "Levels/BasicLevel.hpp"
+#include "Profiler.hpp"
+#include "HUD/Debugger.hpp"
+#include "HUD/DebuggerElements.hpp"
 
 namespace Dwarf
 {
@@ -6,16 +9,133 @@ namespace Dwarf
     {
         const Color BasicLevel::BaseFireColor = Color::FromBytes(255, 185, 130, 255);
 
+        static const float TargetIndexCellSize = 512.0f;
+        static const float LightTileSize = 1024.0f;
+        static const float TriggerVolumeCellSize = 512.0f;
+        static const float PathGraphCellSize = 512.0f;
+        static const uint32_t MaxPathReplansPerUpdate = 4;
+        static const float DormancyCellSize = 1024.0f;
+        static const float DormancyViewMargin = 512.0f;
+
         BasicLevel::BasicLevel(const LevelParameters& parameters)
             : LevelInstance(parameters)
             , _musicManager(GetSoundManager())
             , _ambientSound(GetSoundManager())
+            , _soundEmitters(GetSoundManager())
+            , _soundEvents(GetSoundManager())
+            , _flameManager()
+            , _lights(LightTileSize)
+            , _particleEffects()
+            , _characterArchetypes()
+            , _statusEffects()
+            , _targetIndex(TargetIndexCellSize)
+            , _characterUpdate()
+            , _dormancy(DormancyCellSize, DormancyViewMargin)
+            , _triggerVolumes(TriggerVolumeCellSize)
+            , _pathGraph(PathGraphCellSize, MaxPathReplansPerUpdate)
+            , _markers()
+            , _inputSession()
+            , _benchmark(nullptr)
         {
         }
 
         void BasicLevel::InitializeDebugger(HUD::Debugger* debugger)
         {
             _musicManager.InitializeDebugger(debugger);
+
+            auto parallelUpdateElement =
+                std::make_shared<HUD::CheckboxDebuggerElement>("Parallel character update",
+                    [this]() { return _characterUpdate.IsEnabled(); },
+                    [this](bool value) { _characterUpdate.SetEnabled(value); });
+            debugger->AddElement("Performance", "Parallel character update", parallelUpdateElement);
+
+            auto dormancyElement =
+                std::make_shared<HUD::CheckboxDebuggerElement>("Sleep idle props",
+                    [this]() { return _dormancy.IsEnabled(); },
+                    [this](bool value) { _dormancy.SetEnabled(value); });
+            debugger->AddElement("Performance", "Prop dormancy", dormancyElement);
+
+            debugger->AddElement("Performance", "Input recording", std::make_shared<HUD::InputSessionDebuggerElement>(&_inputSession));
+        }
+
+        Audio::SoundEmitterManager& BasicLevel::GetSoundEmitterManager()
+        {
+            return _soundEmitters;
+        }
+
+        Audio::SoundEventScheduler& BasicLevel::GetSoundEventScheduler()
+        {
+            return _soundEvents;
+        }
+
+        Graphics::FlameManager& BasicLevel::GetFlameManager()
+        {
+            return _flameManager;
+        }
+
+        Graphics::LightCuller& BasicLevel::GetLightCuller()
+        {
+            return _lights;
+        }
+
+        Graphics::ParticleEffectManager& BasicLevel::GetParticleEffectManager()
+        {
+            return _particleEffects;
+        }
+
+        Character::CharacterArchetypeCache& BasicLevel::GetCharacterArchetypeCache()
+        {
+            return _characterArchetypes;
+        }
+
+        Character::StatusEffectManager& BasicLevel::GetStatusEffectManager()
+        {
+            return _statusEffects;
+        }
+
+        const Character::TargetIndex& BasicLevel::GetTargetIndex() const
+        {
+            return _targetIndex;
+        }
+
+        Character::ParallelCharacterUpdate& BasicLevel::GetParallelCharacterUpdate()
+        {
+            return _characterUpdate;
+        }
+
+        Character::DormancyManager& BasicLevel::GetDormancyManager()
+        {
+            return _dormancy;
+        }
+
+        TriggerVolumeManager& BasicLevel::GetTriggerVolumeManager()
+        {
+            return _triggerVolumes;
+        }
+
+        PathGraphPatcher& BasicLevel::GetPathGraphPatcher()
+        {
+            return _pathGraph;
+        }
+
+        const LevelMarkers& BasicLevel::GetMarkers() const
+        {
+            return _markers;
+        }
+
+        Input::InputSession& BasicLevel::GetInputSession()
+        {
+            return _inputSession;
+        }
+
+        void BasicLevel::SetSimulationBenchmark(SimulationBenchmark* benchmark)
+        {
+            _benchmark = benchmark;
+        }
+
+        SimulationBenchmark* BasicLevel::GetSimulationBenchmark() const
+        {
+            return _benchmark;
         }
 
         BasicLevel::~BasicLevel()
@@ -63,14 +183,61 @@ namespace Dwarf
 
         void BasicLevel::OnCreate()
         {
+            // Seeds the random number generator when recording or replaying, before the level draws any random numbers
+            _inputSession.Begin();
+
+            OnResolveMarkers(_markers);
+            _markers.Validate();
+
             _musicManager.Play();
         }
 
+        void BasicLevel::OnResolveMarkers(LevelMarkers& markers)
+        {
+        }
+
         void BasicLevel::OnUpdate(double totalTime, float dt)
         {
+            PROFILE_FRAME();
+            PROFILE_ZONE("BasicLevel::OnUpdate");
+
+            _targetIndex.Rebuild(this);
+            _triggerVolumes.Update(this);
+            {
+                ScopedSimulationTimer pathTimer(_benchmark, SimulationStage_PathReplanning);
+                _pathGraph.Update(this);
+            }
+            _dormancy.Update();
+            {
+                ScopedSimulationTimer characterTimer(_benchmark, SimulationStage_CharacterUpdate);
+                _characterUpdate.Update(this, totalTime, dt);
+            }
+
             _musicManager.SetMasterVolume(GetProfile()->GetMusicVolume());
             _musicManager.Update(totalTime, dt);
             _ambientSound.Update(totalTime, dt);
+            _soundEmitters.Update(totalTime, dt, GetCameraController().GetCamera());
+            {
+                ScopedSimulationTimer particlesTimer(_benchmark, SimulationStage_Particles);
+                _flameManager.Update(totalTime, dt, GetPrimaryLayer()->GetCamera());
+                _particleEffects.Update(totalTime, dt);
+            }
+            _lights.Update();
+            _statusEffects.Update(totalTime, dt);
+
+            // Last, so that the sounds triggered by the level's own systems above are heard this frame. The engine
+            // updates the characters after the level, the footstep, attack and impact sounds they trigger are queued
+            // until this point of the next frame and heard one update late. Scripts have no hook that runs after the
+            // characters, the delay is accepted over flushing from the const draw.
+            _soundEvents.Update(GetCameraController().GetCamera());
+        }
+
+        void BasicLevel::OnDraw(LevelLayerInstance* layer, Graphics::LevelRenderer* levelRenderer) const
+        {
+            LevelInstance::OnDraw(layer, levelRenderer);
+
+            _lights.Draw(layer, levelRenderer);
+            _particleEffects.Draw(layer, levelRenderer);
         }
 
         void BasicLevel::OnLoadContent(Content::ContentManager* contentManager)
@@ -83,6 +250,8 @@ namespace Dwarf
         {
             _musicManager.UnloadContent();
             _ambientSound.UnloadContent();
+
+            _characterArchetypes.Clear();
         }
 
         void BasicLevel::SetDefaultEnvironmenType(Audio::EnvironmentType type)
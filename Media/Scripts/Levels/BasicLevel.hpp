@@ -5,6 +5,21 @@
 #include "Geometry/Polygon.hpp"
 #include "MusicManager.hpp"
 #include "AmbientSoundManager.hpp"
+#include "Audio/ExtendedSoundEmitter.hpp"
+#include "Audio/SoundEventScheduler.hpp"
+#include "Drawables/FlameManager.hpp"
+#include "Drawables/LightCuller.hpp"
+#include "Drawables/ParticleEffectManager.hpp"
+#include "Characters/CharacterArchetype.hpp"
+#include "Buffs/StatusEffectManager.hpp"
+#include "Characters/TargetIndex.hpp"
+#include "Characters/ParallelCharacterUpdate.hpp"
+#include "Characters/DormancyManager.hpp"
+#include "Levels/TriggerVolumeManager.hpp"
+#include "Levels/PathGraphPatcher.hpp"
+#include "Levels/LevelMarkers.hpp"
+#include "Levels/SimulationBenchmark.hpp"
+#include "InputRecording.hpp"
 
 #include <string>
 
@@ -24,6 +39,24 @@ namespace Dwarf
 
             virtual void InitializeDebugger(HUD::Debugger* debugger);
 
+            Audio::SoundEmitterManager& GetSoundEmitterManager();
+            Audio::SoundEventScheduler& GetSoundEventScheduler();
+            Graphics::FlameManager& GetFlameManager();
+            Graphics::LightCuller& GetLightCuller();
+            Graphics::ParticleEffectManager& GetParticleEffectManager();
+            Character::CharacterArchetypeCache& GetCharacterArchetypeCache();
+            Character::StatusEffectManager& GetStatusEffectManager();
+            const Character::TargetIndex& GetTargetIndex() const;
+            TriggerVolumeManager& GetTriggerVolumeManager();
+            PathGraphPatcher& GetPathGraphPatcher();
+            Character::ParallelCharacterUpdate& GetParallelCharacterUpdate();
+            Character::DormancyManager& GetDormancyManager();
+            const LevelMarkers& GetMarkers() const;
+            Input::InputSession& GetInputSession();
+
+            void SetSimulationBenchmark(SimulationBenchmark* benchmark);
+            SimulationBenchmark* GetSimulationBenchmark() const;
+
         protected:
             virtual ~BasicLevel();
 
@@ -40,7 +73,11 @@ namespace Dwarf
 
             void OnCreate() override;
 
+            // Resolves the named markers the level scripts use, called at the start of OnCreate and validated after
+            virtual void OnResolveMarkers(LevelMarkers& markers);
+
             void OnUpdate(double totalTime, float dt) override;
+            void OnDraw(LevelLayerInstance* layer, Graphics::LevelRenderer* levelRenderer) const override;
 
             virtual void OnLoadContent(Content::ContentManager* contentManager) override;
             virtual void OnUnloadContent() override;
@@ -60,6 +97,21 @@ namespace Dwarf
         private:
             Audio::MusicManager _musicManager;
             Audio::AmbientSoundManager _ambientSound;
+            Audio::SoundEmitterManager _soundEmitters;
+            Audio::SoundEventScheduler _soundEvents;
+            Graphics::FlameManager _flameManager;
+            Graphics::LightCuller _lights;
+            Graphics::ParticleEffectManager _particleEffects;
+            Character::CharacterArchetypeCache _characterArchetypes;
+            Character::StatusEffectManager _statusEffects;
+            Character::TargetIndex _targetIndex;
+            Character::ParallelCharacterUpdate _characterUpdate;
+            Character::DormancyManager _dormancy;
+            TriggerVolumeManager _triggerVolumes;
+            PathGraphPatcher _pathGraph;
+            LevelMarkers _markers;
+            Input::InputSession _inputSession;
+            SimulationBenchmark* _benchmark;
         };
     }
 
@@ -9,6 +9,12 @@
 #include "Controllers/Player.hpp"
 #include "Controllers/MonsterController.hpp"
 #include "Controllers/WildlifeController.hpp"
+#include "Profiler.hpp"
+#include "FileSystem/FileSystem.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 
 namespace Dwarf
 {
@@ -190,6 +196,12 @@ namespace Dwarf
             return result;
         }
 
+        // Bridge build percentages are stored in 16 bits, fully built bridges stay exactly 1
+        static const float BridgeBuildPercentageScale = 65535.0f;
+
+        static const uint32_t CheckpointFileMagic = 0x50434344; // "DCCP"
+        static const uint32_t CheckpointFileVersion = 1;
+
         CampaignLevelCheckpoint::CampaignLevelCheckpoint()
         {
         }
@@ -220,52 +232,48 @@ namespace Dwarf
 
         bool CampaignLevelCheckpoint::WasCharacterKilled(LayerID layer, TriggerID spawnTrigger) const
         {
-            auto iter = _killedCharacters.find(layer);
-            if (iter == _killedCharacters.end())
-            {
-                return false;
-            }
-
-            return iter->second.count(spawnTrigger) > 0;
+            uint32_t killed = 0;
+            return GetStateValue(CheckpointEntryType_CharacterKilled, layer, spawnTrigger, killed) && killed != 0;
         }
 
         void CampaignLevelCheckpoint::SetCharacterKilled(LayerID layer, TriggerID spawnTrigger)
         {
-            _killedCharacters[layer].insert(spawnTrigger);
+            SetStateValue(CheckpointEntryType_CharacterKilled, layer, spawnTrigger, 1);
         }
 
         bool CampaignLevelCheckpoint::WasPlayerCharacterKilled(uint32_t idx) const
         {
-            return _killedPlayerCharacters.count(idx) > 0;
+            uint32_t killed = 0;
+            return GetStateValue(CheckpointEntryType_PlayerCharacterKilled, 0, idx, killed) && killed != 0;
         }
 
         bool CampaignLevelCheckpoint::ShouldFlameHolderBeOn(LayerID layer, TriggerID spawnTrigger) const
         {
-            auto layerIter = _flameHolderStates.find(layer);
-            assert(layerIter != _flameHolderStates.end());
-            auto flameHolderIter = layerIter->second.find(spawnTrigger);
-            assert(flameHolderIter != layerIter->second.end());
-            return flameHolderIter->second;
+            uint32_t on = 0;
+            bool found = GetStateValue(CheckpointEntryType_FlameHolderOn, layer, spawnTrigger, on);
+            assert(found);
+            return found && on != 0;
         }
 
         void CampaignLevelCheckpoint::SetFlameHolderOn(LayerID layer, TriggerID spawnTrigger, bool on)
         {
-            _flameHolderStates[layer][spawnTrigger] = on;
+            SetStateValue(CheckpointEntryType_FlameHolderOn, layer, spawnTrigger, on ? 1 : 0);
         }
 
         void CampaignLevelCheckpoint::SetPlayerCharacterKilled(uint32_t idx)
         {
-            _killedPlayerCharacters.insert(idx);
+            SetStateValue(CheckpointEntryType_PlayerCharacterKilled, 0, idx, 1);
         }
 
         bool CampaignLevelCheckpoint::WasCheckpointReached(uint32_t checkpoint) const
         {
-            return _reachedCheckpoints.count(checkpoint) > 0;
+            uint32_t reached = 0;
+            return GetStateValue(CheckpointEntryType_CheckpointReached, 0, checkpoint, reached) && reached != 0;
         }
 
         void CampaignLevelCheckpoint::SetCheckpointReached(uint32_t checkpoint)
         {
-            _reachedCheckpoints.insert(checkpoint);
+            SetStateValue(CheckpointEntryType_CheckpointReached, 0, checkpoint, 1);
         }
 
         const std::vector<std::pair<Vector2f, Vector2f>>& CampaignLevelCheckpoint::GetGrapplePositions(LayerID layer) const
@@ -289,16 +297,15 @@ namespace Dwarf
 
         float CampaignLevelCheckpoint::GetBridgeBuildPercentage(LayerID layer, SplineID spline) const
         {
-            auto layerIter = _bridges.find(layer);
-            assert(layerIter != _bridges.end());
-            auto splineIter = layerIter->second.find(spline);
-            assert(splineIter != layerIter->second.end());
-            return splineIter->second;
+            uint32_t buildPerc = 0;
+            bool found = GetStateValue(CheckpointEntryType_BridgeBuildPercentage, layer, spline, buildPerc);
+            assert(found);
+            return found ? buildPerc / BridgeBuildPercentageScale : 0.0f;
         }
 
         void CampaignLevelCheckpoint::SetBridgeBuildPercentage(LayerID layer, SplineID spline, float buildperc)
         {
-            _bridges[layer][spline] = buildperc;
+            SetStateValue(CheckpointEntryType_BridgeBuildPercentage, layer, spline, static_cast<uint32_t>(Saturate(buildperc) * BridgeBuildPercentageScale + 0.5f));
         }
 
         const std::vector<std::shared_ptr<CampaignLevelCheckpoint>>& CampaignLevelCheckpoint::GetCheckpointStates() const
@@ -321,17 +328,381 @@ namespace Dwarf
             _playedTriggeredSwells.insert(name);
         }
 
+        void CampaignLevelCheckpoint::SetPreviousCheckpoint(std::shared_ptr<const CampaignLevelCheckpoint> previous)
+        {
+            assert(_previous == nullptr);
+            if (previous == nullptr)
+            {
+                return;
+            }
+
+            _record = CheckpointRecord::Diff(previous->GetFullRecord(), _record);
+            _previous = previous;
+        }
+
+        std::shared_ptr<const CampaignLevelCheckpoint> CampaignLevelCheckpoint::GetPreviousCheckpoint() const
+        {
+            return _previous;
+        }
+
+        CheckpointRecord CampaignLevelCheckpoint::GetFullRecord() const
+        {
+            return _previous ? CheckpointRecord::Apply(_previous->GetFullRecord(), _record) : _record;
+        }
+
+        void CampaignLevelCheckpoint::Serialize(std::vector<uint8_t>& output) const
+        {
+            WriteVarInt(output, _nameCode.size());
+            output.insert(output.end(), _nameCode.begin(), _nameCode.end());
+
+            auto writeFloat = [&](float value)
+            {
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+                output.insert(output.end(), bytes, bytes + sizeof(float));
+            };
+
+            const auto& spawnPoints = _spawnArea.Points();
+            WriteVarInt(output, spawnPoints.size());
+            for (const Vector2f& point : spawnPoints)
+            {
+                writeFloat(point.X);
+                writeFloat(point.Y);
+            }
+
+            WriteVarInt(output, _grapples.size());
+            for (const auto& layerGrapples : _grapples)
+            {
+                WriteVarInt(output, layerGrapples.first);
+                WriteVarInt(output, layerGrapples.second.size());
+                for (const auto& grapple : layerGrapples.second)
+                {
+                    writeFloat(grapple.first.X);
+                    writeFloat(grapple.first.Y);
+                    writeFloat(grapple.second.X);
+                    writeFloat(grapple.second.Y);
+                }
+            }
+
+            WriteVarInt(output, _playedTriggeredSwells.size());
+            for (const auto& swell : _playedTriggeredSwells)
+            {
+                WriteVarInt(output, swell.size());
+                output.insert(output.end(), swell.begin(), swell.end());
+            }
+
+            _record.Serialize(output);
+        }
+
+        bool CampaignLevelCheckpoint::Deserialize(const uint8_t*& data, const uint8_t* end)
+        {
+            auto readString = [&](std::string& value)
+            {
+                uint64_t length = 0;
+                if (!ReadVarInt(data, end, length) || length > static_cast<uint64_t>(end - data))
+                {
+                    return false;
+                }
+                value.assign(reinterpret_cast<const char*>(data), static_cast<size_t>(length));
+                data += length;
+                return true;
+            };
+
+            auto readFloat = [&](float& value)
+            {
+                if (end - data < static_cast<ptrdiff_t>(sizeof(float)))
+                {
+                    return false;
+                }
+                std::copy(data, data + sizeof(float), reinterpret_cast<uint8_t*>(&value));
+                data += sizeof(float);
+                return true;
+            };
+
+            if (!readString(_nameCode))
+            {
+                return false;
+            }
+
+            uint64_t spawnPointCount = 0;
+            if (!ReadVarInt(data, end, spawnPointCount))
+            {
+                return false;
+            }
+            _spawnArea = Splinef();
+            for (uint64_t i = 0; i < spawnPointCount; i++)
+            {
+                Vector2f point;
+                if (!readFloat(point.X) || !readFloat(point.Y))
+                {
+                    return false;
+                }
+                _spawnArea.AddPoint(point);
+            }
+
+            uint64_t grappleLayerCount = 0;
+            if (!ReadVarInt(data, end, grappleLayerCount))
+            {
+                return false;
+            }
+            _grapples.clear();
+            for (uint64_t i = 0; i < grappleLayerCount; i++)
+            {
+                uint64_t layer = 0;
+                uint64_t grappleCount = 0;
+                if (!ReadVarInt(data, end, layer) || !ReadVarInt(data, end, grappleCount))
+                {
+                    return false;
+                }
+                for (uint64_t j = 0; j < grappleCount; j++)
+                {
+                    Vector2f a;
+                    Vector2f b;
+                    if (!readFloat(a.X) || !readFloat(a.Y) || !readFloat(b.X) || !readFloat(b.Y))
+                    {
+                        return false;
+                    }
+                    AddGrapplePosition(static_cast<LayerID>(layer), a, b);
+                }
+            }
+
+            uint64_t swellCount = 0;
+            if (!ReadVarInt(data, end, swellCount))
+            {
+                return false;
+            }
+            _playedTriggeredSwells.clear();
+            for (uint64_t i = 0; i < swellCount; i++)
+            {
+                std::string swell;
+                if (!readString(swell))
+                {
+                    return false;
+                }
+                _playedTriggeredSwells.insert(swell);
+            }
+
+            return _record.Deserialize(data, end);
+        }
+
+        bool CampaignLevelCheckpoint::GetStateValue(uint8_t type, uint32_t layer, uint32_t id, uint32_t& value) const
+        {
+            const CheckpointRecord::Key key = CheckpointRecord::MakeKey(type, layer, id);
+            for (const CampaignLevelCheckpoint* checkpoint = this; checkpoint != nullptr; checkpoint = checkpoint->_previous.get())
+            {
+                if (checkpoint->_record.Get(key, value))
+                {
+                    return true;
+                }
+                if (checkpoint->_record.IsRemoved(key))
+                {
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        void CampaignLevelCheckpoint::SetStateValue(uint8_t type, uint32_t layer, uint32_t id, uint32_t value)
+        {
+            _record.Set(CheckpointRecord::MakeKey(type, layer, id), value);
+        }
+
+        bool CampaignLevelCheckpoint::GetLevelFlag(uint32_t flag, bool defaultValue) const
+        {
+            uint32_t value = 0;
+            return GetStateValue(CheckpointEntryType_LevelFlag, 0, flag, value) ? value != 0 : defaultValue;
+        }
+
+        void CampaignLevelCheckpoint::SetLevelFlag(uint32_t flag, bool value)
+        {
+            SetStateValue(CheckpointEntryType_LevelFlag, 0, flag, value ? 1 : 0);
+        }
+
+        template <typename T>
+        static void writeValue(std::ofstream& stream, const T& value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        static bool readValue(std::ifstream& stream, T& value)
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        bool SaveCheckpoints(const std::string& path, const std::vector<std::shared_ptr<CampaignLevelCheckpoint>>& checkpoints)
+        {
+            std::vector<uint8_t> data;
+            WriteVarInt(data, checkpoints.size());
+            for (const auto& checkpoint : checkpoints)
+            {
+                if (checkpoint == nullptr)
+                {
+                    WriteVarInt(data, 0);
+                    continue;
+                }
+
+                // Index of the previous checkpoint plus one, zero when the checkpoint holds its full state
+                uint64_t previousIdx = 0;
+                std::shared_ptr<const CampaignLevelCheckpoint> previous = checkpoint->GetPreviousCheckpoint();
+                if (previous)
+                {
+                    auto previousIter = std::find(checkpoints.begin(), checkpoints.end(), previous);
+                    if (previousIter == checkpoints.end())
+                    {
+                        LogError("CampaignLevel", Format("Checkpoint %s was captured after a checkpoint that is not saved.", checkpoint->GetNameCode().c_str()));
+                        return false;
+                    }
+                    previousIdx = (previousIter - checkpoints.begin()) + 1;
+                }
+
+                WriteVarInt(data, 1);
+                WriteVarInt(data, previousIdx);
+                checkpoint->Serialize(data);
+            }
+
+            std::ofstream stream(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!stream)
+            {
+                LogError("CampaignLevel", Format("Failed to open %s for writing the checkpoints.", path.c_str()));
+                return false;
+            }
+
+            writeValue(stream, CheckpointFileMagic);
+            writeValue(stream, CheckpointFileVersion);
+            writeValue(stream, static_cast<uint32_t>(data.size()));
+            stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+            if (!stream)
+            {
+                LogError("CampaignLevel", Format("Failed to write the checkpoints to %s.", path.c_str()));
+                return false;
+            }
+
+            return true;
+        }
+
+        bool LoadCheckpoints(const std::string& path, std::function<std::shared_ptr<CampaignLevelCheckpoint>()> createCheckpoint,
+                             std::vector<std::shared_ptr<CampaignLevelCheckpoint>>& checkpoints)
+        {
+            checkpoints.clear();
+
+            std::ifstream stream(path.c_str(), std::ios::in | std::ios::binary);
+            if (!stream)
+            {
+                return false;
+            }
+
+            uint32_t magic = 0, version = 0, size = 0;
+            if (!readValue(stream, magic) || magic != CheckpointFileMagic ||
+                !readValue(stream, version) || version != CheckpointFileVersion ||
+                !readValue(stream, size))
+            {
+                LogError("CampaignLevel", Format("%s is not a supported checkpoint file.", path.c_str()));
+                return false;
+            }
+
+            std::vector<uint8_t> data(size);
+            if (size > 0 && !stream.read(reinterpret_cast<char*>(data.data()), size))
+            {
+                LogError("CampaignLevel", Format("%s is truncated.", path.c_str()));
+                return false;
+            }
+
+            const uint8_t* cur = data.data();
+            const uint8_t* end = cur + data.size();
+
+            uint64_t checkpointCount = 0;
+            bool valid = ReadVarInt(cur, end, checkpointCount) && checkpointCount <= data.size();
+
+            std::vector<uint64_t> previousIndices;
+            for (uint64_t i = 0; valid && i < checkpointCount; i++)
+            {
+                uint64_t present = 0;
+                valid = ReadVarInt(cur, end, present);
+                if (!valid || present == 0)
+                {
+                    checkpoints.push_back(nullptr);
+                    previousIndices.push_back(0);
+                    continue;
+                }
+
+                uint64_t previousIdx = 0;
+                std::shared_ptr<CampaignLevelCheckpoint> checkpoint = createCheckpoint();
+                valid = ReadVarInt(cur, end, previousIdx) && previousIdx <= checkpointCount && checkpoint->Deserialize(cur, end);
+
+                checkpoints.push_back(checkpoint);
+                previousIndices.push_back(previousIdx);
+            }
+
+            // Checkpoints can be captured out of order, they are linked once all of them are read
+            for (uint32_t i = 0; valid && i < checkpoints.size(); i++)
+            {
+                if (checkpoints[i] != nullptr && previousIndices[i] > 0)
+                {
+                    const auto& previous = checkpoints[previousIndices[i] - 1];
+                    valid = previous != nullptr && previous != checkpoints[i];
+                    if (valid)
+                    {
+                        checkpoints[i]->_previous = previous;
+                    }
+                }
+            }
+
+            // A corrupt file could link the checkpoints in a loop, every chain has to end within the checkpoint count
+            for (uint32_t i = 0; valid && i < checkpoints.size(); i++)
+            {
+                uint32_t chainLength = 0;
+                for (const CampaignLevelCheckpoint* checkpoint = checkpoints[i].get(); checkpoint != nullptr; checkpoint = checkpoint->_previous.get())
+                {
+                    if (++chainLength > checkpoints.size())
+                    {
+                        valid = false;
+                        break;
+                    }
+                }
+            }
+
+            if (!valid)
+            {
+                LogError("CampaignLevel", Format("%s holds corrupt checkpoints.", path.c_str()));
+                for (const auto& checkpoint : checkpoints)
+                {
+                    if (checkpoint != nullptr)
+                    {
+                        checkpoint->_previous = nullptr;
+                    }
+                }
+                checkpoints.clear();
+                return false;
+            }
+
+            return true;
+        }
+
+        std::string GetCheckpointSavePath(uint32_t campaignID, const std::string& levelNameCode)
+        {
+            return Format("%s/%s/checkpoints_%08x_%s.bin", FileSystem::GetHomePath().c_str(), "Dwarf", campaignID, levelNameCode.c_str());
+        }
+
         CampaignLevel::CampaignLevel(const LevelParameters& parameters, const CampaignLevelParameters& campaignParameters)
             : BasicLevel(parameters)
             , _campaignParameters(campaignParameters)
             , _playerController(nullptr)
             , _monsterController(nullptr)
             , _wildlifeController(nullptr)
+            , _lastCheckpointState(campaignParameters.Checkpoint)
+            , _unsavedCheckpoints(false)
         {
         }
 
         CampaignLevel::~CampaignLevel()
         {
+            // Written once as the level is left rather than on every capture, the file is only read to resume the level
+            // after the game was closed
+            if (_unsavedCheckpoints)
+            {
+                saveCheckpoints();
+            }
         }
 
         void CampaignLevel::AddMusicTracks(const Audio::MusicTrackMap& tracks)
@@ -340,7 +711,7 @@ namespace Dwarf
             for (const auto& track : tracks)
             {
                 musicManager.AddTrack(track.first, track.second);
-                _musicTrackAreas.push_back(track.first);
+                _musicTrackAreas.push_back(std::make_pair(track.first, InvalidTriggerVolumeHandle));
             }
         }
 
@@ -352,10 +723,34 @@ namespace Dwarf
             }
             else
             {
-                _triggeredMusicSwells[triggerName].push_back(swellName);
+                std::vector<std::string>& swells = _triggeredMusicSwells[triggerName];
+                if (swells.empty())
+                {
+                    TriggerVolumeParameters volumeParameters;
+                    volumeParameters.Areas = GetPrimaryLayer()->GetTriggerAreas(triggerName);
+                    volumeParameters.TestPoint = TriggerVolumeTestPoint_Position;
+                    volumeParameters.Filter = std::bind(&CampaignLevel::isPlayerCharacter, this, std::placeholders::_1);
+                    volumeParameters.OnEnter = [this, triggerName](TriggerVolumeHandle volume, Character::CharacterID)
+                    {
+                        for (const auto& swell : _triggeredMusicSwells[triggerName])
+                        {
+                            PlayMusicSwell(swell);
+                        }
+                        _playedTriggeredMusicSwells.insert(triggerName);
+                        _triggeredMusicSwells.erase(triggerName);
+                        GetTriggerVolumeManager().RemoveVolume(volume);
+                    };
+                    GetTriggerVolumeManager().AddVolume(GetPrimaryLayer(), volumeParameters);
+                }
+                swells.push_back(swellName);
             }
         }
 
+        bool CampaignLevel::isPlayerCharacter(const Character::Character* character) const
+        {
+            return character->GetController() == _playerController;
+        }
+
         void CampaignLevel::OnCreate()
         {
             BasicLevel::OnCreate();
@@ -420,13 +815,31 @@ namespace Dwarf
             _monsterController = CreateController("monster_controller", Character::BindControllerConstructor<Character::MonsterController>());
             _wildlifeController = CreateController("wildlife_controller", Character::BindControllerConstructor<Character::WildlifeController>());
 
+            TriggerVolumeManager& triggerVolumes = GetTriggerVolumeManager();
+            for (auto& musicTrackArea : _musicTrackAreas)
+            {
+                TriggerVolumeParameters volumeParameters;
+                volumeParameters.Areas = GetPrimaryLayer()->GetTriggerAreas(musicTrackArea.first);
+                volumeParameters.TestPoint = TriggerVolumeTestPoint_Position;
+                volumeParameters.Filter = std::bind(&CampaignLevel::isPlayerCharacter, this, std::placeholders::_1);
+                musicTrackArea.second = triggerVolumes.AddVolume(GetPrimaryLayer(), volumeParameters);
+            }
+
             for (uint32_t i = 0; i < GetLayerCount(); i++)
             {
                 auto layer = GetLayer(i);
                 assert(layer->GetID() == i);
                 for (const auto& aggroZone : layer->GetTriggerAreas("aggro_zone"))
                 {
-                    _aggroZones[layer->GetID()].push_back(aggroZone);
+                    TriggerVolumeParameters volumeParameters;
+                    volumeParameters.Areas.push_back(aggroZone);
+                    volumeParameters.TestPoint = TriggerVolumeTestPoint_Position;
+                    volumeParameters.Filter = std::bind(&CampaignLevel::isPlayerCharacter, this, std::placeholders::_1);
+                    volumeParameters.OnEnter = [this, layer, aggroZone](TriggerVolumeHandle volume, Character::CharacterID)
+                    {
+                        onAggroZoneEntered(volume, layer, aggroZone);
+                    };
+                    triggerVolumes.AddVolume(layer, volumeParameters);
                 }
             }
 
@@ -436,95 +849,58 @@ namespace Dwarf
             SetDiscoveryEnabled(true);
         }
 
-        static std::vector<Character::Character*> GetCharactersInPolygons(const Character::Controller* controller, const std::vector<Polygonf>& polygons)
+        void CampaignLevel::onAggroZoneEntered(TriggerVolumeHandle volume, LevelLayerInstance* layer, const Polygonf& area)
         {
-            assert(!polygons.empty());
-            return controller->GetCharacters<Character::Character>([&polygons](const Character::Character* character)
+            TriggerVolumeManager& triggerVolumes = GetTriggerVolumeManager();
+
+            // Every player character that entered the zone this update is an occupant, sort them so the random pick
+            // does not depend on hashing order
+            std::vector<Character::CharacterID> charactersInZone(triggerVolumes.GetOccupants(volume).begin(), triggerVolumes.GetOccupants(volume).end());
+            std::sort(charactersInZone.begin(), charactersInZone.end());
+            triggerVolumes.RemoveVolume(volume);
+
+            if (charactersInZone.empty())
             {
-                for (const auto& poly : polygons)
-                {
-                    if (Polygonf::Contains(poly, character->GetPosition()))
-                    {
-                        return true;
-                    }
-                }
+                return;
+            }
 
-                return false;
+            std::vector<Character::Character*> monstersInZone = _monsterController->GetCharacters<Character::Character>([&](const Character::Character* character)
+            {
+                return character->GetLevelLayer() == layer && Polygonf::Contains(area, character->GetPosition());
             });
+
+            Character::Action action = Character::CreateWeakAttackAction(Random::RandomItem(charactersInZone));
+            for (auto monster : monstersInZone)
+            {
+                if (monster->GetCurrentState() == Character::CharacterState_Idle)
+                {
+                    monster->PushAction(action, false);
+                }
+            }
         }
 
         void CampaignLevel::OnUpdate(double totalTime, float dt)
         {
-            const LevelLayerInstance* primaryLayer = GetPrimaryLayer();
+            PROFILE_ZONE("CampaignLevel::OnUpdate");
+
+            LevelLayerInstance* primaryLayer = GetPrimaryLayer();
 
             const Vector2f& camPos = primaryLayer->GetCamera().GetPosition();
             Audio::MusicManager& musicManager = GetMusicManager();
+            const TriggerVolumeManager& triggerVolumes = GetTriggerVolumeManager();
             for (const auto& musicTrackArea : _musicTrackAreas)
             {
-                std::vector<Character::Character*> characters = GetCharactersInPolygons(_playerController, primaryLayer->GetTriggerAreas(musicTrackArea));
                 float minDistSq = std::numeric_limits<float>::max();
-                for (const auto& character : characters)
-                {
-                    minDistSq = Min(minDistSq, Vector2f::DistanceSquared(camPos, character->GetPosition()));
-                }
-
-                musicManager.SetTrackWeightings(musicTrackArea, Sqrt(minDistSq));
-            }
-
-            auto triggeredMusicSwellIter = _triggeredMusicSwells.begin();
-            while (triggeredMusicSwellIter != _triggeredMusicSwells.end())
-            {
-                const auto& triggerName = triggeredMusicSwellIter->first;
-                std::vector<Character::Character*> characters = GetCharactersInPolygons(_playerController, primaryLayer->GetTriggerAreas(triggerName));
-                if (!characters.empty())
+                for (auto occupant : triggerVolumes.GetOccupants(musicTrackArea.second))
                 {
-                    for (const auto& swell : triggeredMusicSwellIter->second)
+                    const Character::Character* character = primaryLayer->GetCharacter(occupant);
+                    if (character)
                     {
-                        PlayMusicSwell(swell);
+                        minDistSq = Min(minDistSq, Vector2f::DistanceSquared(camPos, character->GetPosition()));
                     }
-                    _playedTriggeredMusicSwells.insert(triggerName);
-                    triggeredMusicSwellIter = _triggeredMusicSwells.erase(triggeredMusicSwellIter);
                 }
-                else
-                {
-                    triggeredMusicSwellIter++;
-                }
-            }
-
-            for (auto& aggroZoneLayer : _aggroZones)
-            {
-                auto layer = GetLayer(aggroZoneLayer.first);
-
-                auto iter = aggroZoneLayer.second.begin();
-                while (iter != aggroZoneLayer.second.end())
-                {
-                    const Polygonf& area = *iter;
-
-                    CharacterFilterFunction<Character::Character> filterFunc = [&](const Character::Character* character)
-                    {
-                        return character->GetLevelLayer() == layer && Polygonf::Contains(area, character->GetPosition());
-                    };
-
-                    std::vector<Character::Character*> charactersInZone = _playerController->GetCharacters(filterFunc);
-                    if (!charactersInZone.empty())
-                    {
-                        std::vector<Character::Character*> monstersInZone = _monsterController->GetCharacters(filterFunc);
-                        Character::Action action = Character::CreateWeakAttackAction(Random::RandomItem(charactersInZone)->GetID());
-                        for (auto monster : monstersInZone)
-                        {
-                            if (monster->GetCurrentState() == Character::CharacterState_Idle)
-                            {
-                                monster->PushAction(action, false);
-                            }
-                        }
 
-                        iter = aggroZoneLayer.second.erase(iter);
-                    }
-                    else
-                    {
-                        iter++;
-                    }
-                }
+                musicManager.SetTrackWeightings(musicTrackArea.first, Sqrt(minDistSq));
             }
 
             BasicLevel::OnUpdate(totalTime, dt);
@@ -569,6 +945,13 @@ namespace Dwarf
 
                 _campaignParameters.SaveProfile();
 
+                // A completed level is started over from the loadout, its checkpoints are not needed anymore
+                _unsavedCheckpoints = false;
+                if (!_campaignParameters.CheckpointSavePath.empty())
+                {
+                    std::remove(_campaignParameters.CheckpointSavePath.c_str());
+                }
+
                 _playerController->OnLevelVictory();
             }
             else
@@ -746,6 +1129,14 @@ namespace Dwarf
             _campaignParameters.CheckpointFunction(_checkpointStates[checkpoint]);
         }
 
+        void CampaignLevel::saveCheckpoints() const
+        {
+            if (!_campaignParameters.CheckpointSavePath.empty())
+            {
+                SaveCheckpoints(_campaignParameters.CheckpointSavePath, _checkpointStates);
+            }
+        }
+
         void CampaignLevel::RestartAtLoadout()
         {
             _campaignParameters.LoadoutFunction();
@@ -6,6 +6,7 @@
 #include "Items/GameItems.hpp"
 #include "Abilities/GameAbilities.hpp"
 #include "Characters/GameCharacters.hpp"
+#include "Levels/CheckpointRecord.hpp"
 
 #include <typeindex>
 #include <map>
@@ -96,18 +97,45 @@ namespace Dwarf
             bool WasTriggeredSwellPlayed(const std::string& name) const;
             void SetTriggeredSwellPlayed(const std::string& name);
 
+            // Stores only what changed since the previous checkpoint, anything else is looked up in the previous one.
+            // Called once the checkpoint is fully populated.
+            void SetPreviousCheckpoint(std::shared_ptr<const CampaignLevelCheckpoint> previous);
+            std::shared_ptr<const CampaignLevelCheckpoint> GetPreviousCheckpoint() const;
+
+            // The full state, with the deltas of the previous checkpoints applied
+            CheckpointRecord GetFullRecord() const;
+
+            void Serialize(std::vector<uint8_t>& output) const;
+            bool Deserialize(const uint8_t*& data, const uint8_t* end);
+
+        protected:
+            bool GetStateValue(uint8_t type, uint32_t layer, uint32_t id, uint32_t& value) const;
+            void SetStateValue(uint8_t type, uint32_t layer, uint32_t id, uint32_t value);
+
+            bool GetLevelFlag(uint32_t flag, bool defaultValue) const;
+            void SetLevelFlag(uint32_t flag, bool value);
+
         private:
+            friend bool LoadCheckpoints(const std::string& path, std::function<std::shared_ptr<CampaignLevelCheckpoint>()> createCheckpoint,
+                                        std::vector<std::shared_ptr<CampaignLevelCheckpoint>>& checkpoints);
+
             Splinef _spawnArea;
             std::string _nameCode;
-            std::unordered_map<LayerID, std::unordered_set<TriggerID>> _killedCharacters;
-            std::unordered_map<LayerID, std::unordered_map<TriggerID, bool>> _flameHolderStates;
-            std::unordered_set<uint32_t> _killedPlayerCharacters;
-            std::unordered_set<uint32_t> _reachedCheckpoints;
+            CheckpointRecord _record;
+            std::shared_ptr<const CampaignLevelCheckpoint> _previous;
             std::unordered_map<LayerID, std::vector<std::pair<Vector2f, Vector2f>>> _grapples;
-            std::unordered_map<LayerID, std::unordered_map<SplineID, float>> _bridges;
             std::vector<std::shared_ptr<CampaignLevelCheckpoint>> _checkpoints;
             std::unordered_set<std::string> _playedTriggeredSwells;
         };
+
+        // Writes the checkpoints of a level, each as the delta to the checkpoint it was captured after, so that the level
+        // can be resumed from them after the game was closed. Checkpoints that were not reached are left out.
+        bool SaveCheckpoints(const std::string& path, const std::vector<std::shared_ptr<CampaignLevelCheckpoint>>& checkpoints);
+        bool LoadCheckpoints(const std::string& path, std::function<std::shared_ptr<CampaignLevelCheckpoint>()> createCheckpoint,
+                             std::vector<std::shared_ptr<CampaignLevelCheckpoint>>& checkpoints);
+
+        // Checkpoints of a level, per campaign so that profiles don't overwrite each other's
+        std::string GetCheckpointSavePath(uint32_t campaignID, const std::string& levelNameCode);
     }
 
     typedef std::function<void(std::shared_ptr<const Level::CampaignLevelCheckpoint>)> RestartAtCheckpointFunction;
@@ -122,6 +150,9 @@ namespace Dwarf
 
             std::shared_ptr<const CampaignLevelCheckpoint> Checkpoint;
 
+            // File the reached checkpoints are saved to when the level is left unfinished, empty when they are not saved
+            std::string CheckpointSavePath;
+
             ExitGameFunction ExitFunction;
             TransitionToCampaignMenuFunction MenuFunction;
             RestartAtCheckpointFunction CheckpointFunction;
@@ -196,6 +227,10 @@ namespace Dwarf
             virtual void PopulateCheckpoint(std::shared_ptr<CampaignLevelCheckpoint> checkpoint);
 
         private:
+            bool isPlayerCharacter(const Character::Character* character) const;
+            void saveCheckpoints() const;
+            void onAggroZoneEntered(TriggerVolumeHandle volume, LevelLayerInstance* layer, const Polygonf& area);
+
             CampaignLevelParameters _campaignParameters;
 
             Character::Player* _playerController;
@@ -208,13 +243,13 @@ namespace Dwarf
             std::unordered_map<uint32_t, Character::CharacterID> _playerCharacters;
 
             std::vector<std::shared_ptr<CampaignLevelCheckpoint>> _checkpointStates;
+            std::shared_ptr<const CampaignLevelCheckpoint> _lastCheckpointState;
+            bool _unsavedCheckpoints;
 
-            std::vector<std::string> _musicTrackAreas;
+            std::vector<std::pair<std::string, TriggerVolumeHandle>> _musicTrackAreas;
 
             std::map<std::string, std::vector<std::string>> _triggeredMusicSwells;
             std::unordered_set<std::string> _playedTriggeredMusicSwells;
-
-            std::unordered_map<LayerID, std::list<Polygonf>> _aggroZones;
         };
     }
 
@@ -52,7 +52,10 @@ namespace Dwarf
                 state->SetCharacterSpawnArea(position);
                 state->SetNameCode(name);
                 PopulateCheckpoint(state);
+                state->SetPreviousCheckpoint(_lastCheckpointState);
                 _checkpointStates[checkpointIdx] = state;
+                _lastCheckpointState = state;
+                _unsavedCheckpoints = true;
             };
 
             bool alreadyCaptured = newCheckpoint != nullptr;
@@ -0,0 +1,255 @@
+#include "Levels/CheckpointRecord.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        CheckpointRecord::Key CheckpointRecord::MakeKey(uint8_t type, uint32_t layer, uint32_t id)
+        {
+            assert(layer < (1u << 24));
+            return (static_cast<Key>(type) << 56) | (static_cast<Key>(layer & 0xFFFFFF) << 32) | id;
+        }
+
+        CheckpointRecord::CheckpointRecord()
+            : _entries()
+            , _removed()
+        {
+        }
+
+        bool CheckpointRecord::Get(Key key, uint32_t& value) const
+        {
+            auto iter = find(key);
+            if (iter == _entries.end())
+            {
+                return false;
+            }
+
+            value = iter->value;
+            return true;
+        }
+
+        void CheckpointRecord::Set(Key key, uint32_t value)
+        {
+            auto removedIter = std::lower_bound(_removed.begin(), _removed.end(), key);
+            if (removedIter != _removed.end() && *removedIter == key)
+            {
+                _removed.erase(removedIter);
+            }
+
+            auto iter = std::lower_bound(_entries.begin(), _entries.end(), key, [](const entry& a, Key b) { return a.key < b; });
+            if (iter != _entries.end() && iter->key == key)
+            {
+                iter->value = value;
+            }
+            else
+            {
+                entry newEntry;
+                newEntry.key = key;
+                newEntry.value = value;
+                _entries.insert(iter, newEntry);
+            }
+        }
+
+        bool CheckpointRecord::IsRemoved(Key key) const
+        {
+            return std::binary_search(_removed.begin(), _removed.end(), key);
+        }
+
+        uint32_t CheckpointRecord::GetEntryCount() const
+        {
+            return static_cast<uint32_t>(_entries.size());
+        }
+
+        uint32_t CheckpointRecord::GetRemovedCount() const
+        {
+            return static_cast<uint32_t>(_removed.size());
+        }
+
+        CheckpointRecord CheckpointRecord::Diff(const CheckpointRecord& base, const CheckpointRecord& target)
+        {
+            assert(base._removed.empty() && target._removed.empty());
+
+            // Both sides are sorted, a single merge pass finds every difference
+            CheckpointRecord delta;
+            auto baseIter = base._entries.begin();
+            auto targetIter = target._entries.begin();
+            while (baseIter != base._entries.end() || targetIter != target._entries.end())
+            {
+                if (targetIter == target._entries.end() || (baseIter != base._entries.end() && baseIter->key < targetIter->key))
+                {
+                    delta._removed.push_back(baseIter->key);
+                    baseIter++;
+                }
+                else if (baseIter == base._entries.end() || targetIter->key < baseIter->key)
+                {
+                    delta._entries.push_back(*targetIter);
+                    targetIter++;
+                }
+                else
+                {
+                    if (baseIter->value != targetIter->value)
+                    {
+                        delta._entries.push_back(*targetIter);
+                    }
+                    baseIter++;
+                    targetIter++;
+                }
+            }
+
+            return delta;
+        }
+
+        CheckpointRecord CheckpointRecord::Apply(const CheckpointRecord& base, const CheckpointRecord& delta)
+        {
+            assert(base._removed.empty());
+
+            CheckpointRecord result;
+            result._entries.reserve(base._entries.size() + delta._entries.size());
+
+            auto baseIter = base._entries.begin();
+            auto deltaIter = delta._entries.begin();
+            while (baseIter != base._entries.end() || deltaIter != delta._entries.end())
+            {
+                if (deltaIter == delta._entries.end() || (baseIter != base._entries.end() && baseIter->key < deltaIter->key))
+                {
+                    if (!delta.IsRemoved(baseIter->key))
+                    {
+                        result._entries.push_back(*baseIter);
+                    }
+                    baseIter++;
+                }
+                else
+                {
+                    if (baseIter != base._entries.end() && baseIter->key == deltaIter->key)
+                    {
+                        baseIter++;
+                    }
+                    result._entries.push_back(*deltaIter);
+                    deltaIter++;
+                }
+            }
+
+            return result;
+        }
+
+        void CheckpointRecord::Serialize(std::vector<uint8_t>& output) const
+        {
+            WriteVarInt(output, _entries.size());
+            Key previousKey = 0;
+            for (const entry& curEntry : _entries)
+            {
+                WriteVarInt(output, curEntry.key - previousKey);
+                WriteVarInt(output, curEntry.value);
+                previousKey = curEntry.key;
+            }
+
+            WriteVarInt(output, _removed.size());
+            previousKey = 0;
+            for (Key key : _removed)
+            {
+                WriteVarInt(output, key - previousKey);
+                previousKey = key;
+            }
+        }
+
+        // Keys are written in increasing order, a delta of zero after the first key or one that wraps around can only come
+        // from a corrupt record and would break the sorted lookups
+        static bool readKey(const uint8_t*& data, const uint8_t* end, bool first, CheckpointRecord::Key previousKey, CheckpointRecord::Key& key)
+        {
+            uint64_t keyDelta = 0;
+            if (!ReadVarInt(data, end, keyDelta) || (!first && keyDelta == 0) || keyDelta > UINT64_MAX - previousKey)
+            {
+                return false;
+            }
+
+            key = previousKey + keyDelta;
+            return true;
+        }
+
+        bool CheckpointRecord::Deserialize(const uint8_t*& data, const uint8_t* end)
+        {
+            _entries.clear();
+            _removed.clear();
+
+            uint64_t entryCount = 0;
+            if (!ReadVarInt(data, end, entryCount) || entryCount > static_cast<uint64_t>(end - data))
+            {
+                return false;
+            }
+
+            _entries.resize(static_cast<size_t>(entryCount));
+            Key previousKey = 0;
+            for (size_t i = 0; i < _entries.size(); i++)
+            {
+                entry& curEntry = _entries[i];
+                uint64_t value = 0;
+                if (!readKey(data, end, i == 0, previousKey, curEntry.key) || !ReadVarInt(data, end, value) || value > UINT32_MAX)
+                {
+                    return false;
+                }
+
+                curEntry.value = static_cast<uint32_t>(value);
+                previousKey = curEntry.key;
+            }
+
+            uint64_t removedCount = 0;
+            if (!ReadVarInt(data, end, removedCount) || removedCount > static_cast<uint64_t>(end - data))
+            {
+                return false;
+            }
+
+            _removed.resize(static_cast<size_t>(removedCount));
+            previousKey = 0;
+            for (size_t i = 0; i < _removed.size(); i++)
+            {
+                if (!readKey(data, end, i == 0, previousKey, _removed[i]))
+                {
+                    return false;
+                }
+
+                previousKey = _removed[i];
+            }
+
+            return true;
+        }
+
+        std::vector<CheckpointRecord::entry>::const_iterator CheckpointRecord::find(Key key) const
+        {
+            auto iter = std::lower_bound(_entries.begin(), _entries.end(), key, [](const entry& a, Key b) { return a.key < b; });
+            return (iter != _entries.end() && iter->key == key) ? iter : _entries.end();
+        }
+
+        void WriteVarInt(std::vector<uint8_t>& output, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                output.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            output.push_back(static_cast<uint8_t>(value));
+        }
+
+        bool ReadVarInt(const uint8_t*& data, const uint8_t* end, uint64_t& value)
+        {
+            value = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7)
+            {
+                if (data == end)
+                {
+                    return false;
+                }
+
+                uint8_t byte = *data++;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        enum CheckpointEntryType : uint8_t
+        {
+            CheckpointEntryType_CharacterKilled,
+            CheckpointEntryType_FlameHolderOn,
+            CheckpointEntryType_PlayerCharacterKilled,
+            CheckpointEntryType_CheckpointReached,
+            CheckpointEntryType_BridgeBuildPercentage,
+            CheckpointEntryType_LevelFlag,
+
+            // Entry types of derived checkpoints start here
+            CheckpointEntryType_Derived = 64,
+        };
+
+        // Flat checkpoint state, one 32 bit value per key kept sorted by key. A record either holds the full state of a
+        // checkpoint or the delta to the record of an earlier checkpoint, in which case it only holds the entries that
+        // were added or changed and the keys that were removed. Serialized as variable length integers with each key
+        // written as the difference to the previous one, so that the runs of triggers of a layer take a byte or two each.
+        class CheckpointRecord
+        {
+        public:
+            typedef uint64_t Key;
+
+            // 8 bits of entry type, 24 bits of layer and 32 bits of trigger, spline or index
+            static Key MakeKey(uint8_t type, uint32_t layer, uint32_t id);
+
+            CheckpointRecord();
+
+            bool Get(Key key, uint32_t& value) const;
+            void Set(Key key, uint32_t value);
+
+            // Whether a delta record removes the key from the record it is applied to
+            bool IsRemoved(Key key) const;
+
+            uint32_t GetEntryCount() const;
+            uint32_t GetRemovedCount() const;
+
+            // The delta that turns base into target, and the other way around
+            static CheckpointRecord Diff(const CheckpointRecord& base, const CheckpointRecord& target);
+            static CheckpointRecord Apply(const CheckpointRecord& base, const CheckpointRecord& delta);
+
+            void Serialize(std::vector<uint8_t>& output) const;
+            bool Deserialize(const uint8_t*& data, const uint8_t* end);
+
+        private:
+            struct entry
+            {
+                Key key;
+                uint32_t value;
+            };
+
+            std::vector<entry>::const_iterator find(Key key) const;
+
+            std::vector<entry> _entries;
+            std::vector<Key> _removed;
+        };
+
+        void WriteVarInt(std::vector<uint8_t>& output, uint64_t value);
+        bool ReadVarInt(const uint8_t*& data, const uint8_t* end, uint64_t& value);
+    }
+}
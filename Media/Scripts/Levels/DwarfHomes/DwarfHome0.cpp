@@ -109,8 +109,12 @@ namespace Dwarf
             };
         };
 
+        enum dwarfHome0Flag : uint32_t
+        {
+            dwarfHome0Flag_FlareCutscenePlayed,
+        };
+
         DwarfHome0Checkpoint::DwarfHome0Checkpoint()
-            : _flareCutscenePlayed(false)
         {
         }
 
@@ -120,17 +124,19 @@ namespace Dwarf
 
         bool DwarfHome0Checkpoint::WasFlareCutscenePlayed() const
         {
-            return _flareCutscenePlayed;
+            return GetLevelFlag(dwarfHome0Flag_FlareCutscenePlayed, false);
         }
 
         void DwarfHome0Checkpoint::SetFlareCutscenePlayed(bool played)
         {
-            _flareCutscenePlayed = played;
+            SetLevelFlag(dwarfHome0Flag_FlareCutscenePlayed, played);
         }
 
         DwarfHome0::DwarfHome0(const LevelParameters& parameters, const CampaignLevelParameters& campaignParameters)
             : DwarfHomeLevel(parameters, campaignParameters)
             , _playedFlareCutscene(false)
+            , _flarePickupID(0)
+            , _flareCutsceneVolume(InvalidTriggerVolumeHandle)
         {
             AddMusicTracks(DwarfHome0MusicTracks);
             AddMusicSwells(DwarfHome0MusicSwells);
@@ -332,6 +338,7 @@ namespace Dwarf
                     _playedFlareCutscene = true;
                     giveNavigatorsShootFlare(GetPlayerController());
                     PlayCutscene(createFlareCutscene(GetPrimaryLayer(), character->GetID(), _flarePickupID, false));
+                    GetTriggerVolumeManager().RemoveVolume(_flareCutsceneVolume);
                 }
                 return true;
             });
@@ -339,6 +346,27 @@ namespace Dwarf
             Character::FlarePickup* flarePickup = primaryLayer->SpawnCharacter(flarePickupPos, "flare", nullptr, abilityPickupConstructor);
             _flarePickupID = flarePickup->GetID();
 
+            if (!_playedFlareCutscene)
+            {
+                TriggerVolumeParameters volumeParameters;
+                volumeParameters.Areas.push_back(primaryLayer->GetTriggerArea("flare_cutscene_start_area"));
+                volumeParameters.Filter = [this](const Character::Character* character)
+                {
+                    return IsA<Character::NavigatorDwarf>(character) && character->GetController() == GetPlayerController();
+                };
+                volumeParameters.OnEnter = [this](TriggerVolumeHandle volume, Character::CharacterID navigatorID)
+                {
+                    GetTriggerVolumeManager().RemoveVolume(volume);
+                    if (!_playedFlareCutscene)
+                    {
+                        _playedFlareCutscene = true;
+                        giveNavigatorsShootFlare(GetPlayerController());
+                        PlayCutscene(createFlareCutscene(GetPrimaryLayer(), navigatorID, _flarePickupID, true));
+                    }
+                };
+                _flareCutsceneVolume = GetTriggerVolumeManager().AddVolume(primaryLayer, volumeParameters);
+            }
+
             // Swells
             AddTrackedTriggeredMusicSwell("swell_first_monster", BadSwellName, checkpoint);
             AddTrackedTriggeredMusicSwell("swell_chest", GoodSwellName, checkpoint);
@@ -347,37 +375,11 @@ namespace Dwarf
             SpawnTrackedChest(primaryLayer, "storage_room_chest_spawn", false, StorageRoomItems(), checkpoint);
         }
 
-        void DwarfHome0::OnUpdate(double totalTime, float dt)
-        {
-            DwarfHomeLevel::OnUpdate(totalTime, dt);
-
-            if (!_playedFlareCutscene)
-            {
-                LevelLayerInstance* primaryLayer = GetPrimaryLayer();
-                const Polygonf& triggerPoly = primaryLayer->GetTriggerArea("flare_cutscene_start_area");
-
-                Character::Controller* playerController = GetPlayerController();
-
-                std::vector<Character::NavigatorDwarf*> charactersInShootFlareArea =
-                    playerController->GetCharacters<Character::NavigatorDwarf>([&](const Character::NavigatorDwarf* character)
-                {
-                    return Polygonf::Contains(triggerPoly, character->GetBounds().Middle());
-                });
-
-                if (!charactersInShootFlareArea.empty())
-                {
-                    _playedFlareCutscene = true;
-                    giveNavigatorsShootFlare(GetPlayerController());
-                    PlayCutscene(createFlareCutscene(primaryLayer, charactersInShootFlareArea[0]->GetID(), _flarePickupID, true));
-                }
-            }
-        }
-
         void DwarfHome0::OnSpawnCampaignCharacter(Character::Character* character)
         {
             DwarfHomeLevel::OnSpawnCampaignCharacter(character);
 
-            character->SetRotation(GetPrimaryLayer()->GetTriggerPosition("spawn_character_look_dir") - character->GetPosition());
+            character->SetRotation(GetSpawnCharacterLookTarget() - character->GetPosition());
         }
 
         void DwarfHome0::OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile)
@@ -14,9 +14,6 @@ namespace Dwarf
 
             bool WasFlareCutscenePlayed() const;
             void SetFlareCutscenePlayed(bool played);
-
-        private:
-            bool _flareCutscenePlayed;
         };
 
         class DwarfHome0 : public DwarfHomeLevel
@@ -30,7 +27,6 @@ namespace Dwarf
             virtual ~DwarfHome0();
 
             virtual void OnCreate() override;
-            virtual void OnUpdate(double totalTime, float dt) override;
 
             virtual void OnSpawnCampaignCharacter(Character::Character* character) override;
 
@@ -43,6 +39,7 @@ namespace Dwarf
 
             bool _playedFlareCutscene;
             Character::CharacterID _flarePickupID;
+            TriggerVolumeHandle _flareCutsceneVolume;
         };
     }
 
@@ -155,8 +155,12 @@ namespace Dwarf
             };
         };
 
+        enum dwarfHome1Flag : uint32_t
+        {
+            dwarfHome1Flag_GrapplePickedUp,
+        };
+
         DwarfHome1Checkpoint::DwarfHome1Checkpoint()
-            : _grapplePickedUp(false)
         {
         }
 
@@ -166,12 +170,12 @@ namespace Dwarf
 
         bool DwarfHome1Checkpoint::WasGrapplePickedUp() const
         {
-            return _grapplePickedUp;
+            return GetLevelFlag(dwarfHome1Flag_GrapplePickedUp, false);
         }
 
         void DwarfHome1Checkpoint::SetGrapplePickedUp(bool pickedUp)
         {
-            _grapplePickedUp = pickedUp;
+            SetLevelFlag(dwarfHome1Flag_GrapplePickedUp, pickedUp);
         }
 
         DwarfHome1::DwarfHome1(const LevelParameters& parameters, const CampaignLevelParameters& campaignParameters)
@@ -272,7 +276,7 @@ namespace Dwarf
         {
             DwarfHomeLevel::OnSpawnCampaignCharacter(character);
 
-            character->SetRotation(GetPrimaryLayer()->GetTriggerPosition("spawn_character_look_dir") - character->GetPosition());
+            character->SetRotation(GetSpawnCharacterLookTarget() - character->GetPosition());
         }
 
         void DwarfHome1::OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile)
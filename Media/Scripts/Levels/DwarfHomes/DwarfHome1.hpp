@@ -14,9 +14,6 @@ namespace Dwarf
 
             bool WasGrapplePickedUp() const;
             void SetGrapplePickedUp(bool pickedUp);
-
-        private:
-            bool _grapplePickedUp;
         };
 
         class DwarfHome1 : public DwarfHomeLevel
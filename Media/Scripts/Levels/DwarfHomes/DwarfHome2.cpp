@@ -186,10 +186,14 @@ namespace Dwarf
             };
         };
 
+        enum dwarfHome2Flag : uint32_t
+        {
+            dwarfHome2Flag_PlayedEatingCutscene,
+            dwarfHome2Flag_BossKilled,
+            dwarfHome2Flag_LeapPickedUp,
+        };
+
         DwarfHome2Checkpoint::DwarfHome2Checkpoint()
-            : _bossKilled(false)
-            , _leapPickedUp(false)
-            , _playedEatingCutscene(false)
         {
         }
 
@@ -199,32 +203,32 @@ namespace Dwarf
 
         bool DwarfHome2Checkpoint::DidPlayEatingCutscene() const
         {
-            return _playedEatingCutscene;
+            return GetLevelFlag(dwarfHome2Flag_PlayedEatingCutscene, false);
         }
 
         void DwarfHome2Checkpoint::SetPlayedEatingCutscene(bool played)
         {
-            _playedEatingCutscene = played;
+            SetLevelFlag(dwarfHome2Flag_PlayedEatingCutscene, played);
         }
 
         bool DwarfHome2Checkpoint::WasBossKilled() const
         {
-            return _bossKilled;
+            return GetLevelFlag(dwarfHome2Flag_BossKilled, false);
         }
 
         void DwarfHome2Checkpoint::SetBossKilled(bool killed)
         {
-            _bossKilled = killed;
+            SetLevelFlag(dwarfHome2Flag_BossKilled, killed);
         }
 
         bool DwarfHome2Checkpoint::WasLeapPickedUp() const
         {
-            return _leapPickedUp;
+            return GetLevelFlag(dwarfHome2Flag_LeapPickedUp, false);
         }
 
         void DwarfHome2Checkpoint::SetLeapPickedUp(bool pickedUp)
         {
-            _leapPickedUp = pickedUp;
+            SetLevelFlag(dwarfHome2Flag_LeapPickedUp, pickedUp);
         }
 
         DwarfHome2::DwarfHome2(const LevelParameters& parameters, const CampaignLevelParameters& campaignParameters)
@@ -785,6 +789,26 @@ namespace Dwarf
             assert(bossLadder.size() == 1);
             _bossLadderID = bossLadder[0];
 
+            if (!_playedBossCutscene)
+            {
+                TriggerVolumeParameters volumeParameters;
+                volumeParameters.Areas.push_back(primaryLayer->GetTriggerArea("boss_cutscene_start_area"));
+                volumeParameters.Filter = [this](const Character::Character* character)
+                {
+                    return character->GetController() == GetPlayerController();
+                };
+                volumeParameters.OnEnter = [this](TriggerVolumeHandle volume, Character::CharacterID)
+                {
+                    GetTriggerVolumeManager().RemoveVolume(volume);
+                    if (!_playedBossCutscene)
+                    {
+                        PlayCutscene(createBossEnterCutscene(GetPrimaryLayer(), GetPlayerController(), _bossID, _bossLadderID, _bossBrazierID));
+                        _playedBossCutscene = true;
+                    }
+                };
+                GetTriggerVolumeManager().AddVolume(primaryLayer, volumeParameters);
+            }
+
             // Spawn orks
             std::vector<Item::ItemConstructor<>> orkWeaps
             {
@@ -844,26 +868,6 @@ namespace Dwarf
         {
             DwarfHomeLevel::OnUpdate(totalTime, dt);
 
-            if (!_playedBossCutscene)
-            {
-                LevelLayerInstance* primaryLayer = GetPrimaryLayer();
-                const Polygonf& triggerPoly = primaryLayer->GetTriggerArea("boss_cutscene_start_area");
-
-                Character::Controller* playerController = GetPlayerController();
-
-                std::vector<Character::Character*> charactersInBossArea =
-                    playerController->GetCharacters<Character::Character>([&](const Character::Character* character)
-                {
-                    return Polygonf::Contains(triggerPoly, character->GetBounds().Middle());
-                });
-
-                if (!charactersInBossArea.empty())
-                {
-                    PlayCutscene(createBossEnterCutscene(primaryLayer, playerController, _bossID, _bossLadderID, _bossBrazierID));
-                    _playedBossCutscene = true;
-                }
-            }
-
             RainEnvironment rainEnv =
                 GetSoundManager()->GetCurrentEnvironment() == +Audio::EnvironmentType::None ? RainEnvironment::Open : RainEnvironment::Muffled;
             _rain->SetCurrentRainEnvironment(rainEnv);
@@ -899,7 +903,7 @@ namespace Dwarf
         {
             DwarfHomeLevel::OnSpawnCampaignCharacter(character);
 
-            character->SetRotation(GetPrimaryLayer()->GetTriggerPosition("spawn_character_look_dir") - character->GetPosition());
+            character->SetRotation(GetSpawnCharacterLookTarget() - character->GetPosition());
         }
 
         void DwarfHome2::OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile)
@@ -21,11 +21,6 @@ namespace Dwarf
 
             bool WasLeapPickedUp() const;
             void SetLeapPickedUp(bool pickedUp);
-
-        private:
-            bool _playedEatingCutscene;
-            bool _bossKilled;
-            bool _leapPickedUp;
         };
 
         class DwarfHome2 : public DwarfHomeLevel
@@ -208,9 +208,13 @@ namespace Dwarf
             };
         };
 
+        enum dwarfHome3Flag : uint32_t
+        {
+            dwarfHome3Flag_DynamiteCutscenePlayed,
+            dwarfHome3Flag_BossAreaLightTurnedOn,
+        };
+
         DwarfHome3Checkpoint::DwarfHome3Checkpoint()
-            : _dynamiteCutscenePlayed(false)
-            , _bossAreaLightTurnedOn(false)
         {
         }
 
@@ -220,22 +224,22 @@ namespace Dwarf
 
         bool DwarfHome3Checkpoint::WasDynamiteCutscenePlayed() const
         {
-            return _dynamiteCutscenePlayed;
+            return GetLevelFlag(dwarfHome3Flag_DynamiteCutscenePlayed, false);
         }
 
         void DwarfHome3Checkpoint::SetDynamiteCutscenePlayed(bool played)
         {
-            _dynamiteCutscenePlayed = played;
+            SetLevelFlag(dwarfHome3Flag_DynamiteCutscenePlayed, played);
         }
 
         bool DwarfHome3Checkpoint::WasBossAreaLightTurnedOn() const
         {
-            return _bossAreaLightTurnedOn;
+            return GetLevelFlag(dwarfHome3Flag_BossAreaLightTurnedOn, false);
         }
 
         void DwarfHome3Checkpoint::SetBossAreaLightTurnedOn(bool turnedOn)
         {
-            _bossAreaLightTurnedOn = turnedOn;
+            SetLevelFlag(dwarfHome3Flag_BossAreaLightTurnedOn, turnedOn);
         }
 
         static const float BossAreaLightTurnOnTime = 2.0f;
@@ -247,6 +251,7 @@ namespace Dwarf
             : DwarfHomeLevel(parameters, campaignParameters)
             , _fighterPortraitID(0)
             , _playedDynamiteCutscene(false)
+            , _dynamiteCutsceneVolume(InvalidTriggerVolumeHandle)
             , _bossAreaLightOn(false)
             , _bossAreaLightOnTime(0.0f)
             , _bossAreaLight()
@@ -379,6 +384,16 @@ namespace Dwarf
             {
                 giveBrewerPlantDynamite(GetPlayerController());
             }
+            else
+            {
+                TriggerVolumeParameters volumeParameters;
+                volumeParameters.Areas.push_back(primaryLayer->GetTriggerArea("dynamite_cutscene_start_area"));
+                volumeParameters.Filter = [this](const Character::Character* character)
+                {
+                    return character->GetController() == GetPlayerController();
+                };
+                _dynamiteCutsceneVolume = GetTriggerVolumeManager().AddVolume(primaryLayer, volumeParameters);
+            }
             _bossAreaLightOn = checkpoint != nullptr && checkpoint->WasBossAreaLightTurnedOn();
 
             SpawnTrackedRubble(primaryLayer, Character::RubbleSize_Medium, "entry_rocks_spawn", "entry_rocks_collision", nullptr, checkpoint);
@@ -395,7 +410,7 @@ namespace Dwarf
             const Vector2f& lavaSoundBase = primaryLayer->GetTriggerPosition("lava_sound_base");
             const Vector2f& lavaSoundMin = primaryLayer->GetTriggerPosition("lava_sound_min");
             const Vector2f& lavaSoundMax = primaryLayer->GetTriggerPosition("lava_sound_max");
-            Audio::LavaSound* lavaSound = new Audio::LavaSound(GetContentManager(), GetSoundManager(), lavaSoundChain, Vector2f::Distance(lavaSoundBase, lavaSoundMin), Vector2f::Distance(lavaSoundBase, lavaSoundMax));
+            Audio::LavaSound* lavaSound = new Audio::LavaSound(GetContentManager(), &GetSoundEmitterManager(), lavaSoundChain, Vector2f::Distance(lavaSoundBase, lavaSoundMin), Vector2f::Distance(lavaSoundBase, lavaSoundMax));
             _lavaSound = std::unique_ptr<Audio::LavaSound>(lavaSound);
             if (_bossAreaLightOn)
             {
@@ -616,24 +631,18 @@ namespace Dwarf
         {
             DwarfHomeLevel::OnUpdate(totalTime, dt);
 
-            if (!_playedDynamiteCutscene)
+            // The criteria can become true while a dwarf is already waiting in the area, so check the occupants every
+            // update instead of only on entry
+            if (!_playedDynamiteCutscene && GetTriggerVolumeManager().GetOccupantCount(_dynamiteCutsceneVolume) > 0)
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
-                const Polygonf& triggerPoly = primaryLayer->GetTriggerArea("dynamite_cutscene_start_area");
-
                 Character::Controller* playerController = GetPlayerController();
-
-                std::vector<Character::Character*> charactersInBossArea =
-                    playerController->GetCharacters<Character::Character>([&](const Character::Character* character)
-                {
-                    return Polygonf::Contains(triggerPoly, character->GetBounds().Middle());
-                });
-
-                if (!charactersInBossArea.empty() && meetsDynamiteCutsceneCriteria(primaryLayer, playerController))
+                if (meetsDynamiteCutsceneCriteria(primaryLayer, playerController))
                 {
                     giveBrewerPlantDynamite(GetPlayerController());
                     PlayCutscene(createDynamiteCutscene(primaryLayer, playerController));
                     _playedDynamiteCutscene = true;
+                    GetTriggerVolumeManager().RemoveVolume(_dynamiteCutsceneVolume);
                 }
             }
 
@@ -660,15 +669,13 @@ namespace Dwarf
                     _playedBossCutscene = true;
                 }
             }
-
-            _lavaSound->Update(totalTime, dt, GetCameraController().GetCamera());
         }
 
         void DwarfHome3::OnSpawnCampaignCharacter(Character::Character* character)
         {
             DwarfHomeLevel::OnSpawnCampaignCharacter(character);
 
-            character->SetRotation(GetPrimaryLayer()->GetTriggerPosition("spawn_character_look_dir") - character->GetPosition());
+            character->SetRotation(GetSpawnCharacterLookTarget() - character->GetPosition());
         }
 
         void DwarfHome3::OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile)
@@ -725,8 +732,11 @@ namespace Dwarf
                 {
                     for (auto &flame : _lavaFlames)
                     {
-                        levelRenderer->AddLight(flame->GetMainLight());
-                        levelRenderer->AddLight(flame->GetCenterLight());
+                        if (Graphics::IsLightInView(layer, flame->GetMainLight()))
+                        {
+                            levelRenderer->AddLight(flame->GetMainLight());
+                            levelRenderer->AddLight(flame->GetCenterLight());
+                        }
                     }
                 }
             }
@@ -25,10 +25,6 @@ namespace Dwarf
 
             bool WasBossAreaLightTurnedOn() const;
             void SetBossAreaLightTurnedOn(bool turnedOn);
-
-        private:
-            bool _dynamiteCutscenePlayed;
-            bool _bossAreaLightTurnedOn;
         };
 
         class DwarfHome3 : public DwarfHomeLevel
@@ -59,6 +55,7 @@ namespace Dwarf
             Character::CharacterID _fighterPortraitID;
 
             bool _playedDynamiteCutscene = false;
+            TriggerVolumeHandle _dynamiteCutsceneVolume;
             bool _playedBossCutscene = false;
 
             bool _bossAreaLightOn;
@@ -30,6 +30,8 @@ namespace Dwarf
         {
         };
 
+        static const uint32_t ForgeGobboAttackTargetCount = 6;
+
         static const auto TowerChestItems = []()
         {
             return Item::FindableItemSet
@@ -138,6 +140,12 @@ namespace Dwarf
             };
         };
 
+        enum dwarfHome4Flag : uint32_t
+        {
+            dwarfHome4Flag_ForgeDoorOpened,
+            dwarfHome4Flag_BossKilled,
+        };
+
         DwarfHome4Checkpoint::DwarfHome4Checkpoint()
         {
         }
@@ -148,22 +156,22 @@ namespace Dwarf
 
         bool DwarfHome4Checkpoint::WasForgeDoorOpened() const
         {
-            return _forgeDoorOpened;
+            return GetLevelFlag(dwarfHome4Flag_ForgeDoorOpened, false);
         }
 
         void DwarfHome4Checkpoint::SetForgeDoorOpened(bool opened)
         {
-            _forgeDoorOpened = opened;
+            SetLevelFlag(dwarfHome4Flag_ForgeDoorOpened, opened);
         }
 
         bool DwarfHome4Checkpoint::WasBossKilled() const
         {
-            return _bossKilled;
+            return GetLevelFlag(dwarfHome4Flag_BossKilled, false);
         }
 
         void DwarfHome4Checkpoint::SetBossKilled(bool killed)
         {
-            _bossKilled = killed;
+            SetLevelFlag(dwarfHome4Flag_BossKilled, killed);
         }
 
         static const float ForgeAreaLightTurnOnTime = 2.0f;
@@ -185,6 +193,8 @@ namespace Dwarf
             , _flameRadius(0.0f)
             , _mainFlames()
             , _forgeFlames()
+            , _forgeGobboArea()
+            , _forgeGobboAttackTargets()
         {
             AddMusicTracks(DwarfHome4MusicTracks);
         }
@@ -288,6 +298,7 @@ namespace Dwarf
             const Polygonf& flameSizer = primaryLayer->GetTriggerArea("flame_sizer");
             _flameRadius = flameSizer.Bounds().H;
 
+            LevelLayerInstance* flameLightLayer = GetLayer(FlameLightLayerName);
             std::vector<Vector2f> flameSpawns = primaryLayer->GetTriggerPositions("flame_spawn");
             for (auto flameSpawn : flameSpawns)
             {
@@ -296,6 +307,8 @@ namespace Dwarf
                 flame->SetRadius(_flameRadius);
                 flame->SetBrightnessRange(0.5f, 1.0f);
                 flame->LoadContent(GetContentManager());
+                GetFlameManager().AddFlame(flame);
+                GetLightCuller().AddStaticFlame(flameLightLayer, flame);
                 _mainFlames.push_back(std::unique_ptr<Graphics::Flame>(flame));
             }
 
@@ -321,7 +334,7 @@ namespace Dwarf
             const Vector2f& lavaSoundBase = primaryLayer->GetTriggerPosition("lava_sound_base");
             const Vector2f& lavaSoundMin = primaryLayer->GetTriggerPosition("lava_sound_min");
             const Vector2f& lavaSoundMax = primaryLayer->GetTriggerPosition("lava_sound_max");
-            Audio::LavaSound* lavaSound = new Audio::LavaSound(GetContentManager(), GetSoundManager(), lavaSoundChain, Vector2f::Distance(lavaSoundBase, lavaSoundMin), Vector2f::Distance(lavaSoundBase, lavaSoundMax));
+            Audio::LavaSound* lavaSound = new Audio::LavaSound(GetContentManager(), &GetSoundEmitterManager(), lavaSoundChain, Vector2f::Distance(lavaSoundBase, lavaSoundMin), Vector2f::Distance(lavaSoundBase, lavaSoundMax));
             _lavaSound = std::unique_ptr<Audio::LavaSound>(lavaSound);
             _lavaSound->Play(0.0f);
 
@@ -417,6 +430,8 @@ namespace Dwarf
 
             for (auto &flame : _mainFlames)
             {
+                GetFlameManager().RemoveFlame(flame.get());
+                GetLightCuller().RemoveStaticFlame(flame.get());
                 flame->UnloadContent();
             }
             _mainFlames.clear();
@@ -460,13 +475,6 @@ namespace Dwarf
                     throneLight.LightColor.A = 255;
                 }
             }
-
-            for (auto &flame : _mainFlames)
-            {
-                flame->Update(totalTime, dt);
-            }
-
-            _lavaSound->Update(totalTime, dt, GetCameraController().GetCamera());
         }
 
         void DwarfHome4::OnDraw(LevelLayerInstance* layer, Graphics::LevelRenderer* levelRenderer) const
@@ -486,15 +494,6 @@ namespace Dwarf
                 }
             }
 
-            if (layer->GetName() == FlameLightLayerName)
-            {
-                for (const auto &flame : _mainFlames)
-                {
-                    levelRenderer->AddLight(flame->GetMainLight());
-                    levelRenderer->AddLight(flame->GetCenterLight());
-                }
-            }
-
             if (_forgeAreaLightOn)
             {
                 if (layer->GetName() == AreaLightLayerName)
@@ -506,8 +505,11 @@ namespace Dwarf
                 {
                     for (const auto &flame : _forgeFlames)
                     {
-                        levelRenderer->AddLight(flame->GetMainLight());
-                        levelRenderer->AddLight(flame->GetCenterLight());
+                        if (Graphics::IsLightInView(layer, flame->GetMainLight()))
+                        {
+                            levelRenderer->AddLight(flame->GetMainLight());
+                            levelRenderer->AddLight(flame->GetCenterLight());
+                        }
                     }
                 }
 
@@ -529,11 +531,25 @@ namespace Dwarf
             }
         }
 
+        void DwarfHome4::OnResolveMarkers(LevelMarkers& markers)
+        {
+            DwarfHomeLevel::OnResolveMarkers(markers);
+
+            LevelLayerInstance* primaryLayer = GetPrimaryLayer();
+            _forgeGobboArea = markers.ResolveArea(primaryLayer, "forge_goblin_area");
+
+            _forgeGobboAttackTargets.clear();
+            for (uint32_t i = 0; i < ForgeGobboAttackTargetCount; i++)
+            {
+                _forgeGobboAttackTargets.push_back(markers.ResolveTrigger(primaryLayer, Format("forge_goblin_attack_target%u", i)));
+            }
+        }
+
         void DwarfHome4::OnSpawnCampaignCharacter(Character::Character* character)
         {
             DwarfHomeLevel::OnSpawnCampaignCharacter(character);
 
-            character->SetRotation(GetPrimaryLayer()->GetTriggerPosition("spawn_character_look_dir") - character->GetPosition());
+            character->SetRotation(GetSpawnCharacterLookTarget() - character->GetPosition());
         }
 
         void DwarfHome4::OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile)
@@ -558,19 +574,16 @@ namespace Dwarf
             auto callback = [this]
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
-                Polygonf forgeGobboArea = primaryLayer->GetTriggerArea("forge_goblin_area");
+                const LevelMarkers& markers = GetMarkers();
+                const Polygonf& forgeGobboArea = markers.GetTriggerArea(_forgeGobboArea);
 
                 std::vector<Vector2f> hitPts;
                 auto forgeGobbos = primaryLayer->FindIntersections<Character::Character>(forgeGobboArea.Bounds(), hitPts, [&](const Character::Character* character) { return character->GetController() == GetMonsterController(); });
-                std::vector<Character::Action> actions =
+                std::vector<Character::Action> actions;
+                for (TriggerHandle target : _forgeGobboAttackTargets)
                 {
-                    Character::CreateAttackMoveAction(primaryLayer->GetTriggerPosition("forge_goblin_attack_target0")),
-                    Character::CreateAttackMoveAction(primaryLayer->GetTriggerPosition("forge_goblin_attack_target1")),
-                    Character::CreateAttackMoveAction(primaryLayer->GetTriggerPosition("forge_goblin_attack_target2")),
-                    Character::CreateAttackMoveAction(primaryLayer->GetTriggerPosition("forge_goblin_attack_target3")),
-                    Character::CreateAttackMoveAction(primaryLayer->GetTriggerPosition("forge_goblin_attack_target4")),
-                    Character::CreateAttackMoveAction(primaryLayer->GetTriggerPosition("forge_goblin_attack_target5")),
-                };
+                    actions.push_back(Character::CreateAttackMoveAction(markers.GetTriggerPosition(target)));
+                }
                 for (auto gobbo : forgeGobbos)
                 {
                     for (uint32_t i = 0; i < actions.size(); i++)
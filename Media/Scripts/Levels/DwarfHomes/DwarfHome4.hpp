@@ -30,10 +30,6 @@ namespace Dwarf
 
             bool WasBossKilled() const;
             void SetBossKilled(bool killed);
-
-        private:
-            bool _forgeDoorOpened = false;
-            bool _bossKilled = false;
         };
 
         class DwarfHome4 : public DwarfHomeLevel
@@ -53,6 +49,8 @@ namespace Dwarf
 
             void OnDraw(LevelLayerInstance* layer, Graphics::LevelRenderer* levelRenderer) const override;
 
+            void OnResolveMarkers(LevelMarkers& markers) override;
+
             void OnSpawnCampaignCharacter(Character::Character* character) override;
 
             void OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile) override;
@@ -78,6 +76,9 @@ namespace Dwarf
             std::vector<Lights::PointLight> _forgeThroneLights;
 
             Character::CharacterID _bossID = 0;
+
+            AreaHandle _forgeGobboArea;
+            std::vector<TriggerHandle> _forgeGobboAttackTargets;
         };
     }
 
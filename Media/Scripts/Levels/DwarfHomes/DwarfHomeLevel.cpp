@@ -22,6 +22,13 @@ namespace Dwarf
 {
     namespace Level
     {
+        enum dwarfHomeCheckpointEntryType : uint8_t
+        {
+            dwarfHomeCheckpointEntryType_DoorOpen = CheckpointEntryType_Derived,
+            dwarfHomeCheckpointEntryType_OreGold,
+            dwarfHomeCheckpointEntryType_ChestOpened,
+        };
+
         DwarfHomeCheckpoint::DwarfHomeCheckpoint()
         {
         }
@@ -32,60 +39,47 @@ namespace Dwarf
 
         bool DwarfHomeCheckpoint::GetDoorState(LayerID layer, TriggerID trigger) const
         {
-            auto layerIter = _doorStates.find(layer);
-            assert(layerIter != _doorStates.end());
-            auto doorIter = layerIter->second.find(trigger);
-            assert(doorIter != layerIter->second.end());
-            return doorIter->second;
+            uint32_t open = 0;
+            bool found = GetStateValue(dwarfHomeCheckpointEntryType_DoorOpen, layer, trigger, open);
+            assert(found);
+            return found && open != 0;
         }
 
         void DwarfHomeCheckpoint::SetDoorState(LayerID layer, TriggerID trigger, bool state)
         {
-            _doorStates[layer][trigger] = state;
+            SetStateValue(dwarfHomeCheckpointEntryType_DoorOpen, layer, trigger, state ? 1 : 0);
         }
 
         Item::Resources DwarfHomeCheckpoint::GetOreState(LayerID layer, TriggerID trigger) const
         {
-            auto layerIter = _oreStates.find(layer);
-            if (layerIter == _oreStates.end())
+            uint32_t gold = 0;
+            if (!GetStateValue(dwarfHomeCheckpointEntryType_OreGold, layer, trigger, gold))
             {
                 return Item::Resources();
             }
 
-            auto oreIter = layerIter->second.find(trigger);
-            if (oreIter == layerIter->second.end())
-            {
-                return Item::Resources();
-            }
-
-            return oreIter->second;
+            return Item::Resources(static_cast<int32_t>(gold));
         }
 
         void DwarfHomeCheckpoint::SetOreState(LayerID layer, TriggerID trigger, const Item::Resources& state)
         {
-            _oreStates[layer][trigger] = state;
+            SetStateValue(dwarfHomeCheckpointEntryType_OreGold, layer, trigger, static_cast<uint32_t>(state.Gold));
         }
 
         bool DwarfHomeCheckpoint::WasChestOpened(LayerID layer, TriggerID trigger) const
         {
-            auto layerIter = _chestStates.find(layer);
-            if (layerIter == _chestStates.end())
-            {
-                return true;
-            }
-
-            auto chestIter = layerIter->second.find(trigger);
-            if (chestIter == layerIter->second.end())
+            uint32_t opened = 0;
+            if (!GetStateValue(dwarfHomeCheckpointEntryType_ChestOpened, layer, trigger, opened))
             {
                 return true;
             }
 
-            return chestIter->second;
+            return opened != 0;
         }
 
         void DwarfHomeCheckpoint::SetChestOpened(LayerID layer, TriggerID trigger, bool opened)
         {
-            _chestStates[layer][trigger] = opened;
+            SetStateValue(dwarfHomeCheckpointEntryType_ChestOpened, layer, trigger, opened ? 1 : 0);
         }
 
 
@@ -411,9 +405,23 @@ namespace Dwarf
             }
         }
 
+        void DwarfHomeLevel::OnResolveMarkers(LevelMarkers& markers)
+        {
+            CampaignLevel::OnResolveMarkers(markers);
+
+            LevelLayerInstance* primaryLayer = GetPrimaryLayer();
+            _dwarfSpawn = markers.ResolveSpline(primaryLayer, "dwarf_spawn");
+            _spawnCharacterLookDir = markers.ResolveTrigger(primaryLayer, "spawn_character_look_dir");
+        }
+
         Splinef DwarfHomeLevel::GetCharacterSpawnArea() const
         {
-            return GetPrimaryLayer()->GetSpline("dwarf_spawn");
+            return GetMarkers().GetSpline(_dwarfSpawn);
+        }
+
+        const Vector2f& DwarfHomeLevel::GetSpawnCharacterLookTarget() const
+        {
+            return GetMarkers().GetTriggerPosition(_spawnCharacterLookDir);
         }
 
         void DwarfHomeLevel::PopulateCheckpoint(std::shared_ptr<CampaignLevelCheckpoint> baseCheckpoint)
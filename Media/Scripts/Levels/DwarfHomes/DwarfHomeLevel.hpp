@@ -24,11 +24,6 @@ namespace Dwarf
 
             bool WasChestOpened(LayerID layer, TriggerID trigger) const;
             void SetChestOpened(LayerID layer, TriggerID trigger, bool opened);
-
-        private:
-            std::unordered_map<LayerID, std::unordered_map<TriggerID, bool>> _doorStates;
-            std::unordered_map<LayerID, std::unordered_map<TriggerID, Item::Resources>> _oreStates;
-            std::unordered_map<LayerID, std::unordered_map<TriggerID, bool>> _chestStates;
         };
 
         class DwarfHomeLevel : public CampaignLevel
@@ -59,8 +54,12 @@ namespace Dwarf
                                                      const Item::FindableItemSet& items, std::shared_ptr<const DwarfHomeCheckpoint> checkpoint);
 
             virtual void OnCreate() override;
+            virtual void OnResolveMarkers(LevelMarkers& markers) override;
             virtual Splinef GetCharacterSpawnArea() const override;
 
+            // Point the campaign characters face when they are spawned
+            const Vector2f& GetSpawnCharacterLookTarget() const;
+
             virtual void PopulateCheckpoint(std::shared_ptr<CampaignLevelCheckpoint> checkpoint) override;
             virtual void OnLevelSuccessfullyCompleted(Settings::TheDeepDeepProfile* profile) override;
 
@@ -73,6 +72,9 @@ namespace Dwarf
             std::unordered_map<LayerID, std::unordered_map<TriggerID, bool>> _openedChests;
 
             Item::FindableItemSet _foundItems;
+
+            SplineHandle _dwarfSpawn;
+            TriggerHandle _spawnCharacterLookDir;
         };
     }
 
@@ -0,0 +1,49 @@
+#include "Levels/EternalBattleLevel.hpp"
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        static const std::string EternalBattleLevelPath = "Levels/eternal_battle.lvl";
+
+        GameState::LevelConstructor<> CreateEternalBattleBenchmark(uint32_t frameCount, uint32_t seed, float populationScale)
+        {
+            assert(frameCount > 0);
+            return GameState::BindLevelConstructor<EternalBattleLevel>(EternalBattleLevelPath, populationScale, frameCount, seed);
+        }
+    }
+
+    template <>
+    void EnumeratePreloads<Level::EternalBattleLevel>(PreloadSet& preloads)
+    {
+        EnumeratePreloads<Level::BasicLevel>(preloads);
+
+        EnumeratePreloads<Character::MrBonesMelee>(preloads);
+        EnumeratePreloads<Character::MrBonesArcher>(preloads);
+
+        EnumeratePreloads<Item::SkelAxe>(preloads);
+        EnumeratePreloads<Item::SkelDagger>(preloads);
+        EnumeratePreloads<Item::SkelHalberd>(preloads);
+        EnumeratePreloads<Item::SkelScimitar>(preloads);
+        EnumeratePreloads<Item::SkelBow>(preloads);
+
+        EnumeratePreloads<Character::Bridge>(preloads);
+
+        EnumeratePreloads<Character::Torch>(preloads);
+
+        EnumeratePreloads<Character::BrewerDwarf>(preloads);
+        EnumeratePreloads<Character::BuilderDwarf>(preloads);
+        EnumeratePreloads<Character::CookDwarf>(preloads);
+        EnumeratePreloads<Character::FighterDwarf>(preloads);
+        EnumeratePreloads<Character::MinerDwarf>(preloads);
+        EnumeratePreloads<Character::NavigatorDwarf>(preloads);
+
+        EnumeratePreloads<Item::IronShortSword>(preloads);
+        EnumeratePreloads<Item::BasicRifle>(preloads);
+        EnumeratePreloads<Item::LightningSword>(preloads);
+
+        EnumeratePreloads<Item::IronHammer>(preloads);
+
+        EnumeratePreloads<Item::IronPickAxe>(preloads);
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Levels/BasicLevel.hpp"
+#include "GameState/LevelGameState.hpp"
+#include "Random.hpp"
 
 #include "Controllers/Player.hpp"
 #include "Controllers/WildlifeController.hpp"
@@ -32,18 +34,30 @@ namespace Dwarf
 {
     namespace Level
     {
+        // Endless fight between dwarves and skeletons, doubles as a simulation stress test. The population scale multiplies
+        // the number of fighters on each side and how quickly they are replaced, and when benchmark frames are given the
+        // random number generator is seeded with the benchmark seed and the simulation stages are timed for that many
+        // frames and reported once finished.
         class EternalBattleLevel : public BasicLevel
         {
         public:
-            EternalBattleLevel(const LevelParameters& parameters)
+            EternalBattleLevel(const LevelParameters& parameters, float populationScale = 1.0f, uint32_t benchmarkFrames = 0, uint32_t benchmarkSeed = 0)
                 : BasicLevel(parameters)
                 , _spawnTimer(0.0f)
-                , _minSpawnInterval(0.65f)
-                , _maxBottomDwarves(6)
-                , _maxTopDwarves(1)
-                , _maxBottomSkellies(13)
-                , _maxTopSkellies(1)
+                , _minSpawnInterval(0.65f / Max(populationScale, 1.0f))
+                , _maxBottomDwarves(scalePopulation(6, populationScale))
+                , _maxTopDwarves(scalePopulation(1, populationScale))
+                , _maxBottomSkellies(scalePopulation(13, populationScale))
+                , _maxTopSkellies(scalePopulation(1, populationScale))
+                , _benchmark(benchmarkFrames > 0 ? new SimulationBenchmark(benchmarkFrames) : nullptr)
             {
+                SetSimulationBenchmark(_benchmark.get());
+                if (_benchmark)
+                {
+                    // Seeded before anything in the level draws a random number so that every run fights the same battle
+                    Random::SetSeed(benchmarkSeed);
+                }
+
                 _bottomDwarfWeapons.push_back(Item::BindItemConstructor<Item::IronShortSword>());
 
                 _topDwarfWeapons.push_back(Item::BindItemConstructor<Item::BasicRifle>());
@@ -58,6 +72,8 @@ namespace Dwarf
 
             virtual void OnCreate() override
             {
+                BasicLevel::OnCreate();
+
                 _dwarfController = CreateController("dwarf_controller", Character::BindControllerConstructor<Character::WildlifeController>());
                 _skellyController = CreateController("skeleton_controller", Character::BindControllerConstructor<Character::WildlifeController>());
 
@@ -71,8 +87,28 @@ namespace Dwarf
             {
             }
 
+            virtual void OnResolveMarkers(LevelMarkers& markers) override
+            {
+                BasicLevel::OnResolveMarkers(markers);
+
+                LevelLayerInstance* primaryLayer = GetPrimaryLayer();
+                _bottomDwarfSpawn = markers.ResolveTrigger(primaryLayer, "spawn_left_bottom");
+                _bottomDwarfAttack = markers.ResolveTrigger(primaryLayer, "attack_left_bottom");
+                _topDwarfSpawn = markers.ResolveTrigger(primaryLayer, "spawn_left_top");
+                _topDwarfAttack = markers.ResolveTrigger(primaryLayer, "attack_left_top");
+                _bottomSkellySpawn = markers.ResolveTrigger(primaryLayer, "spawn_right_bottom");
+                _bottomSkellyAttack = markers.ResolveTrigger(primaryLayer, "attack_right_bottom");
+                _topSkellySpawn = markers.ResolveTrigger(primaryLayer, "spawn_right_top");
+                _topSkellyAttack = markers.ResolveTrigger(primaryLayer, "attack_right_top");
+            }
+
             void OnUpdate(double totalTime, float dt)
             {
+                if (_benchmark && !_benchmark->IsComplete() && !_benchmark->NextFrame())
+                {
+                    LogInfo(_benchmark->GetReport());
+                }
+
                 BasicLevel::OnUpdate(totalTime, dt);
 
                 cleanCharacterList(_bottomDwarves);
@@ -110,6 +146,11 @@ namespace Dwarf
             }
 
         private:
+            static uint32_t scalePopulation(uint32_t count, float scale)
+            {
+                return Max(1u, static_cast<uint32_t>(count * scale + 0.5f));
+            }
+
             void initializeCamera()
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
@@ -155,8 +196,8 @@ namespace Dwarf
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
 
-                const Vector2f& spawnPos = primaryLayer->GetTriggerPosition("spawn_left_bottom");
-                const Vector2f& attackPos = primaryLayer->GetTriggerPosition("attack_left_bottom");
+                const Vector2f& spawnPos = GetMarkers().GetTriggerPosition(_bottomDwarfSpawn);
+                const Vector2f& attackPos = GetMarkers().GetTriggerPosition(_bottomDwarfAttack);
 
                 Character::Dwarf* dwarf = primaryLayer->SpawnCharacter(spawnPos, "bottom_dwarf", _dwarfController, Character::BindCharacterConstructor<Character::FighterDwarf>());
                 dwarf->GiveItem(Random::RandomItem(_bottomDwarfWeapons));
@@ -169,8 +210,8 @@ namespace Dwarf
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
 
-                const Vector2f& spawnPos = primaryLayer->GetTriggerPosition("spawn_left_top");
-                const Vector2f& attackPos = primaryLayer->GetTriggerPosition("attack_left_top");
+                const Vector2f& spawnPos = GetMarkers().GetTriggerPosition(_topDwarfSpawn);
+                const Vector2f& attackPos = GetMarkers().GetTriggerPosition(_topDwarfAttack);
 
                 Character::Dwarf* dwarf = primaryLayer->SpawnCharacter(spawnPos, "top_dwarf", _dwarfController, Character::BindCharacterConstructor<Character::BrewerDwarf>());
                 dwarf->GiveItem(Random::RandomItem(_topDwarfWeapons));
@@ -184,8 +225,8 @@ namespace Dwarf
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
 
-                const Vector2f& spawnPos = primaryLayer->GetTriggerPosition("spawn_right_bottom");
-                const Vector2f& attackPos = primaryLayer->GetTriggerPosition("attack_right_bottom");
+                const Vector2f& spawnPos = GetMarkers().GetTriggerPosition(_bottomSkellySpawn);
+                const Vector2f& attackPos = GetMarkers().GetTriggerPosition(_bottomSkellyAttack);
 
                 Character::MrBones* skelly = primaryLayer->SpawnCharacter(spawnPos, "bottom_skelly", _skellyController, Character::BindCharacterConstructor<Character::MrBonesMelee>());
                 skelly->GiveItem(Random::RandomItem(_bottomSkellyWeapons));
@@ -198,8 +239,8 @@ namespace Dwarf
             {
                 LevelLayerInstance* primaryLayer = GetPrimaryLayer();
 
-                const Vector2f& spawnPos = primaryLayer->GetTriggerPosition("spawn_right_top");
-                const Vector2f& attackPos = primaryLayer->GetTriggerPosition("attack_right_top");
+                const Vector2f& spawnPos = GetMarkers().GetTriggerPosition(_topSkellySpawn);
+                const Vector2f& attackPos = GetMarkers().GetTriggerPosition(_topSkellyAttack);
 
                 Character::MrBones* skelly = primaryLayer->SpawnCharacter(spawnPos, "top_skelly", _skellyController, Character::BindCharacterConstructor<Character::MrBonesArcher>());
                 skelly->GiveItem(Random::RandomItem(_topSkellyWeapons));
@@ -231,6 +272,15 @@ namespace Dwarf
             float _spawnTimer;
             const float _minSpawnInterval;
 
+            TriggerHandle _bottomDwarfSpawn;
+            TriggerHandle _bottomDwarfAttack;
+            TriggerHandle _topDwarfSpawn;
+            TriggerHandle _topDwarfAttack;
+            TriggerHandle _bottomSkellySpawn;
+            TriggerHandle _bottomSkellyAttack;
+            TriggerHandle _topSkellySpawn;
+            TriggerHandle _topSkellyAttack;
+
             const uint32_t _maxBottomDwarves;
             std::set<Character::CharacterID> _bottomDwarves;
             std::vector< Item::ItemConstructor<Item::Weapon> > _bottomDwarfWeapons;
@@ -249,40 +299,15 @@ namespace Dwarf
 
             Character::WildlifeController* _dwarfController;
             Character::WildlifeController* _skellyController;
+
+            std::unique_ptr<SimulationBenchmark> _benchmark;
         };
+
+        // Eternal battle that times its simulation for the given number of frames from a fixed seed, logging the report
+        // once the frames have been recorded
+        GameState::LevelConstructor<> CreateEternalBattleBenchmark(uint32_t frameCount, uint32_t seed, float populationScale = 1.0f);
     }
 
     template <>
-    void EnumeratePreloads<Level::EternalBattleLevel>(PreloadSet& preloads)
-    {
-        EnumeratePreloads<Level::BasicLevel>(preloads);
-
-        EnumeratePreloads<Character::MrBonesMelee>(preloads);
-        EnumeratePreloads<Character::MrBonesArcher>(preloads);
-
-        EnumeratePreloads<Item::SkelAxe>(preloads);
-        EnumeratePreloads<Item::SkelDagger>(preloads);
-        EnumeratePreloads<Item::SkelHalberd>(preloads);
-        EnumeratePreloads<Item::SkelScimitar>(preloads);
-        EnumeratePreloads<Item::SkelBow>(preloads);
-
-        EnumeratePreloads<Character::Bridge>(preloads);
-
-        EnumeratePreloads<Character::Torch>(preloads);
-
-        EnumeratePreloads<Character::BrewerDwarf>(preloads);
-        EnumeratePreloads<Character::BuilderDwarf>(preloads);
-        EnumeratePreloads<Character::CookDwarf>(preloads);
-        EnumeratePreloads<Character::FighterDwarf>(preloads);
-        EnumeratePreloads<Character::MinerDwarf>(preloads);
-        EnumeratePreloads<Character::NavigatorDwarf>(preloads);
-
-        EnumeratePreloads<Item::IronShortSword>(preloads);
-        EnumeratePreloads<Item::BasicRifle>(preloads);
-        EnumeratePreloads<Item::LightningSword>(preloads);
-
-        EnumeratePreloads<Item::IronHammer>(preloads);
-
-        EnumeratePreloads<Item::IronPickAxe>(preloads);
-    }
+    void EnumeratePreloads<Level::EternalBattleLevel>(PreloadSet& preloads);
 }
@@ -0,0 +1,125 @@
+#include "Levels/LevelMarkers.hpp"
+#include "Level/LevelLayerInstance.hpp"
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        LevelMarkers::LevelMarkers()
+            : _triggers()
+            , _resolvedTriggers()
+            , _areas()
+            , _resolvedAreas()
+            , _splines()
+            , _resolvedSplines()
+            , _missing()
+        {
+        }
+
+        TriggerHandle LevelMarkers::ResolveTrigger(LevelLayerInstance* layer, const std::string& name)
+        {
+            return resolve(layer, name, "trigger", _triggers, _resolvedTriggers, [&](Vector2f& position)
+            {
+                std::vector<Vector2f> positions = layer->GetTriggerPositions(name);
+                if (positions.empty())
+                {
+                    return false;
+                }
+
+                position = positions.front();
+                return true;
+            });
+        }
+
+        AreaHandle LevelMarkers::ResolveArea(LevelLayerInstance* layer, const std::string& name)
+        {
+            return resolve(layer, name, "trigger area", _areas, _resolvedAreas, [&](std::vector<Polygonf>& areas)
+            {
+                areas = layer->GetTriggerAreas(name);
+                return !areas.empty();
+            });
+        }
+
+        SplineHandle LevelMarkers::ResolveSpline(LevelLayerInstance* layer, const std::string& name)
+        {
+            return resolve(layer, name, "spline", _splines, _resolvedSplines, [&](Splinef& spline)
+            {
+                std::vector<Splinef> splines = layer->GetSplines(name);
+                if (splines.empty())
+                {
+                    return false;
+                }
+
+                spline = splines.front();
+                return true;
+            });
+        }
+
+        const Vector2f& LevelMarkers::GetTriggerPosition(TriggerHandle handle) const
+        {
+            assert(handle.Index < _triggers.size());
+            return _triggers[handle.Index];
+        }
+
+        const Polygonf& LevelMarkers::GetTriggerArea(AreaHandle handle) const
+        {
+            static const Polygonf NoArea;
+
+            const std::vector<Polygonf>& areas = GetTriggerAreas(handle);
+            return !areas.empty() ? areas.front() : NoArea;
+        }
+
+        const std::vector<Polygonf>& LevelMarkers::GetTriggerAreas(AreaHandle handle) const
+        {
+            assert(handle.Index < _areas.size());
+            return _areas[handle.Index];
+        }
+
+        const Splinef& LevelMarkers::GetSpline(SplineHandle handle) const
+        {
+            assert(handle.Index < _splines.size());
+            return _splines[handle.Index];
+        }
+
+        bool LevelMarkers::Validate()
+        {
+            for (const auto& missing : _missing)
+            {
+                LogWarning(Format("Level marker not found: %s.", missing.c_str()));
+            }
+
+            bool valid = _missing.empty();
+            _missing.clear();
+            return valid;
+        }
+
+        template <typename T, typename lookupFunc>
+        MarkerHandle<T> LevelMarkers::resolve(LevelLayerInstance* layer, const std::string& name, const char* kind, std::vector<T>& values,
+                                              resolvedNames& resolved, lookupFunc lookup)
+        {
+            assert(layer);
+
+            MarkerHandle<T> handle;
+
+            auto key = std::make_pair(static_cast<const LevelLayerInstance*>(layer), name);
+            auto iter = resolved.find(key);
+            if (iter != resolved.end())
+            {
+                handle.Index = iter->second;
+                return handle;
+            }
+
+            // Missing markers still get a handle to default data so scripts keep running until the level is validated
+            T value = T();
+            if (!lookup(value))
+            {
+                _missing.push_back(Format("%s '%s' on layer %u", kind, name.c_str(), layer->GetID()));
+            }
+
+            handle.Index = static_cast<uint32_t>(values.size());
+            values.push_back(value);
+            resolved[key] = handle.Index;
+            return handle;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Geometry/Polygon.hpp"
+#include "Geometry/Spline.hpp"
+#include "Geometry/Vector2.hpp"
+#include "Level/LevelTypes.hpp"
+#include "NonCopyable.hpp"
+
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        class LevelLayerInstance;
+
+        // Index of a resolved marker, typed by the marker data so that handles of different kinds can't be mixed up
+        template <typename T>
+        struct MarkerHandle
+        {
+            uint32_t Index = std::numeric_limits<uint32_t>::max();
+
+            bool IsValid() const { return Index != std::numeric_limits<uint32_t>::max(); }
+        };
+
+        typedef MarkerHandle<Vector2f> TriggerHandle;
+        typedef MarkerHandle<std::vector<Polygonf>> AreaHandle;
+        typedef MarkerHandle<Splinef> SplineHandle;
+
+        // Named triggers, areas and splines of the level layers, looked up by name once when the level is created and
+        // read through handles afterwards. Names that can't be found are remembered so that every missing one can be
+        // reported together instead of when the script that uses it happens to run. Only names resolved in a level's
+        // OnResolveMarkers are checked up front, lookups that run once while creating the level or setting up a cutscene
+        // still go by name.
+        class LevelMarkers : public NonCopyable
+        {
+        public:
+            LevelMarkers();
+
+            TriggerHandle ResolveTrigger(LevelLayerInstance* layer, const std::string& name);
+            AreaHandle ResolveArea(LevelLayerInstance* layer, const std::string& name);
+            SplineHandle ResolveSpline(LevelLayerInstance* layer, const std::string& name);
+
+            const Vector2f& GetTriggerPosition(TriggerHandle handle) const;
+            const Polygonf& GetTriggerArea(AreaHandle handle) const;
+            const std::vector<Polygonf>& GetTriggerAreas(AreaHandle handle) const;
+            const Splinef& GetSpline(SplineHandle handle) const;
+
+            // Logs every name that could not be resolved since the last validation, returns false if there were any
+            bool Validate();
+
+        private:
+            using resolvedNames = std::map<std::pair<const LevelLayerInstance*, std::string>, uint32_t>;
+
+            template <typename T, typename lookupFunc>
+            MarkerHandle<T> resolve(LevelLayerInstance* layer, const std::string& name, const char* kind, std::vector<T>& values,
+                                    resolvedNames& resolved, lookupFunc lookup);
+
+            std::vector<Vector2f> _triggers;
+            resolvedNames _resolvedTriggers;
+
+            std::vector<std::vector<Polygonf>> _areas;
+            resolvedNames _resolvedAreas;
+
+            std::vector<Splinef> _splines;
+            resolvedNames _resolvedSplines;
+
+            std::vector<std::string> _missing;
+        };
+    }
+}
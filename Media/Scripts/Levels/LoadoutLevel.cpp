@@ -145,6 +145,7 @@ namespace Dwarf
                 , _cursorSize()
                 , _tooltip(nullptr)
                 , _hudFont(nullptr)
+                , _changedLoadout(false)
             {
                 _acceptText = strings->GetString("loadout_accept_tooltip");
                 _cancelText = strings->GetString("loadout_cancel_tooltip");
@@ -234,6 +235,12 @@ namespace Dwarf
                 return _clickingCancel;
             }
 
+            // An item was equiped or unequiped on the selected dwarf this update
+            bool IsJustChangingLoadout() const
+            {
+                return _changedLoadout;
+            }
+
             const HUD::Panel* GetTooltip() const
             {
                 return _tooltip;
@@ -377,11 +384,12 @@ namespace Dwarf
                     _cancelLight.EmissiveColor = Color::FromBytes(0, 0, 0, 0);
                 }
 
+                _changedLoadout = false;
                 if (_selectedDwarf)
                 {
-                    checkPanelForClicks(_weaponPanel, _hudFont, _selectedDwarfTypeState->Weapons, _sampleWeapons, _selectedDwarf, _selectedDwarf->WeaponIndex, Item::ItemSlot::Weapon, _tooltip);
-                    checkPanelForClicks(_trinketPanel, _hudFont, _selectedDwarfTypeState->Trinkets, _sampleTrinkets, _selectedDwarf, _selectedDwarf->TrinketIndex, Item::ItemSlot::Trinket, _tooltip);
-                    checkPanelForClicks(_armorPanel, _hudFont, _selectedDwarfTypeState->Armors, _sampleArmor, _selectedDwarf, _selectedDwarf->ArmorIndex, Item::ItemSlot::Armor, _tooltip);
+                    _changedLoadout |= checkPanelForClicks(_weaponPanel, _hudFont, _selectedDwarfTypeState->Weapons, _sampleWeapons, _selectedDwarf, _selectedDwarf->WeaponIndex, Item::ItemSlot::Weapon, _tooltip);
+                    _changedLoadout |= checkPanelForClicks(_trinketPanel, _hudFont, _selectedDwarfTypeState->Trinkets, _sampleTrinkets, _selectedDwarf, _selectedDwarf->TrinketIndex, Item::ItemSlot::Trinket, _tooltip);
+                    _changedLoadout |= checkPanelForClicks(_armorPanel, _hudFont, _selectedDwarfTypeState->Armors, _sampleArmor, _selectedDwarf, _selectedDwarf->ArmorIndex, Item::ItemSlot::Armor, _tooltip);
                 }
             }
 
@@ -486,10 +494,13 @@ namespace Dwarf
                 panel->Update(input, camera);
             }
 
+            // Returns true if the click equiped or unequiped an item
             template <typename T>
-            static void checkPanelForClicks(ButtonPanel* panel, const Graphics::Font* font, std::vector<Item::ItemInfo<T>>& itemInfo, const std::vector<std::pair<std::type_index, ResourcePointer<const HUD::Panel>>>& samples,
+            static bool checkPanelForClicks(ButtonPanel* panel, const Graphics::Font* font, std::vector<Item::ItemInfo<T>>& itemInfo, const std::vector<std::pair<std::type_index, ResourcePointer<const HUD::Panel>>>& samples,
                                             LoadoutDwarfInfo* selectedDwarf, std::set<uint32_t>& equippedItems, Item::ItemSlot slot, ResourcePointer<const HUD::Panel>& curTooltip)
             {
+                bool changed = false;
+
                 uint32_t clickedButton;
                 if (panel->IsButtonJustClicked(clickedButton))
                 {
@@ -548,6 +559,7 @@ namespace Dwarf
                         updateCornerText(panel, font, clickedButton, itemInfo[clickedButton].Count, equippedItems);
 
                         playEquipSound(item);
+                        changed = true;
                     }
                     else if (equipped && equippedItems.size() > 1)
                     {
@@ -568,6 +580,7 @@ namespace Dwarf
                         }
                         equippedItems.erase(clickedButton);
                         updateCornerText(panel, font, clickedButton, itemInfo[clickedButton].Count, equippedItems);
+                        changed = true;
                     }
                 }
 
@@ -576,6 +589,8 @@ namespace Dwarf
                 {
                     curTooltip = samples[mouseoverButton].second;
                 }
+
+                return changed;
             }
 
             static void updateCornerText(ButtonPanel* panel, const Graphics::Font* font, uint32_t index, uint32_t count, std::set<uint32_t>& equippedItems)
@@ -606,6 +621,7 @@ namespace Dwarf
             bool _mouseOver;
             bool _clickingAccept;
             bool _clickingCancel;
+            bool _changedLoadout;
 
             Input::InputBindCode _selectBind;
 
@@ -967,7 +983,9 @@ namespace Dwarf
                 , _hudFont(nullptr)
 
                 , _levelChangeFunc(levelChangeFunc)
-                , _startedPreload(false)
+                , _loadoutVersion(0)
+                , _speculativeLoadoutVersion(0)
+                , _speculativePreloads()
                 , _preloadLevelFunc(preloadLevelFunc)
                 , _exitFunc(exitFunc)
                 , _menuFunc(menuFunc)
@@ -1147,11 +1165,7 @@ namespace Dwarf
 
             virtual void OnUpdate(const Input::FrameInput& input, double totalTime, float dt) override
             {
-                if (!_startedPreload)
-                {
-                    //_preloadLevelFunc(_campaignLevel(Level::CampaignLevelParameters()));
-                    _startedPreload = true;
-                }
+                updateSpeculativePreload();
 
                 Level::LevelInstance* lvl = GetLevel();
                 Level::CameraController& cameraController = lvl->GetCameraController();
@@ -1182,6 +1196,10 @@ namespace Dwarf
                 // Update the loadout panel
                 _loadoutPanel->SetPosition(camera.Project(_menuPos), panelScale, _uiScale);
                 _loadoutPanel->Update(input, hudCamera, totalTime, dt);
+                if (_loadoutPanel->IsJustChangingLoadout())
+                {
+                    _loadoutVersion++;
+                }
                 bool mouseOnLoadout = _loadoutPanel->IsMouseOver();
                 if (mouseOnLoadout)
                 {
@@ -1383,7 +1401,11 @@ namespace Dwarf
                         }
                     }
 
-                    _levelChangeFunc(_campaignLevel(generateCampaignLevelParameters()));
+                    // The loadout's content was preloaded while on this screen and is handed to the level as it is
+                    GameState::LevelConstructor<> constructor = _campaignLevel(generateCampaignLevelParameters());
+                    PreloadSet loadoutPreloads = enumerateLoadoutPreloads();
+                    constructor.Preloads.insert(loadoutPreloads.begin(), loadoutPreloads.end());
+                    _levelChangeFunc(constructor);
                 }
 
                 SafeAddRef(_curTooltip);
@@ -1448,22 +1470,84 @@ namespace Dwarf
             }
 
             static void restartAtCheckpoint(LevelChangeFunction levelChangeFunc, Level::CampaignLevelConstructor<> campaignLevel,
-                                            Level::CampaignLevelParameters params, Settings::TheDeepDeepProfile* profile, 
+                                            Level::CampaignLevelParameters params, PreloadSet loadoutPreloads,
                                             std::shared_ptr<const Level::CampaignLevelCheckpoint> checkpoint)
             {
                 params.Checkpoint = checkpoint;
 
                 using namespace std::placeholders;
-                params.CheckpointFunction = std::bind(&LoadoutController::restartAtCheckpoint, levelChangeFunc, campaignLevel, params, profile, _1);
+                params.CheckpointFunction = std::bind(&LoadoutController::restartAtCheckpoint, levelChangeFunc, campaignLevel, params, loadoutPreloads, _1);
 
                 GameState::LevelConstructor<> constructor = campaignLevel(params);
-
-                profile->EnumerateItemPreloads(constructor.Preloads);
-                profile->EnumerateAbilityPreloads(constructor.Preloads);
+                constructor.Preloads.insert(loadoutPreloads.begin(), loadoutPreloads.end());
 
                 levelChangeFunc(constructor);
             }
 
+            template <typename T>
+            static void enumerateItemPreloads(const std::set<uint32_t>& equipedItemIndices, const std::vector<Item::ItemInfo<T>>& items, PreloadSet& preloads)
+            {
+                for (auto equipedItemIndex : equipedItemIndices)
+                {
+                    Item::GameItem<T>::GetPreloadFunction(items[equipedItemIndex].Key)(preloads);
+                }
+            }
+
+            // The content of the dwarves' equiped items and abilities and of the items that can be found in the level,
+            // anything else the level needs is loaded when it is first used
+            PreloadSet enumerateLoadoutPreloads() const
+            {
+                PreloadSet preloads;
+
+                std::set<std::type_index> dwarfTypes;
+                for (uint32_t i = 0; i < _dwarves.size(); i++)
+                {
+                    std::type_index type = typeid(*_dwarves[i]->Dwarf);
+                    const dwarfTypeInfo &typeInfo = _dwarfTypes.at(type);
+
+                    enumerateItemPreloads(_dwarves[i]->WeaponIndex, typeInfo.TypeState.Weapons, preloads);
+                    enumerateItemPreloads(_dwarves[i]->ArmorIndex, typeInfo.TypeState.Armors, preloads);
+                    enumerateItemPreloads(_dwarves[i]->TrinketIndex, typeInfo.TypeState.Trinkets, preloads);
+
+                    if (dwarfTypes.insert(type).second)
+                    {
+                        for (const auto& abilityInfo : _profile->GetAbilityInfo(dwarfTypeToKey(type)))
+                        {
+                            Ability::GameAbility::GetPreloadFunction(abilityInfo.Key)(preloads);
+                        }
+                    }
+                }
+
+                EnumerateFindableItemSetPreloads(preloads, _levelInfo.FindableItems);
+
+                return preloads;
+            }
+
+            // Loads the campaign level in the background while the player is picking their dwarves, the level itself
+            // and the content of the current loadout. Each change to the loadout requests the current content again,
+            // so items that are unequiped or dwarves that are removed are no longer asked for. Scripts have no way to
+            // abort a preload, leaving the screen without starting the level leaves the last request to the engine.
+            void updateSpeculativePreload()
+            {
+                // The content is only enumerated again when the loadout has changed since the last request
+                if (!_speculativePreloads.empty() && _loadoutVersion == _speculativeLoadoutVersion)
+                {
+                    return;
+                }
+                _speculativeLoadoutVersion = _loadoutVersion;
+
+                GameState::LevelConstructor<> constructor = _campaignLevel(Level::CampaignLevelParameters());
+                PreloadSet loadoutPreloads = enumerateLoadoutPreloads();
+                constructor.Preloads.insert(loadoutPreloads.begin(), loadoutPreloads.end());
+
+                // Changes that do not change the content, such as swapping two dwarves of the same type, keep the request
+                if (constructor.Preloads != _speculativePreloads)
+                {
+                    _speculativePreloads = constructor.Preloads;
+                    _preloadLevelFunc(constructor);
+                }
+            }
+
             Level::CampaignLevelParameters generateCampaignLevelParameters() const
             {
                 Level::CampaignLevelParameters params = _generateCampaignLevelParametersInternal();
@@ -1471,10 +1555,10 @@ namespace Dwarf
                 Level::CampaignLevelParameters paramsCopy = params;
                 LevelChangeFunction levelChangeFuncCopy = _levelChangeFunc;
                 Level::CampaignLevelConstructor<> campaignLevelCopy = _campaignLevel;
-                Settings::TheDeepDeepProfile* profile = GetLevel()->GetProfile<Settings::TheDeepDeepProfile>();
+                PreloadSet loadoutPreloads = enumerateLoadoutPreloads();
 
                 using namespace std::placeholders;
-                params.CheckpointFunction = std::bind(&LoadoutController::restartAtCheckpoint, levelChangeFuncCopy, campaignLevelCopy, paramsCopy, profile, _1);
+                params.CheckpointFunction = std::bind(&LoadoutController::restartAtCheckpoint, levelChangeFuncCopy, campaignLevelCopy, paramsCopy, loadoutPreloads, _1);
 
                 return params;
             }
@@ -1516,6 +1600,7 @@ namespace Dwarf
                 params.StartingResources = _levelInfo.StartingResources;
 
                 params.Checkpoint = nullptr;
+                params.CheckpointSavePath = Level::GetCheckpointSavePath(_profile->GetCampaignID(), _levelInfo.NameCode);
 
                 params.ExitFunction = _exitFunc;
                 params.MenuFunction = _menuFunc;
@@ -1704,6 +1789,7 @@ namespace Dwarf
                     primaryLayer->SpawnCharacter(_spawnPos, spawnDwarfInfo.Name, this, dwarfTypeInfo.Constructor(spawnDwarfInfo)),
                     profileIdx);
                 _dwarves.push_back(dwarfInfo);
+                _loadoutVersion++;
 
                 selectDwarf(dwarfInfo);
 
@@ -1734,6 +1820,7 @@ namespace Dwarf
                 reclaimDwarfItemType(info->WeaponIndex, typeInfo.Weapons);
                 reclaimDwarfItemType(info->TrinketIndex, typeInfo.Trinkets);
                 reclaimDwarfItemType(info->ArmorIndex, typeInfo.Armors);
+                _loadoutVersion++;
 
                 for (auto item : info->Dwarf->DiscardItems())
                 {
@@ -1755,6 +1842,7 @@ namespace Dwarf
                     if (_dwarves[i]->Dwarf == info->Dwarf)
                     {
                         _dwarves.erase(_dwarves.begin() + i);
+                        _loadoutVersion++;
                         break;
                     }
                 }
@@ -1808,6 +1896,7 @@ namespace Dwarf
                 giveFirstInfiniteItem(info->Dwarf, Item::ItemSlot::Trinket, info->TrinketIndex, typeInfo.Trinkets);
                 giveFirstInfiniteItem(info->Dwarf, Item::ItemSlot::Armor, info->ArmorIndex, typeInfo.Armors);
                 info->IsEquiped = true;
+                _loadoutVersion++;
             }
 
             void selectDwarf(LoadoutDwarfInfo* info)
@@ -2016,7 +2105,9 @@ namespace Dwarf
             const Graphics::Font* _hudFont;
 
             LevelChangeFunction _levelChangeFunc;
-            bool _startedPreload;
+            uint32_t _loadoutVersion;
+            uint32_t _speculativeLoadoutVersion;
+            PreloadSet _speculativePreloads;
             PreloadLevelFunction _preloadLevelFunc;
             TransitionToCampaignMenuFunction _menuFunc;
             ExitGameFunction _exitFunc;
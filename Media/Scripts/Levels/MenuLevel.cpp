@@ -526,6 +526,9 @@ namespace Dwarf
 
                 Level::LevelInstance* level = GetLevel();
                 Level::LevelLayerInstance* primaryLayer = level->GetPrimaryLayer();
+                const Level::MenuLevel* menuLevel = AsA<Level::MenuLevel>(level);
+                const Level::LevelMarkers& markers = menuLevel->GetMarkers();
+                const Level::MenuLevelMarkers& menuMarkers = menuLevel->GetMenuMarkers();
                 Level::CameraController& cameraController = level->GetCameraController();
                 const Camera& worldCamera = cameraController.GetCamera();
                 const Camera& hudCamera = level->GetHUDCamera();
@@ -565,15 +568,15 @@ namespace Dwarf
 
                         if (input.IsBindJustPressed(_menuSelectBind))
                         {
-                            if (Polygonf::Contains(primaryLayer->GetTriggerArea("menu_campaign"), mousePosWorld))
+                            if (Polygonf::Contains(markers.GetTriggerArea(menuMarkers.CampaignArea), mousePosWorld))
                             {
                                 transitionToState(Menu_Campaign);
                             }
-                            else if (Polygonf::Contains(primaryLayer->GetTriggerArea("menu_challenge"), mousePosWorld))
+                            else if (Polygonf::Contains(markers.GetTriggerArea(menuMarkers.ChallengeArea), mousePosWorld))
                             {
                                 transitionToState(Menu_Challenges);
                             }
-                            else if (Polygonf::Contains(primaryLayer->GetTriggerArea("menu_exit"), mousePosWorld))
+                            else if (Polygonf::Contains(markers.GetTriggerArea(menuMarkers.ExitArea), mousePosWorld))
                             {
                                 transitionToState(Menu_Exit);
                             }
@@ -589,7 +592,7 @@ namespace Dwarf
                 {
                     if (!transitioning)
                     {
-                        const Polygonf& directorMoveArea = primaryLayer->GetTriggerArea("director_move_area");
+                        const Polygonf& directorMoveArea = markers.GetTriggerArea(menuMarkers.DirectorMoveArea);
                         if (Polygonf::Contains(directorMoveArea, mousePosWorld))
                         {
                             _directorDwarf->TransitionToPosition(mousePosWorld);
@@ -703,21 +706,21 @@ namespace Dwarf
                 }
 
                 SafeRelease(_menuLight.Material);
-                if (Polygonf::Contains(primaryLayer->GetTriggerArea("menu_campaign"), mousePosWorld))
+                if (Polygonf::Contains(markers.GetTriggerArea(menuMarkers.CampaignArea), mousePosWorld))
                 {
                     updateLightToDrawable(primaryLayer, "campaign_text", _menuLight);
                 }
-                else if (Polygonf::Contains(primaryLayer->GetTriggerArea("menu_challenge"), mousePosWorld))
+                else if (Polygonf::Contains(markers.GetTriggerArea(menuMarkers.ChallengeArea), mousePosWorld))
                 {
                     updateLightToDrawable(primaryLayer, "challenge_text", _menuLight);
                 }
-                else if (Polygonf::Contains(primaryLayer->GetTriggerArea("menu_exit"), mousePosWorld))
+                else if (Polygonf::Contains(markers.GetTriggerArea(menuMarkers.ExitArea), mousePosWorld))
                 {
                     updateLightToDrawable(primaryLayer, "exit_text", _menuLight);
                 }
 
-                const Vector2f& lookTop = GetTriggerPosition("dwarf_look_top");
-                const Vector2f& lookBot = GetTriggerPosition("dwarf_look_bottom");
+                const Vector2f& lookTop = markers.GetTriggerPosition(menuMarkers.DwarfLookTop);
+                const Vector2f& lookBot = markers.GetTriggerPosition(menuMarkers.DwarfLookBottom);
 
                 Vector2f closestPt;
                 Math::PointToLineDistance(lookTop, lookBot, mousePosWorld, closestPt);
@@ -974,6 +977,29 @@ namespace Dwarf
             PlayMusicSwell(OpeningSwellName);
         }
 
+        const MenuLevelMarkers& MenuLevel::GetMenuMarkers() const
+        {
+            return _menuMarkers;
+        }
+
+        void MenuLevel::OnResolveMarkers(LevelMarkers& markers)
+        {
+            BasicLevel::OnResolveMarkers(markers);
+
+            LevelLayerInstance* primaryLayer = GetPrimaryLayer();
+            _menuMarkers.DanceLightMiddle = markers.ResolveTrigger(primaryLayer, "dance_light_middle");
+            _menuMarkers.DanceLightRadiusStart = markers.ResolveTrigger(primaryLayer, "dance_light_radius_start");
+            _menuMarkers.DanceLightRadiusEnd = markers.ResolveTrigger(primaryLayer, "dance_light_radius_end");
+
+            _menuMarkers.DwarfLookTop = markers.ResolveTrigger(primaryLayer, "dwarf_look_top");
+            _menuMarkers.DwarfLookBottom = markers.ResolveTrigger(primaryLayer, "dwarf_look_bottom");
+
+            _menuMarkers.CampaignArea = markers.ResolveArea(primaryLayer, "menu_campaign");
+            _menuMarkers.ChallengeArea = markers.ResolveArea(primaryLayer, "menu_challenge");
+            _menuMarkers.ExitArea = markers.ResolveArea(primaryLayer, "menu_exit");
+            _menuMarkers.DirectorMoveArea = markers.ResolveArea(primaryLayer, "director_move_area");
+        }
+
         void MenuLevel::OnCreate()
         {
             BasicLevel::OnCreate();
@@ -1096,14 +1122,14 @@ namespace Dwarf
         {
             BasicLevel::OnUpdate(totalTime, dt);
 
-            LevelLayerInstance* primaryLayer = GetPrimaryLayer();
+            const LevelMarkers& markers = GetMarkers();
 
-            Vector2f danceLightMid = primaryLayer->GetTriggerPosition("dance_light_middle");
+            const Vector2f& danceLightMid = markers.GetTriggerPosition(_menuMarkers.DanceLightMiddle);
 
-            Vector2f danceLightRadiusStartPoint = primaryLayer->GetTriggerPosition("dance_light_radius_start");
+            const Vector2f& danceLightRadiusStartPoint = markers.GetTriggerPosition(_menuMarkers.DanceLightRadiusStart);
             float danceLightRadiusStart = Vector2f::Distance(danceLightMid, danceLightRadiusStartPoint);
 
-            Vector2f danceLightRadiusEndPoint = primaryLayer->GetTriggerPosition("dance_light_radius_end");
+            const Vector2f& danceLightRadiusEndPoint = markers.GetTriggerPosition(_menuMarkers.DanceLightRadiusEnd);
             float danceLightRadiusEnd = Vector2f::Distance(danceLightMid, danceLightRadiusEndPoint);
 
             Rotatorf lightArc((1.0f / _danceLights.size()) * Rotatorf::TwoPi.Angle * 0.75f);
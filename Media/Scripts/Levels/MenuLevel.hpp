@@ -21,6 +21,21 @@ namespace Dwarf
 
     namespace Level
     {
+        struct MenuLevelMarkers
+        {
+            TriggerHandle DanceLightMiddle;
+            TriggerHandle DanceLightRadiusStart;
+            TriggerHandle DanceLightRadiusEnd;
+
+            TriggerHandle DwarfLookTop;
+            TriggerHandle DwarfLookBottom;
+
+            AreaHandle CampaignArea;
+            AreaHandle ChallengeArea;
+            AreaHandle ExitArea;
+            AreaHandle DirectorMoveArea;
+        };
+
         class MenuLevel : public BasicLevel
         {
         public:
@@ -29,12 +44,17 @@ namespace Dwarf
 
             void PlayOpeningSwell();
 
+            const MenuLevelMarkers& GetMenuMarkers() const;
+
         protected:
+            virtual void OnResolveMarkers(LevelMarkers& markers) override;
             virtual void OnCreate() override;
             virtual void OnUpdate(double totalTime, float dt) override;
             virtual void OnDraw(LevelLayerInstance* layer, Graphics::LevelRenderer* levelRenderer) const override;
 
         private:
+            MenuLevelMarkers _menuMarkers;
+
             std::vector<Color> _lightColors;
             std::vector<Lights::SpotLight> _danceLights;
 
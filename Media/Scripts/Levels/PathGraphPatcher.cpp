@@ -0,0 +1,264 @@
+#include "Levels/PathGraphPatcher.hpp"
+#include "Levels/BasicLevel.hpp"
+#include "Level/LevelInstance.hpp"
+#include "Pathfinding/Path.hpp"
+#include "Profiler.hpp"
+
+#include <cmath>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        // Edges are joined to their neighbours within this distance, paths next to a patch may be routed through it
+        static const float PatchRegionMargin = 150.0f;
+
+        PathGraphPatcher::PathGraphPatcher(float cellSize, uint32_t maxReplansPerUpdate)
+            : _layers()
+            , _version(0)
+            , _replans()
+            , _queuedReplans()
+            , _cellSize(cellSize)
+            , _maxReplansPerUpdate(maxReplansPerUpdate)
+        {
+            assert(_cellSize > 0.0f);
+        }
+
+        Pathfinding::PathItemID PathGraphPatcher::AddChain(LevelLayerInstance* layer, const Chainf& chain, Pathfinding::EdgeType edgeType,
+                                                           Pathfinding::TerrainType terrain)
+        {
+            Pathfinding::PathItemID id = layer->GetPathSystem()->AddChain(chain, edgeType, terrain);
+
+            const Rectanglef region = chain.Bounds();
+            _layers[layer].objectRegions[id] = region;
+            patchRegion(layer, region);
+
+            return id;
+        }
+
+        Pathfinding::PathItemID PathGraphPatcher::AddLine(LevelLayerInstance* layer, const Vector2f& a, const Vector2f& b, Pathfinding::EdgeType edgeType,
+                                                          Pathfinding::TerrainType terrain)
+        {
+            Pathfinding::PathItemID id = layer->GetPathSystem()->AddLine(a, b, edgeType, terrain);
+
+            const Vector2f minimum(Min(a.X, b.X), Min(a.Y, b.Y));
+            const Vector2f maximum(Max(a.X, b.X), Max(a.Y, b.Y));
+            const Rectanglef region(minimum, maximum - minimum);
+            _layers[layer].objectRegions[id] = region;
+            patchRegion(layer, region);
+
+            return id;
+        }
+
+        void PathGraphPatcher::RemoveObject(LevelLayerInstance* layer, Pathfinding::PathItemID id)
+        {
+            layer->GetPathSystem()->RemoveObject(id);
+
+            layerPatches& patches = _layers[layer];
+            auto iter = patches.objectRegions.find(id);
+            if (iter != patches.objectRegions.end())
+            {
+                patchRegion(layer, iter->second);
+                patches.objectRegions.erase(iter);
+            }
+            else
+            {
+                LogWarning("PathGraphPatcher", Format("Removed path object %u that was not added through the patcher, paths through it are not re-planned.", id));
+            }
+        }
+
+        void PathGraphPatcher::SetTerrainCollisionEnabled(LevelLayerInstance* layer, const std::string& collisionName, const Rectanglef& region, bool enabled)
+        {
+            layer->SetTerrainCollisionEnabled(collisionName, enabled);
+            patchRegion(layer, region);
+        }
+
+        uint32_t PathGraphPatcher::GetRegionVersion(const LevelLayerInstance* layer, const Vector2f& position) const
+        {
+            auto layerIter = _layers.find(layer);
+            if (layerIter == _layers.end())
+            {
+                return 0;
+            }
+
+            const auto& versions = layerIter->second.versions;
+            auto iter = versions.find(getCellKey(getCellCoordinate(position.X), getCellCoordinate(position.Y)));
+            return iter != versions.end() ? iter->second : 0;
+        }
+
+        void PathGraphPatcher::Update(LevelInstance* level)
+        {
+            PROFILE_ZONE("PathGraphPatcher::Update");
+
+            for (uint32_t i = 0; i < level->GetLayerCount(); i++)
+            {
+                LevelLayerInstance* layer = level->GetLayer(i);
+                auto layerIter = _layers.find(layer);
+                if (layerIter == _layers.end() || layerIter->second.pendingRegions.empty())
+                {
+                    continue;
+                }
+
+                // Characters that are already waiting are re-planned against the latest graph anyway
+                std::vector<Rectanglef>& regions = layerIter->second.pendingRegions;
+                for (auto character : layer->GetCharacters<Character::Character>())
+                {
+                    std::shared_ptr<const Pathfinding::Path> path = character->GetCurrentPath();
+                    if (path == nullptr || _queuedReplans.count(character->GetID()) > 0 || !pathCrossesRegions(path.get(), regions))
+                    {
+                        continue;
+                    }
+
+                    // Paths that stopped short of an unreachable goal end before it, the action still holds the goal
+                    const Character::Action& action = character->GetCurrentAction();
+                    if (action.Type == Character::Action::ActionType_None)
+                    {
+                        continue;
+                    }
+
+                    replan newReplan;
+                    newReplan.layer = layer;
+                    newReplan.id = character->GetID();
+                    newReplan.action = action;
+                    newReplan.path = path;
+                    _replans.push_back(newReplan);
+                    _queuedReplans.insert(newReplan.id);
+                }
+                regions.clear();
+            }
+
+            for (uint32_t i = 0; i < _maxReplansPerUpdate && !_replans.empty(); i++)
+            {
+                replan nextReplan = _replans.front();
+                _replans.pop_front();
+                _queuedReplans.erase(nextReplan.id);
+
+                // Only characters still walking the same path for the same action are re-planned. A new order, an attack
+                // or a channel replaces the path, those are left alone.
+                Character::Character* character = nextReplan.layer->GetCharacter(nextReplan.id);
+                if (!character || !character->IsAlive())
+                {
+                    continue;
+                }
+
+                std::shared_ptr<const Pathfinding::Path> path = character->GetCurrentPath();
+                if (path == nullptr || path != nextReplan.path.lock() || character->IsInteracting() ||
+                    character->GetCurrentAction().Type != nextReplan.action.Type)
+                {
+                    continue;
+                }
+
+                // Re-issuing the action makes it plan to its own goal through the action queue, like the order it came from
+                character->PushAction(nextReplan.action, false);
+                if (character->GetCurrentPath() == nullptr)
+                {
+                    // The action ends like any other unreachable order and the character stops where it is
+                    LogWarning("PathGraphPatcher", Format("Character %u could not be re-planned after a path graph change.", nextReplan.id));
+                }
+            }
+        }
+
+        uint32_t PathGraphPatcher::GetPendingReplanCount() const
+        {
+            return static_cast<uint32_t>(_replans.size());
+        }
+
+        PathGraphPatcher::cellKey PathGraphPatcher::getCellKey(int32_t x, int32_t y) const
+        {
+            const uint64_t row = static_cast<uint32_t>(y) ^ 0x80000000u;
+            const uint64_t column = static_cast<uint32_t>(x) ^ 0x80000000u;
+            return (row << 32) | column;
+        }
+
+        int32_t PathGraphPatcher::getCellCoordinate(float value) const
+        {
+            return static_cast<int32_t>(std::floor(value / _cellSize));
+        }
+
+        void PathGraphPatcher::patchRegion(LevelLayerInstance* layer, const Rectanglef& region)
+        {
+            const Rectanglef paddedRegion(region.Position - PatchRegionMargin, region.Size + (PatchRegionMargin * 2.0f));
+
+            layerPatches& patches = _layers[layer];
+            patches.pendingRegions.push_back(paddedRegion);
+
+            const uint32_t version = ++_version;
+            const int32_t minX = getCellCoordinate(paddedRegion.Left());
+            const int32_t maxX = getCellCoordinate(paddedRegion.Right());
+            const int32_t minY = getCellCoordinate(paddedRegion.Top());
+            const int32_t maxY = getCellCoordinate(paddedRegion.Bottom());
+            for (int32_t y = minY; y <= maxY; y++)
+            {
+                for (int32_t x = minX; x <= maxX; x++)
+                {
+                    patches.versions[getCellKey(x, y)] = version;
+                }
+            }
+        }
+
+        bool PathGraphPatcher::pathCrossesRegions(const Pathfinding::Path* path, const std::vector<Rectanglef>& regions) const
+        {
+            // Sampled closely enough that no sample gap can step over a padded region
+            const float sampleSpacing = PatchRegionMargin;
+            const float length = path->GetLength();
+            for (float distance = 0.0f;; distance = Min(distance + sampleSpacing, length))
+            {
+                const Vector2f position = path->GetPathPosition(distance)->GetPosition();
+                for (const Rectanglef& region : regions)
+                {
+                    if (Rectanglef::Contains(region, position))
+                    {
+                        return true;
+                    }
+                }
+
+                if (distance >= length)
+                {
+                    return false;
+                }
+            }
+        }
+
+        Pathfinding::PathItemID AddPathChain(LevelLayerInstance* layer, const Chainf& chain, Pathfinding::EdgeType edgeType,
+                                             Pathfinding::TerrainType terrain)
+        {
+            BasicLevel* basicLevel = AsA<BasicLevel>(layer->GetLevel());
+            return basicLevel ? basicLevel->GetPathGraphPatcher().AddChain(layer, chain, edgeType, terrain)
+                              : layer->GetPathSystem()->AddChain(chain, edgeType, terrain);
+        }
+
+        Pathfinding::PathItemID AddPathLine(LevelLayerInstance* layer, const Vector2f& a, const Vector2f& b, Pathfinding::EdgeType edgeType,
+                                            Pathfinding::TerrainType terrain)
+        {
+            BasicLevel* basicLevel = AsA<BasicLevel>(layer->GetLevel());
+            return basicLevel ? basicLevel->GetPathGraphPatcher().AddLine(layer, a, b, edgeType, terrain)
+                              : layer->GetPathSystem()->AddLine(a, b, edgeType, terrain);
+        }
+
+        void RemovePathObject(LevelLayerInstance* layer, Pathfinding::PathItemID id)
+        {
+            BasicLevel* basicLevel = AsA<BasicLevel>(layer->GetLevel());
+            if (basicLevel)
+            {
+                basicLevel->GetPathGraphPatcher().RemoveObject(layer, id);
+            }
+            else
+            {
+                layer->GetPathSystem()->RemoveObject(id);
+            }
+        }
+
+        void SetPathCollisionEnabled(LevelLayerInstance* layer, const std::string& collisionName, const Rectanglef& region, bool enabled)
+        {
+            BasicLevel* basicLevel = AsA<BasicLevel>(layer->GetLevel());
+            if (basicLevel)
+            {
+                basicLevel->GetPathGraphPatcher().SetTerrainCollisionEnabled(layer, collisionName, region, enabled);
+            }
+            else
+            {
+                layer->SetTerrainCollisionEnabled(collisionName, enabled);
+            }
+        }
+    }
+}
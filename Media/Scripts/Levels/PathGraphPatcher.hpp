@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Character/Character.hpp"
+#include "Geometry/Chain.hpp"
+#include "Geometry/Rectangle.hpp"
+#include "Level/LevelTypes.hpp"
+#include "Level/LevelLayerInstance.hpp"
+#include "NonCopyable.hpp"
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        class LevelInstance;
+
+        // Tracks the region touched by each runtime change to the path graph (finished bridges, placed ladders and
+        // grapples, ropes, terrain collision toggled by doors and destroyed walls). The changes are still applied to the
+        // layer's path system, which rebuilds its graph as it always did, the patcher only decides who to re-plan. Every
+        // region carries a version stamp that the changes covering it bump. On the next update the characters whose
+        // path runs through a changed region are re-planned, no more than a few of them per frame. Characters the path
+        // system re-plans on its own may be re-planned a second time here.
+        class PathGraphPatcher : public NonCopyable
+        {
+        public:
+            PathGraphPatcher(float cellSize, uint32_t maxReplansPerUpdate);
+
+            Pathfinding::PathItemID AddChain(LevelLayerInstance* layer, const Chainf& chain, Pathfinding::EdgeType edgeType,
+                                             Pathfinding::TerrainType terrain);
+            Pathfinding::PathItemID AddLine(LevelLayerInstance* layer, const Vector2f& a, const Vector2f& b, Pathfinding::EdgeType edgeType,
+                                            Pathfinding::TerrainType terrain);
+            void RemoveObject(LevelLayerInstance* layer, Pathfinding::PathItemID id);
+
+            // Region is the area whose edges the collision adds or removes, the bounds of the collision itself
+            void SetTerrainCollisionEnabled(LevelLayerInstance* layer, const std::string& collisionName, const Rectanglef& region, bool enabled);
+
+            // Stamp of the last patch covering position, zero if the graph there is unchanged since the level started
+            uint32_t GetRegionVersion(const LevelLayerInstance* layer, const Vector2f& position) const;
+
+            void Update(LevelInstance* level);
+
+            uint32_t GetPendingReplanCount() const;
+
+        private:
+            using cellKey = uint64_t;
+            cellKey getCellKey(int32_t x, int32_t y) const;
+            int32_t getCellCoordinate(float value) const;
+
+            void patchRegion(LevelLayerInstance* layer, const Rectanglef& region);
+            bool pathCrossesRegions(const Pathfinding::Path* path, const std::vector<Rectanglef>& regions) const;
+
+            struct layerPatches
+            {
+                std::unordered_map<cellKey, uint32_t> versions;
+                std::unordered_map<Pathfinding::PathItemID, Rectanglef> objectRegions;
+                std::vector<Rectanglef> pendingRegions;
+            };
+            std::unordered_map<const LevelLayerInstance*, layerPatches> _layers;
+            uint32_t _version;
+
+            struct replan
+            {
+                LevelLayerInstance* layer;
+                Character::CharacterID id;
+                Character::Action action;
+                std::weak_ptr<const Pathfinding::Path> path;
+            };
+            std::deque<replan> _replans;
+            std::unordered_set<Character::CharacterID> _queuedReplans;
+
+            const float _cellSize;
+            const uint32_t _maxReplansPerUpdate;
+        };
+
+        // Path graph changes made through these are patched by the layer's level when it has a patcher, and applied to
+        // the layer's path system directly otherwise
+        Pathfinding::PathItemID AddPathChain(LevelLayerInstance* layer, const Chainf& chain, Pathfinding::EdgeType edgeType,
+                                             Pathfinding::TerrainType terrain);
+        Pathfinding::PathItemID AddPathLine(LevelLayerInstance* layer, const Vector2f& a, const Vector2f& b, Pathfinding::EdgeType edgeType,
+                                            Pathfinding::TerrainType terrain);
+        void RemovePathObject(LevelLayerInstance* layer, Pathfinding::PathItemID id);
+        void SetPathCollisionEnabled(LevelLayerInstance* layer, const std::string& collisionName, const Rectanglef& region, bool enabled);
+    }
+}
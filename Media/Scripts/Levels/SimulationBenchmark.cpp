@@ -0,0 +1,146 @@
+#include "Levels/SimulationBenchmark.hpp"
+#include "Levels/BasicLevel.hpp"
+
+#include <algorithm>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        static const std::array<const char*, SimulationStage_Count> SimulationStageNames =
+        {
+            "controller update",
+            "character update",
+            "path re-planning",
+            "particles",
+        };
+
+        static const std::array<float, 4> ReportedPercentiles = { 0.5f, 0.9f, 0.99f, 1.0f };
+
+        const char* GetSimulationStageName(SimulationStage stage)
+        {
+            assert(stage < SimulationStage_Count);
+            return SimulationStageNames[stage];
+        }
+
+        SimulationBenchmark::SimulationBenchmark(uint32_t frameCount)
+            : _frames()
+            , _currentFrame()
+            , _measuredStages()
+            , _frameCount(frameCount)
+            , _started(false)
+        {
+            _frames.reserve(_frameCount);
+            _currentFrame.fill(0.0);
+            _measuredStages.fill(false);
+        }
+
+        bool SimulationBenchmark::NextFrame()
+        {
+            if (IsComplete())
+            {
+                return false;
+            }
+
+            // Nothing has been timed before the first frame starts
+            if (_started)
+            {
+                _frames.push_back(_currentFrame);
+            }
+            _started = true;
+            _currentFrame.fill(0.0);
+
+            return !IsComplete();
+        }
+
+        bool SimulationBenchmark::IsComplete() const
+        {
+            return _frames.size() >= _frameCount;
+        }
+
+        void SimulationBenchmark::AddStageTime(SimulationStage stage, double milliseconds)
+        {
+            assert(stage < SimulationStage_Count);
+            _currentFrame[stage] += milliseconds;
+            _measuredStages[stage] = true;
+        }
+
+        uint32_t SimulationBenchmark::GetRecordedFrameCount() const
+        {
+            return static_cast<uint32_t>(_frames.size());
+        }
+
+        bool SimulationBenchmark::IsStageMeasured(SimulationStage stage) const
+        {
+            assert(stage < SimulationStage_Count);
+            return _measuredStages[stage];
+        }
+
+        double SimulationBenchmark::GetStagePercentile(SimulationStage stage, float percentile) const
+        {
+            assert(stage < SimulationStage_Count);
+            if (_frames.empty())
+            {
+                return 0.0;
+            }
+
+            std::vector<double> times;
+            times.reserve(_frames.size());
+            for (const auto& frame : _frames)
+            {
+                times.push_back(frame[stage]);
+            }
+
+            // Nearest rank
+            uint32_t rank = static_cast<uint32_t>(Clamp(percentile, 0.0f, 1.0f) * (times.size() - 1) + 0.5f);
+            std::nth_element(times.begin(), times.begin() + rank, times.end());
+            return times[rank];
+        }
+
+        std::string SimulationBenchmark::GetReport() const
+        {
+            std::string report = Format("Simulation benchmark, %u frames (ms/frame p50 / p90 / p99 / max):", GetRecordedFrameCount());
+            for (uint32_t i = 0; i < SimulationStage_Count; i++)
+            {
+                SimulationStage stage = static_cast<SimulationStage>(i);
+                if (!IsStageMeasured(stage))
+                {
+                    continue;
+                }
+
+                report += Format("\n    %-18s", GetSimulationStageName(stage));
+                for (float percentile : ReportedPercentiles)
+                {
+                    report += Format(" %8.3f", GetStagePercentile(stage, percentile));
+                }
+            }
+            return report;
+        }
+
+        ScopedSimulationTimer::ScopedSimulationTimer(SimulationBenchmark* benchmark, SimulationStage stage)
+            : _benchmark(benchmark)
+            , _stage(stage)
+            , _start()
+        {
+            if (_benchmark)
+            {
+                _start = std::chrono::high_resolution_clock::now();
+            }
+        }
+
+        ScopedSimulationTimer::~ScopedSimulationTimer()
+        {
+            if (_benchmark)
+            {
+                std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - _start;
+                _benchmark->AddStageTime(_stage, elapsed.count());
+            }
+        }
+
+        SimulationBenchmark* GetSimulationBenchmark(LevelInstance* level)
+        {
+            BasicLevel* basicLevel = AsA<BasicLevel>(level);
+            return basicLevel ? basicLevel->GetSimulationBenchmark() : nullptr;
+        }
+    }
+}
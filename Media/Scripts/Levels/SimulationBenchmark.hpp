@@ -0,0 +1,74 @@
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        class LevelInstance;
+
+        enum SimulationStage
+        {
+            SimulationStage_ControllerUpdate,
+            SimulationStage_CharacterUpdate,
+            SimulationStage_PathReplanning,
+            SimulationStage_Particles,
+            SimulationStage_Count,
+        };
+
+        const char* GetSimulationStageName(SimulationStage stage);
+
+        // Collects how long each simulation stage takes per frame over a fixed number of frames and reports the
+        // percentiles of each. Stages are timed by the level, characters and controllers that run them, stages that
+        // nothing ran during the benchmark (such as the controller update of a level without a player) are left out
+        // of the report.
+        class SimulationBenchmark : public NonCopyable
+        {
+        public:
+            SimulationBenchmark(uint32_t frameCount);
+
+            // Closes the current frame and starts the next one, returns false once all frames have been recorded
+            bool NextFrame();
+            bool IsComplete() const;
+
+            void AddStageTime(SimulationStage stage, double milliseconds);
+
+            uint32_t GetRecordedFrameCount() const;
+            bool IsStageMeasured(SimulationStage stage) const;
+            double GetStagePercentile(SimulationStage stage, float percentile) const;
+            std::string GetReport() const;
+
+        private:
+            using frameTimes = std::array<double, SimulationStage_Count>;
+            std::vector<frameTimes> _frames;
+            frameTimes _currentFrame;
+            std::array<bool, SimulationStage_Count> _measuredStages;
+
+            const uint32_t _frameCount;
+            bool _started;
+        };
+
+        // Adds the time between its construction and destruction to a stage of the benchmark, does nothing when there
+        // is no benchmark running
+        class ScopedSimulationTimer : public NonCopyable
+        {
+        public:
+            ScopedSimulationTimer(SimulationBenchmark* benchmark, SimulationStage stage);
+            ~ScopedSimulationTimer();
+
+        private:
+            SimulationBenchmark* _benchmark;
+            SimulationStage _stage;
+            std::chrono::high_resolution_clock::time_point _start;
+        };
+
+        // Benchmark of the level when it is a BasicLevel that is being benchmarked, nullptr otherwise
+        SimulationBenchmark* GetSimulationBenchmark(LevelInstance* level);
+    }
+}
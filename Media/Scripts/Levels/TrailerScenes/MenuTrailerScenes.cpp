@@ -45,11 +45,10 @@ namespace Dwarf
             void setupTitleLightScene()
             {
                 auto primaryLayer = GetPrimaryLayer();
-                auto pathSystem = primaryLayer->GetPathSystem();
 
                 Vector2f ropeTopRight = primaryLayer->GetTriggerPosition("rope_top_right");
                 Vector2f ropeBotRight = primaryLayer->GetTriggerPosition("rope_bot_right");
-                pathSystem->AddLine(ropeBotRight, ropeTopRight, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope);
+                AddPathLine(primaryLayer, ropeBotRight, ropeTopRight, Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope);
 
                 auto navigator = primaryLayer->SpawnCharacter(primaryLayer->GetTriggerPosition("menu_trailer_navigator_spawn"), "nav", nullptr, Character::BindCharacterConstructor<Character::NavigatorDwarf>());
                 navigator->GiveItem(Item::BindItemConstructor<Item::BasicHeadlamp>());
@@ -0,0 +1,288 @@
+#include "Levels/TriggerVolumeManager.hpp"
+#include "Level/LevelInstance.hpp"
+#include "Level/LevelLayerInstance.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        TriggerVolumeManager::TriggerVolumeManager(float cellSize)
+            : _volumes()
+            , _nextHandle(InvalidTriggerVolumeHandle)
+            , _grid()
+            , _gridDirty(false)
+            , _retestAll(false)
+            , _characters()
+            , _candidateVolumes()
+            , _insideVolumes()
+            , _pendingEvents()
+            , _cellSize(cellSize)
+        {
+            assert(_cellSize > 0.0f);
+        }
+
+        TriggerVolumeHandle TriggerVolumeManager::AddVolume(LevelLayerInstance* layer, const TriggerVolumeParameters& parameters)
+        {
+            assert(layer);
+
+            TriggerVolumeHandle handle = ++_nextHandle;
+
+            volume& newVolume = _volumes[handle];
+            newVolume.layer = layer;
+            newVolume.parameters = parameters;
+            newVolume.removed = false;
+
+            // Characters that are already standing in the new volume have to enter it on the next update
+            _gridDirty = true;
+            _retestAll = true;
+
+            return handle;
+        }
+
+        void TriggerVolumeManager::RemoveVolume(TriggerVolumeHandle handle)
+        {
+            auto iter = _volumes.find(handle);
+            if (iter != _volumes.end())
+            {
+                iter->second.removed = true;
+                iter->second.occupants.clear();
+                _gridDirty = true;
+            }
+        }
+
+        uint32_t TriggerVolumeManager::GetOccupantCount(TriggerVolumeHandle handle) const
+        {
+            auto iter = _volumes.find(handle);
+            return (iter != _volumes.end()) ? static_cast<uint32_t>(iter->second.occupants.size()) : 0;
+        }
+
+        const std::unordered_set<Character::CharacterID>& TriggerVolumeManager::GetOccupants(TriggerVolumeHandle handle) const
+        {
+            static const std::unordered_set<Character::CharacterID> NoOccupants;
+
+            auto iter = _volumes.find(handle);
+            return (iter != _volumes.end()) ? iter->second.occupants : NoOccupants;
+        }
+
+        void TriggerVolumeManager::Update(LevelInstance* level)
+        {
+            purgeRemovedVolumes();
+
+            if (_volumes.empty())
+            {
+                _characters.clear();
+                _retestAll = false;
+                return;
+            }
+
+            if (_gridDirty)
+            {
+                rebuildGrid();
+            }
+
+            for (auto& character : _characters)
+            {
+                character.second.seen = false;
+            }
+
+            _pendingEvents.clear();
+            for (uint32_t i = 0; i < level->GetLayerCount(); i++)
+            {
+                LevelLayerInstance* layer = level->GetLayer(i);
+
+                auto layerGrid = _grid.find(layer);
+                if (layerGrid == _grid.end())
+                {
+                    continue;
+                }
+
+                for (auto character : layer->GetCharacters<Character::Character>())
+                {
+                    const Character::CharacterID id = character->GetID();
+                    const Vector2f& position = character->GetPosition();
+                    const Vector2f boundsMiddle = character->GetBounds().Middle();
+
+                    auto trackedIter = _characters.find(id);
+                    bool isNew = trackedIter == _characters.end();
+                    if (isNew)
+                    {
+                        trackedIter = _characters.insert(std::make_pair(id, trackedCharacter())).first;
+                    }
+
+                    trackedCharacter& tracked = trackedIter->second;
+                    tracked.seen = true;
+
+                    if (!isNew && !_retestAll && tracked.position == position && tracked.boundsMiddle == boundsMiddle)
+                    {
+                        continue;
+                    }
+                    tracked.position = position;
+                    tracked.boundsMiddle = boundsMiddle;
+
+                    // Gather the volumes overlapping the cells of either test point
+                    _candidateVolumes.clear();
+                    for (const Vector2f& point : { position, boundsMiddle })
+                    {
+                        auto cell = layerGrid->second.find(getCellKey(getCellCoordinate(point.X), getCellCoordinate(point.Y)));
+                        if (cell != layerGrid->second.end())
+                        {
+                            _candidateVolumes.insert(_candidateVolumes.end(), cell->second.begin(), cell->second.end());
+                        }
+                    }
+                    std::sort(_candidateVolumes.begin(), _candidateVolumes.end());
+                    _candidateVolumes.erase(std::unique(_candidateVolumes.begin(), _candidateVolumes.end()), _candidateVolumes.end());
+
+                    _insideVolumes.clear();
+                    for (auto handle : _candidateVolumes)
+                    {
+                        const volume& candidate = _volumes[handle];
+                        if (candidate.removed || (candidate.parameters.Filter && !candidate.parameters.Filter(character)))
+                        {
+                            continue;
+                        }
+
+                        const Vector2f& testPoint = (candidate.parameters.TestPoint == TriggerVolumeTestPoint_Position) ? position : boundsMiddle;
+                        for (const auto& area : candidate.parameters.Areas)
+                        {
+                            if (Polygonf::Contains(area, testPoint))
+                            {
+                                _insideVolumes.push_back(handle);
+                                break;
+                            }
+                        }
+                    }
+
+                    // Both lists are sorted, walk them together to find enters and exits
+                    auto oldIter = tracked.volumes.begin();
+                    auto newIter = _insideVolumes.begin();
+                    while (oldIter != tracked.volumes.end() || newIter != _insideVolumes.end())
+                    {
+                        if (newIter == _insideVolumes.end() || (oldIter != tracked.volumes.end() && *oldIter < *newIter))
+                        {
+                            _volumes[*oldIter].occupants.erase(id);
+                            _pendingEvents.push_back(pendingEvent { *oldIter, id, false });
+                            oldIter++;
+                        }
+                        else if (oldIter == tracked.volumes.end() || *newIter < *oldIter)
+                        {
+                            _volumes[*newIter].occupants.insert(id);
+                            _pendingEvents.push_back(pendingEvent { *newIter, id, true });
+                            newIter++;
+                        }
+                        else
+                        {
+                            oldIter++;
+                            newIter++;
+                        }
+                    }
+                    tracked.volumes = _insideVolumes;
+                }
+            }
+            _retestAll = false;
+
+            // Characters that have left the level leave all of their volumes
+            auto characterIter = _characters.begin();
+            while (characterIter != _characters.end())
+            {
+                if (characterIter->second.seen)
+                {
+                    characterIter++;
+                    continue;
+                }
+
+                for (auto handle : characterIter->second.volumes)
+                {
+                    _volumes[handle].occupants.erase(characterIter->first);
+                    _pendingEvents.push_back(pendingEvent { handle, characterIter->first, false });
+                }
+                characterIter = _characters.erase(characterIter);
+            }
+
+            for (const auto& event : _pendingEvents)
+            {
+                auto volumeIter = _volumes.find(event.volume);
+                if (volumeIter == _volumes.end() || volumeIter->second.removed)
+                {
+                    continue;
+                }
+
+                const TriggerVolumeCallback& callback = event.entered ? volumeIter->second.parameters.OnEnter : volumeIter->second.parameters.OnExit;
+                if (callback)
+                {
+                    callback(event.volume, event.character);
+                }
+            }
+            _pendingEvents.clear();
+
+            purgeRemovedVolumes();
+        }
+
+        TriggerVolumeManager::cellKey TriggerVolumeManager::getCellKey(int32_t x, int32_t y) const
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x);
+        }
+
+        int32_t TriggerVolumeManager::getCellCoordinate(float value) const
+        {
+            return static_cast<int32_t>(std::floor(value / _cellSize));
+        }
+
+        void TriggerVolumeManager::rebuildGrid()
+        {
+            _grid.clear();
+            for (const auto& volumeEntry : _volumes)
+            {
+                const volume& curVolume = volumeEntry.second;
+                if (curVolume.removed)
+                {
+                    continue;
+                }
+
+                auto& layerGrid = _grid[curVolume.layer];
+                for (const auto& area : curVolume.parameters.Areas)
+                {
+                    const Rectanglef bounds = area.Bounds();
+                    const int32_t minX = getCellCoordinate(bounds.Left());
+                    const int32_t maxX = getCellCoordinate(bounds.Right());
+                    const int32_t minY = getCellCoordinate(Min(bounds.Top(), bounds.Bottom()));
+                    const int32_t maxY = getCellCoordinate(Max(bounds.Top(), bounds.Bottom()));
+                    for (int32_t y = minY; y <= maxY; y++)
+                    {
+                        for (int32_t x = minX; x <= maxX; x++)
+                        {
+                            std::vector<TriggerVolumeHandle>& cell = layerGrid[getCellKey(x, y)];
+                            if (cell.empty() || cell.back() != volumeEntry.first)
+                            {
+                                cell.push_back(volumeEntry.first);
+                            }
+                        }
+                    }
+                }
+            }
+            _gridDirty = false;
+        }
+
+        void TriggerVolumeManager::purgeRemovedVolumes()
+        {
+            auto volumeIter = _volumes.begin();
+            while (volumeIter != _volumes.end())
+            {
+                if (!volumeIter->second.removed)
+                {
+                    volumeIter++;
+                    continue;
+                }
+
+                for (auto& character : _characters)
+                {
+                    auto& volumes = character.second.volumes;
+                    volumes.erase(std::remove(volumes.begin(), volumes.end(), volumeIter->first), volumes.end());
+                }
+                volumeIter = _volumes.erase(volumeIter);
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Character/Character.hpp"
+#include "Geometry/Polygon.hpp"
+#include "Level/LevelTypes.hpp"
+#include "NonCopyable.hpp"
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Level
+    {
+        class LevelInstance;
+        class LevelLayerInstance;
+
+        typedef uint32_t TriggerVolumeHandle;
+        static const TriggerVolumeHandle InvalidTriggerVolumeHandle = 0;
+
+        enum TriggerVolumeTestPoint
+        {
+            TriggerVolumeTestPoint_Position,
+            TriggerVolumeTestPoint_BoundsMiddle,
+        };
+
+        using TriggerVolumeFilter = std::function<bool(const Character::Character*)>;
+        using TriggerVolumeCallback = std::function<void(TriggerVolumeHandle, Character::CharacterID)>;
+
+        struct TriggerVolumeParameters
+        {
+            std::vector<Polygonf> Areas;
+            TriggerVolumeTestPoint TestPoint = TriggerVolumeTestPoint_BoundsMiddle;
+            TriggerVolumeFilter Filter = nullptr;
+            TriggerVolumeCallback OnEnter = nullptr;
+            TriggerVolumeCallback OnExit = nullptr;
+        };
+
+        // Tracks which characters are inside named trigger areas so that level scripts can react to arrivals instead of
+        // filtering every character against the polygons each frame. Areas are bucketed into a grid, and a character is
+        // only retested when it moves, against the areas sharing its cell. Callbacks are dispatched after all characters
+        // have been tested so that they may add or remove volumes.
+        class TriggerVolumeManager : public NonCopyable
+        {
+        public:
+            TriggerVolumeManager(float cellSize);
+
+            TriggerVolumeHandle AddVolume(LevelLayerInstance* layer, const TriggerVolumeParameters& parameters);
+            void RemoveVolume(TriggerVolumeHandle handle);
+
+            uint32_t GetOccupantCount(TriggerVolumeHandle handle) const;
+            const std::unordered_set<Character::CharacterID>& GetOccupants(TriggerVolumeHandle handle) const;
+
+            void Update(LevelInstance* level);
+
+        private:
+            using cellKey = uint64_t;
+            cellKey getCellKey(int32_t x, int32_t y) const;
+            int32_t getCellCoordinate(float value) const;
+
+            void rebuildGrid();
+            void purgeRemovedVolumes();
+
+            struct volume
+            {
+                LevelLayerInstance* layer;
+                TriggerVolumeParameters parameters;
+                std::unordered_set<Character::CharacterID> occupants;
+                bool removed;
+            };
+            std::map<TriggerVolumeHandle, volume> _volumes;
+            TriggerVolumeHandle _nextHandle;
+
+            std::unordered_map<const LevelLayerInstance*, std::unordered_map<cellKey, std::vector<TriggerVolumeHandle>>> _grid;
+            bool _gridDirty;
+            bool _retestAll;
+
+            struct trackedCharacter
+            {
+                Vector2f position;
+                Vector2f boundsMiddle;
+                std::vector<TriggerVolumeHandle> volumes;
+                bool seen;
+            };
+            std::unordered_map<Character::CharacterID, trackedCharacter> _characters;
+
+            std::vector<TriggerVolumeHandle> _candidateVolumes;
+            std::vector<TriggerVolumeHandle> _insideVolumes;
+
+            struct pendingEvent
+            {
+                TriggerVolumeHandle volume;
+                Character::CharacterID character;
+                bool entered;
+            };
+            std::vector<pendingEvent> _pendingEvents;
+
+            const float _cellSize;
+        };
+    }
+}
@@ -45,8 +45,7 @@ namespace Dwarf
             LevelLayerInstance* primaryLayer = GetPrimaryLayer();
             primaryLayer->SetKillOnLeavingCameraBounds(false);
 
-            Pathfinding::PathSystem* pathSystem = primaryLayer->GetPathSystem();
-            pathSystem->AddChain(Chainf(primaryLayer->GetSpline("rope_spline").Points()), Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope);
+            AddPathChain(primaryLayer, Chainf(primaryLayer->GetSpline("rope_spline").Points()), Pathfinding::EdgeType_Climb, Pathfinding::TerrainType::Rope);
         }
 
         void VideoTunnelLevel::OnUpdate(double totalTime, float dt)
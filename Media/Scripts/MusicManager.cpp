@@ -1,4 +1,5 @@
 #include "MusicManager.hpp"
+#include "Profiler.hpp"
 
 #include <imgui.h>
 
@@ -176,6 +177,8 @@ namespace Dwarf
 
         void MusicManager::Update(double totalTime, float dt)
         {
+            PROFILE_ZONE("MusicManager::Update");
+
             for (auto& nameTrack : _tracks)
             {
                 auto& track = nameTrack.second;
@@ -0,0 +1,289 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace Dwarf
+{
+    namespace Profiling
+    {
+        static const uint32_t ThreadEventCapacity = 16384;
+        static const uint32_t FrameHistoryLength = 256;
+
+        // Events closest to being overwritten by the writing thread are not collected
+        static const uint32_t CollectionMargin = 256;
+
+        struct threadBuffer
+        {
+            std::array<ZoneEvent, ThreadEventCapacity> events;
+            std::atomic<uint64_t> written;
+            uint32_t depth;
+            uint32_t thread;
+            bool inUse;
+        };
+
+        struct profilerState
+        {
+            std::chrono::high_resolution_clock::time_point start;
+            std::atomic<uint32_t> frame;
+            std::atomic<bool> paused;
+            std::array<std::atomic<uint64_t>, FrameHistoryLength> frameBegins;
+
+            std::mutex threadsMutex;
+            std::vector<std::shared_ptr<threadBuffer>> threads;
+        };
+
+        static profilerState& getState()
+        {
+            static profilerState state;
+            static std::once_flag initialized;
+            std::call_once(initialized, []()
+            {
+                state.start = std::chrono::high_resolution_clock::now();
+                state.frame = 0;
+                state.paused = false;
+                for (auto& begin : state.frameBegins)
+                {
+                    begin = 0;
+                }
+            });
+            return state;
+        }
+
+        // Hands the buffer back to the registry when its thread exits, the next thread to record a zone reuses it so
+        // that there are never more buffers than threads alive at the same time
+        struct threadBufferLease
+        {
+            std::shared_ptr<threadBuffer> buffer;
+
+            ~threadBufferLease()
+            {
+                if (buffer)
+                {
+                    profilerState& state = getState();
+                    std::lock_guard<std::mutex> lock(state.threadsMutex);
+                    buffer->inUse = false;
+                }
+            }
+        };
+
+        static threadBuffer& getThreadBuffer()
+        {
+            // Buffers are shared with the registry so that zones of finished threads can still be exported until the
+            // buffer is reused
+            static thread_local threadBufferLease lease;
+            if (!lease.buffer)
+            {
+                profilerState& state = getState();
+                std::lock_guard<std::mutex> lock(state.threadsMutex);
+
+                auto freeBuffer = std::find_if(state.threads.begin(), state.threads.end(), [](const std::shared_ptr<threadBuffer>& buffer)
+                {
+                    return !buffer->inUse;
+                });
+                if (freeBuffer != state.threads.end())
+                {
+                    lease.buffer = *freeBuffer;
+                }
+                else
+                {
+                    lease.buffer = std::make_shared<threadBuffer>();
+                    lease.buffer->written = 0;
+                    lease.buffer->thread = static_cast<uint32_t>(state.threads.size());
+                    state.threads.push_back(lease.buffer);
+                }
+
+                lease.buffer->depth = 0;
+                lease.buffer->inUse = true;
+            }
+            return *lease.buffer;
+        }
+
+        ScopedZone::ScopedZone(const char* name)
+            : _name(name)
+            , _begin(GetTimestamp())
+        {
+            getThreadBuffer().depth++;
+        }
+
+        ScopedZone::~ScopedZone()
+        {
+            uint64_t end = GetTimestamp();
+
+            threadBuffer& buffer = getThreadBuffer();
+            assert(buffer.depth > 0);
+            buffer.depth--;
+
+            profilerState& state = getState();
+            if (state.paused)
+            {
+                return;
+            }
+
+            // Zones are written when they close, children are therefore always written before their parents
+            uint64_t index = buffer.written.load(std::memory_order_relaxed);
+            ZoneEvent& event = buffer.events[index % ThreadEventCapacity];
+            event.Name = _name;
+            event.Begin = _begin;
+            event.End = end;
+            event.Depth = buffer.depth;
+            event.Frame = state.frame.load(std::memory_order_relaxed);
+            event.Thread = buffer.thread;
+            buffer.written.store(index + 1, std::memory_order_release);
+        }
+
+        void MarkFrame()
+        {
+            profilerState& state = getState();
+            if (state.paused)
+            {
+                return;
+            }
+
+            uint32_t frame = state.frame.load() + 1;
+            state.frameBegins[frame % FrameHistoryLength] = GetTimestamp();
+            state.frame = frame;
+        }
+
+        uint32_t GetCurrentFrame()
+        {
+            return getState().frame;
+        }
+
+        void SetPaused(bool paused)
+        {
+            getState().paused = paused;
+        }
+
+        bool IsPaused()
+        {
+            return getState().paused;
+        }
+
+        uint64_t GetTimestamp()
+        {
+            auto elapsed = std::chrono::high_resolution_clock::now() - getState().start;
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        }
+
+        std::vector<ZoneEvent> CollectZones(uint32_t firstFrame, uint32_t lastFrame)
+        {
+            profilerState& state = getState();
+
+            std::vector<std::shared_ptr<threadBuffer>> threads;
+            {
+                std::lock_guard<std::mutex> lock(state.threadsMutex);
+                threads = state.threads;
+            }
+
+            std::vector<ZoneEvent> zones;
+            for (const auto& buffer : threads)
+            {
+                uint64_t written = buffer->written.load(std::memory_order_acquire);
+                uint64_t available = std::min<uint64_t>(written, ThreadEventCapacity - CollectionMargin);
+                for (uint64_t i = written - available; i < written; i++)
+                {
+                    const ZoneEvent& event = buffer->events[i % ThreadEventCapacity];
+                    if (event.Frame >= firstFrame && event.Frame <= lastFrame)
+                    {
+                        zones.push_back(event);
+                    }
+                }
+            }
+
+            std::sort(zones.begin(), zones.end(), [](const ZoneEvent& a, const ZoneEvent& b)
+            {
+                if (a.Thread != b.Thread)
+                {
+                    return a.Thread < b.Thread;
+                }
+                if (a.Begin != b.Begin)
+                {
+                    return a.Begin < b.Begin;
+                }
+                return a.Depth < b.Depth;
+            });
+
+            return zones;
+        }
+
+        bool GetFrameBegin(uint32_t frame, uint64_t& outBegin)
+        {
+            profilerState& state = getState();
+            uint32_t currentFrame = state.frame;
+            if (frame > currentFrame || currentFrame - frame >= FrameHistoryLength)
+            {
+                return false;
+            }
+
+            outBegin = state.frameBegins[frame % FrameHistoryLength];
+            return true;
+        }
+
+        static void writeEscapedString(std::ofstream& stream, const char* str)
+        {
+            stream << '"';
+            for (const char* c = str; *c != '\0'; c++)
+            {
+                switch (*c)
+                {
+                case '"':
+                    stream << "\\\"";
+                    break;
+
+                case '\\':
+                    stream << "\\\\";
+                    break;
+
+                default:
+                    if (static_cast<unsigned char>(*c) >= 0x20)
+                    {
+                        stream << *c;
+                    }
+                    break;
+                }
+            }
+            stream << '"';
+        }
+
+        bool ExportChromeTrace(const std::string& path)
+        {
+            std::ofstream stream(path.c_str(), std::ios::out | std::ios::trunc);
+            if (!stream)
+            {
+                LogError("Profiler", Format("Failed to open %s for writing the profiler trace.", path.c_str()));
+                return false;
+            }
+
+            std::vector<ZoneEvent> zones = CollectZones(0, GetCurrentFrame());
+
+            // Complete events ("ph":"X"), timestamps and durations are in microseconds
+            stream << "{\"traceEvents\":[";
+            for (uint32_t i = 0; i < zones.size(); i++)
+            {
+                const ZoneEvent& zone = zones[i];
+                stream << (i > 0 ? ",\n" : "\n");
+                stream << "{\"name\":";
+                writeEscapedString(stream, zone.Name);
+                stream << ",\"cat\":\"frame " << zone.Frame << "\"";
+                stream << ",\"ph\":\"X\",\"ts\":" << zone.Begin << ",\"dur\":" << (zone.End - zone.Begin);
+                stream << ",\"pid\":0,\"tid\":" << zone.Thread << "}";
+            }
+            stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+            if (!stream)
+            {
+                LogError("Profiler", Format("Failed to write the profiler trace to %s.", path.c_str()));
+                return false;
+            }
+
+            LogInfo("Profiler", Format("Exported %u zones to %s.", static_cast<uint32_t>(zones.size()), path.c_str()));
+            return true;
+        }
+    }
+}
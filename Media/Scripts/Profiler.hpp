@@ -0,0 +1,71 @@
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Zones are only recorded in builds that define DWARF_PROFILER_ENABLED (generated with -Ddwarf_profiler=1),
+// PROFILE_ZONE compiles to nothing otherwise
+
+#define PROFILE_ZONE_CONCAT_INNER(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_INNER(a, b)
+
+#ifdef DWARF_PROFILER_ENABLED
+#define PROFILE_ZONE(name) ::Dwarf::Profiling::ScopedZone PROFILE_ZONE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FRAME() ::Dwarf::Profiling::MarkFrame()
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_FRAME()
+#endif
+
+namespace Dwarf
+{
+    namespace Profiling
+    {
+        struct ZoneEvent
+        {
+            const char* Name;
+            uint64_t Begin;
+            uint64_t End;
+            uint32_t Depth;
+            uint32_t Frame;
+            uint32_t Thread;
+        };
+
+        // Records the time spent between its construction and destruction to the ring buffer of the calling thread.
+        // The name must outlive the profiler, string literals are expected.
+        class ScopedZone : public NonCopyable
+        {
+        public:
+            ScopedZone(const char* name);
+            ~ScopedZone();
+
+        private:
+            const char* _name;
+            uint64_t _begin;
+        };
+
+        // Starts a new frame. Zones are grouped by the frame they end in so that a zone spanning the start of a frame
+        // stays in the same frame as the zones nested in it.
+        void MarkFrame();
+        uint32_t GetCurrentFrame();
+
+        void SetPaused(bool paused);
+        bool IsPaused();
+
+        // Microseconds since the profiler was first used
+        uint64_t GetTimestamp();
+
+        // Copies the zones still held by every thread's ring buffer that end in frames [firstFrame, lastFrame],
+        // sorted by thread and then begin time
+        std::vector<ZoneEvent> CollectZones(uint32_t firstFrame, uint32_t lastFrame);
+
+        // Begin timestamp of a recent frame, false if it is no longer tracked
+        bool GetFrameBegin(uint32_t frame, uint64_t& outBegin);
+
+        // Writes the zones still held by the ring buffers to a Chrome trace event file, viewable in chrome://tracing
+        bool ExportChromeTrace(const std::string& path);
+    }
+}
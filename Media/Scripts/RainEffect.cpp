@@ -4,6 +4,7 @@
 #include "Random.hpp"
 #include "Utility.hpp"
 #include "Graphics/GraphicsUtility.hpp"
+#include "Profiler.hpp"
 
 #include <limits>
 #include <assert.h>
@@ -282,6 +283,8 @@ namespace Dwarf
 
     void RainEffect::Update(double totalTime, float dt)
     {
+        PROFILE_ZONE("RainEffect::Update");
+
         for (auto& grid : _grids)
         {
             const Vector2f deltaDir = _rainDirection.ToVector(dt);
@@ -359,6 +362,8 @@ namespace Dwarf
 
     void RainEffect::Draw(Graphics::SpriteRenderer* spriteRenderer) const
     {
+        PROFILE_ZONE("RainEffect::Draw");
+
         Camera cam = _layer->GetCamera();
         Rectanglef bounds = cam.GetViewBounds().ToRectangle();
 
@@ -2,15 +2,26 @@
 
 #include "DwarfNameGenerator.hpp"
 
+#include <random>
+
 namespace Dwarf
 {
     namespace Settings
     {
+        // Drawn outside of the seeded game random numbers, new profiles need a different one even when replaying
+        static uint32_t generateCampaignID()
+        {
+            std::random_device device;
+            std::uniform_int_distribution<uint32_t> distribution(1, UINT32_MAX);
+            return distribution(device);
+        }
+
         TheDeepDeepProfile::TheDeepDeepProfile()
             : _characterProfiles()
             , _unlockedCampaignLevels()
             , _unlockedChallengeLevels()
             , _cheatsEnabled(false)
+            , _campaignID(generateCampaignID())
         {
             auto allCharacters = Character::GameCharacter::GetAllCharacters();
             for (auto characterType : allCharacters)
@@ -337,7 +348,7 @@ namespace Dwarf
         template <typename T>
         static void EnumerateItemTypePreloads(const std::vector<Item::ItemInfo<T>>& infos, PreloadSet& preloads)
         {
-            for (auto info : infos)
+            for (const auto& info : infos)
             {
                 PreloadFunction func = Item::GameItem<T>::GetPreloadFunction(info.Key);
                 func(preloads);
@@ -346,7 +357,7 @@ namespace Dwarf
 
         void TheDeepDeepProfile::EnumerateItemPreloads(PreloadSet& preloads) const
         {
-            for (auto charType : _characterProfiles)
+            for (const auto& charType : _characterProfiles)
             {
                 EnumerateItemTypePreloads(charType.second.Weapons, preloads);
                 EnumerateItemTypePreloads(charType.second.Armors, preloads);
@@ -356,9 +367,9 @@ namespace Dwarf
 
         void TheDeepDeepProfile::EnumerateAbilityPreloads(PreloadSet& preloads) const
         {
-            for (auto charType : _characterProfiles)
+            for (const auto& charType : _characterProfiles)
             {
-                for (auto info : charType.second.Abilities)
+                for (const auto& info : charType.second.Abilities)
                 {
                     PreloadFunction func = Ability::GameAbility::GetPreloadFunction(info.Key);
                     func(preloads);
@@ -459,6 +470,11 @@ namespace Dwarf
             return _cheatsEnabled;
         }
 
+        uint32_t TheDeepDeepProfile::GetCampaignID() const
+        {
+            return _campaignID;
+        }
+
         std::string TheDeepDeepProfile::GetDefaultProfilePath()
         {
             return Format("%s/%s/%s", FileSystem::GetHomePath().c_str(), "Dwarf", "settings.config");
@@ -596,6 +612,7 @@ namespace Dwarf
             }
 
             node.AddChild("Cheats").SetValue(value.AreCheatsEnabled());
+            node.AddChild("CampaignID").SetValue(value._campaignID);
         }
 
         void ReadFromXML(const XML::XMLNode& node, TheDeepDeepProfile& value)
@@ -723,6 +740,9 @@ namespace Dwarf
             }
 
             value.SetCheatsEnabled(node.GetChild("Cheats").GetValue<bool>(false));
+
+            // Profiles saved before campaigns had an ID keep the files saved for them under ID zero
+            value._campaignID = node.GetChild("CampaignID").GetValue<uint32_t>(0);
         }
 
         static TheDeepDeepProfile generateDefaultProfile()
@@ -85,6 +85,9 @@ namespace Dwarf
             void SetCheatsEnabled(bool enabled);
             bool AreCheatsEnabled() const;
 
+            // Tells the campaigns of different profiles apart in the names of the files saved for them
+            uint32_t GetCampaignID() const;
+
             static std::string GetDefaultProfilePath();
 
         private:
@@ -117,6 +120,8 @@ namespace Dwarf
 
             bool _cheatsEnabled;
 
+            uint32_t _campaignID;
+
             friend void WriteToXML(XML::XMLNode& node, const TheDeepDeepProfile& value);
             friend void ReadFromXML(const XML::XMLNode& node, TheDeepDeepProfile& value);
         };
@@ -0,0 +1,207 @@
+#include "Tests.hpp"
+#include "Levels/CheckpointRecord.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Tests
+    {
+        using Level::CheckpointRecord;
+
+        // Values that sit on the boundaries of the variable length integer encoding
+        static const uint32_t EdgeValues[] = { 0u, 127u, 128u, UINT32_MAX };
+
+        static bool recordsEqual(const CheckpointRecord& a, const CheckpointRecord& b, const std::vector<CheckpointRecord::Key>& keys)
+        {
+            if (a.GetEntryCount() != b.GetEntryCount() || a.GetRemovedCount() != b.GetRemovedCount())
+            {
+                return false;
+            }
+
+            for (CheckpointRecord::Key key : keys)
+            {
+                uint32_t aValue = 0, bValue = 0;
+                bool aFound = a.Get(key, aValue);
+                bool bFound = b.Get(key, bValue);
+                if (aFound != bFound || (aFound && aValue != bValue) || a.IsRemoved(key) != b.IsRemoved(key))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        static bool roundTrip(const CheckpointRecord& record, CheckpointRecord& result)
+        {
+            std::vector<uint8_t> data;
+            record.Serialize(data);
+
+            const uint8_t* cur = data.data();
+            const uint8_t* end = cur + data.size();
+            return result.Deserialize(cur, end) && cur == end;
+        }
+
+        static bool testVarInts()
+        {
+            bool passed = true;
+
+            const uint64_t values[] = { 0u, 127u, 128u, UINT32_MAX, UINT64_MAX };
+            std::vector<uint8_t> data;
+            for (uint64_t value : values)
+            {
+                Level::WriteVarInt(data, value);
+            }
+
+            // One byte up to 127, two from 128, five for the largest 32 bit value and ten for the largest 64 bit one
+            TEST_EXPECT(data.size() == 1 + 1 + 2 + 5 + 10);
+
+            const uint8_t* cur = data.data();
+            const uint8_t* end = cur + data.size();
+            for (uint64_t value : values)
+            {
+                uint64_t readValue = 0;
+                TEST_EXPECT(Level::ReadVarInt(cur, end, readValue));
+                TEST_EXPECT(readValue == value);
+            }
+            TEST_EXPECT(cur == end);
+
+            // Truncated input is rejected instead of read past the end
+            cur = data.data() + data.size() - 10;
+            uint64_t truncated = 0;
+            TEST_EXPECT(!Level::ReadVarInt(cur, end - 1, truncated));
+
+            return passed;
+        }
+
+        static bool testFullRecordRoundTrip()
+        {
+            bool passed = true;
+
+            CheckpointRecord record;
+            std::vector<CheckpointRecord::Key> keys;
+            for (uint32_t id : EdgeValues)
+            {
+                for (uint32_t value : EdgeValues)
+                {
+                    CheckpointRecord::Key key = CheckpointRecord::MakeKey(Level::CheckpointEntryType_CharacterKilled, value & 0xFFFFFF, id);
+                    record.Set(key, value);
+                    keys.push_back(key);
+                }
+            }
+
+            CheckpointRecord loaded;
+            TEST_EXPECT(roundTrip(record, loaded));
+            TEST_EXPECT(recordsEqual(record, loaded, keys));
+
+            return passed;
+        }
+
+        static bool testDeltaRecordRoundTrip()
+        {
+            bool passed = true;
+
+            std::vector<CheckpointRecord::Key> keys;
+            for (uint32_t id : EdgeValues)
+            {
+                keys.push_back(CheckpointRecord::MakeKey(Level::CheckpointEntryType_FlameHolderOn, 1, id));
+                keys.push_back(CheckpointRecord::MakeKey(Level::CheckpointEntryType_BridgeBuildPercentage, 0xFFFFFF, id));
+            }
+
+            CheckpointRecord base;
+            for (uint32_t i = 0; i < keys.size(); i++)
+            {
+                base.Set(keys[i], EdgeValues[i % 4]);
+            }
+
+            // Change some values, drop some keys and add one the base does not have
+            CheckpointRecord target;
+            for (uint32_t i = 0; i < keys.size(); i++)
+            {
+                if (i % 3 != 0)
+                {
+                    target.Set(keys[i], EdgeValues[(i + 1) % 4]);
+                }
+            }
+            CheckpointRecord::Key addedKey = CheckpointRecord::MakeKey(Level::CheckpointEntryType_LevelFlag, 0, 128);
+            target.Set(addedKey, UINT32_MAX);
+            keys.push_back(addedKey);
+
+            CheckpointRecord delta = CheckpointRecord::Diff(base, target);
+            TEST_EXPECT(delta.GetRemovedCount() > 0);
+
+            CheckpointRecord loadedBase;
+            CheckpointRecord loadedDelta;
+            TEST_EXPECT(roundTrip(base, loadedBase));
+            TEST_EXPECT(roundTrip(delta, loadedDelta));
+            TEST_EXPECT(recordsEqual(delta, loadedDelta, keys));
+
+            CheckpointRecord applied = CheckpointRecord::Apply(loadedBase, loadedDelta);
+            TEST_EXPECT(recordsEqual(target, applied, keys));
+
+            return passed;
+        }
+
+        static bool testCorruptRecordRejected()
+        {
+            bool passed = true;
+
+            CheckpointRecord record;
+            record.Set(CheckpointRecord::MakeKey(Level::CheckpointEntryType_LevelFlag, 0, 1), 128);
+
+            std::vector<uint8_t> data;
+            record.Serialize(data);
+            data.pop_back();
+
+            CheckpointRecord loaded;
+            const uint8_t* cur = data.data();
+            TEST_EXPECT(!loaded.Deserialize(cur, data.data() + data.size()));
+
+            return passed;
+        }
+
+        static bool deserializes(const std::vector<uint64_t>& varInts)
+        {
+            std::vector<uint8_t> data;
+            for (uint64_t value : varInts)
+            {
+                Level::WriteVarInt(data, value);
+            }
+
+            CheckpointRecord loaded;
+            const uint8_t* cur = data.data();
+            return loaded.Deserialize(cur, data.data() + data.size());
+        }
+
+        static bool testUnsortedKeysRejected()
+        {
+            bool passed = true;
+
+            // Entry count, then key delta and value per entry, then removed count and key deltas
+            TEST_EXPECT(deserializes({ 2, 0, 1, 1, 2, 2, 0, 1 }));
+
+            // Repeated keys
+            TEST_EXPECT(!deserializes({ 2, 5, 1, 0, 2, 0 }));
+            TEST_EXPECT(!deserializes({ 0, 2, 3, 0 }));
+
+            // Keys wrapping around
+            TEST_EXPECT(!deserializes({ 2, UINT64_MAX, 1, 1, 2, 0 }));
+            TEST_EXPECT(!deserializes({ 0, 2, UINT64_MAX, 1 }));
+
+            return passed;
+        }
+
+        bool RunCheckpointRecordTests()
+        {
+            bool passed = true;
+            passed &= testVarInts();
+            passed &= testFullRecordRoundTrip();
+            passed &= testDeltaRecordRoundTrip();
+            passed &= testCorruptRecordRejected();
+            passed &= testUnsortedKeysRejected();
+            return passed;
+        }
+    }
+}
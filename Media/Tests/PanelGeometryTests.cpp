@@ -0,0 +1,202 @@
+#include "Tests.hpp"
+#include "HUD/PanelBorder.hpp"
+
+#include <vector>
+
+namespace Dwarf
+{
+    namespace Tests
+    {
+        static const uint32_t IdleFrameCount = 600;
+
+        // Stands in for the sprite renderer and keeps the sprites submitted to it
+        class RecordingSpriteRenderer
+        {
+        public:
+            struct sprite
+            {
+                const Graphics::Texture* texture;
+                Rectanglef destination;
+                Rectanglef subRect;
+                Rotatorf rotation;
+            };
+
+            void DrawSprite(const Graphics::Texture* texture, const Rectanglef& destination, const Rectanglef& subRect, const Color& color,
+                            const Rotatorf& rotation, const Vector2f& origin)
+            {
+                sprite newSprite;
+                newSprite.texture = texture;
+                newSprite.destination = destination;
+                newSprite.subRect = subRect;
+                newSprite.rotation = rotation;
+                _sprites.push_back(newSprite);
+            }
+
+            const std::vector<sprite>& GetSprites() const
+            {
+                return _sprites;
+            }
+
+            void Clear()
+            {
+                _sprites.clear();
+            }
+
+        private:
+            std::vector<sprite> _sprites;
+        };
+
+        static bool spritesEqual(const std::vector<RecordingSpriteRenderer::sprite>& a, const std::vector<RecordingSpriteRenderer::sprite>& b)
+        {
+            if (a.size() != b.size())
+            {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < a.size(); i++)
+            {
+                if (a[i].texture != b[i].texture || !(a[i].destination == b[i].destination) || !(a[i].subRect == b[i].subRect) ||
+                    !(a[i].rotation == b[i].rotation))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Corners and edges of different sizes, each with its own sub rectangle so that the sprites can be told apart
+        class BorderMaterials
+        {
+        public:
+            BorderMaterials()
+            {
+                static const Vector2f sizes[] =
+                {
+                    Vector2f(12.0f, 12.0f), Vector2f(14.0f, 12.0f), Vector2f(12.0f, 16.0f), Vector2f(14.0f, 16.0f),
+                    Vector2f(6.0f, 8.0f), Vector2f(7.0f, 8.0f), Vector2f(8.0f, 5.0f), Vector2f(8.0f, 6.0f),
+                };
+
+                float x = 0.0f;
+                for (const Vector2f& size : sizes)
+                {
+                    _materials.push_back(MakeResource<Graphics::HUDMaterial>(nullptr, Rectanglef(x, 0.0f, size.X, size.Y), false));
+                    x += size.X;
+                }
+            }
+
+            ResourcePointer<HUD::TilingBorderPanelDrawable> CreateBorder() const
+            {
+                return MakeResource<HUD::TilingBorderPanelDrawable>(_materials[0], _materials[1], _materials[2], _materials[3],
+                                                                     _materials[4], _materials[5], _materials[6], _materials[7]);
+            }
+
+        private:
+            std::vector<ResourcePointer<Graphics::HUDMaterial>> _materials;
+        };
+
+        static bool testIdleMenuDoesNotRelayout()
+        {
+            bool passed = true;
+
+            // A menu of more panels than the old shared cache could hold, each with its own border
+            const uint32_t panelCount = 100;
+            BorderMaterials materials;
+            std::vector<ResourcePointer<HUD::TilingBorderPanelDrawable>> borders;
+            std::vector<RotatedRectanglef> bounds;
+            for (uint32_t i = 0; i < panelCount; i++)
+            {
+                borders.push_back(materials.CreateBorder());
+                bounds.push_back(RotatedRectanglef(Rectanglef(10.0f, 10.0f + i * 40.0f, 200.0f, 32.0f), 0.0f));
+            }
+
+            std::vector<std::vector<RecordingSpriteRenderer::sprite>> firstFrame(panelCount);
+            bool idleFramesMatch = true;
+            RecordingSpriteRenderer renderer;
+            for (uint32_t frame = 0; frame < IdleFrameCount; frame++)
+            {
+                for (uint32_t i = 0; i < panelCount; i++)
+                {
+                    renderer.Clear();
+                    borders[i]->DrawTo(&renderer, Color::White, bounds[i], 1.0f);
+
+                    if (frame == 0)
+                    {
+                        firstFrame[i] = renderer.GetSprites();
+                        TEST_EXPECT(firstFrame[i].size() == 8);
+                    }
+                    else
+                    {
+                        idleFramesMatch &= spritesEqual(firstFrame[i], renderer.GetSprites());
+                    }
+                }
+            }
+
+            // The idle frames submit the same sprites as the frame that laid the borders out
+            TEST_EXPECT(idleFramesMatch);
+
+            // Laid out on the first frame and never again while the menu sits idle
+            for (uint32_t i = 0; i < panelCount; i++)
+            {
+                TEST_EXPECT(borders[i]->GetLayoutCount() == 1);
+            }
+
+            return passed;
+        }
+
+        static bool testMoveAndResizeRelayout()
+        {
+            bool passed = true;
+
+            BorderMaterials materials;
+            ResourcePointer<HUD::TilingBorderPanelDrawable> border = materials.CreateBorder();
+            RotatedRectanglef bounds(Rectanglef(0.0f, 0.0f, 100.0f, 50.0f), 0.0f);
+
+            RecordingSpriteRenderer renderer;
+            border->DrawTo(&renderer, Color::White, bounds, 1.0f);
+            std::vector<RecordingSpriteRenderer::sprite> previous = renderer.GetSprites();
+            TEST_EXPECT(border->GetLayoutCount() == 1);
+
+            // Scrolling moves the panel every frame, each position is laid out once and drawn where the panel is
+            for (uint32_t frame = 0; frame < 10; frame++)
+            {
+                bounds.Center.Y += 4.0f;
+
+                renderer.Clear();
+                border->DrawTo(&renderer, Color::White, bounds, 1.0f);
+                TEST_EXPECT(!spritesEqual(previous, renderer.GetSprites()));
+                previous = renderer.GetSprites();
+
+                renderer.Clear();
+                border->DrawTo(&renderer, Color::White, bounds, 1.0f);
+                TEST_EXPECT(spritesEqual(previous, renderer.GetSprites()));
+            }
+            TEST_EXPECT(border->GetLayoutCount() == 11);
+
+            bounds.Extents.X *= 2.0f;
+            renderer.Clear();
+            border->DrawTo(&renderer, Color::White, bounds, 1.0f);
+            TEST_EXPECT(border->GetLayoutCount() == 12);
+            TEST_EXPECT(!spritesEqual(previous, renderer.GetSprites()));
+
+            renderer.Clear();
+            border->DrawTo(&renderer, Color::White, bounds, 2.0f);
+            TEST_EXPECT(border->GetLayoutCount() == 13);
+
+            // The colour is applied as the sprites are submitted and does not need a new layout
+            renderer.Clear();
+            border->DrawTo(&renderer, Color::Red, bounds, 2.0f);
+            TEST_EXPECT(border->GetLayoutCount() == 13);
+
+            return passed;
+        }
+
+        bool RunPanelGeometryTests()
+        {
+            bool passed = true;
+            passed &= testIdleMenuDoesNotRelayout();
+            passed &= testMoveAndResizeRelayout();
+            return passed;
+        }
+    }
+}
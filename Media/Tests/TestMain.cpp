@@ -0,0 +1,24 @@
+#include "Tests.hpp"
+
+#include <utility>
+
+using namespace Dwarf::Tests;
+
+int main(int argc, char** argv)
+{
+    static const std::pair<const char*, bool(*)()> tests[] =
+    {
+        { "CheckpointRecord", RunCheckpointRecordTests },
+        { "PanelGeometry", RunPanelGeometryTests },
+    };
+
+    bool passed = true;
+    for (const auto& test : tests)
+    {
+        bool testPassed = test.second();
+        std::printf("%s: %s\n", test.first, testPassed ? "passed" : "FAILED");
+        passed &= testPassed;
+    }
+
+    return passed ? 0 : 1;
+}
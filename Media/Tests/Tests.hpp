@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdio>
+
+namespace Dwarf
+{
+    namespace Tests
+    {
+        // Reports a failed expectation and fails the test it is used in, the test keeps running so that every failure
+        // of a run is reported
+        #define TEST_EXPECT(expression) \
+            do \
+            { \
+                if (!(expression)) \
+                { \
+                    std::printf("%s(%d): expected %s\n", __FILE__, __LINE__, #expression); \
+                    passed = false; \
+                } \
+            } while (false)
+
+        bool RunCheckpointRecordTests();
+        bool RunPanelGeometryTests();
+    }
+}